@@ -25,6 +25,7 @@ namespace Force {
 
   class Generator;
   class AddressSolver;
+  class AddressingMode;
   class Instruction;
 
   /*!
@@ -43,6 +44,7 @@ namespace Force {
 
     ASSIGNMENT_OPERATOR_ABSENT(AddressSolutionFilter);
     virtual bool FilterSolutions(AddressSolver& rAddrSolver, const Instruction& rInstr, uint32& rRemainder) const = 0; //!< Solution filtering method interface.
+    virtual bool FilterOnSolution(const Instruction& rInstr, const AddressingMode& rMode) const { return false; } //!< Return true if filtering the mode reads its solution, so it has to be solved before filtering.
     virtual void Setup(const Generator* pGen); //!< Setup the address solution filter.
   protected:
     AddressSolutionFilter(const AddressSolutionFilter& rOther) //!< Copy constructor.
@@ -122,6 +124,7 @@ namespace Force {
     const char* Type() const override { return "SpAlignmentFilter"; } //!< Return SpAlignmentFilter object type in string format.
 
     bool FilterSolutions(AddressSolver& rAddrSolver, const Instruction& rInstr, uint32& rRemainder) const override; //!< Filtering solutions.
+    bool FilterOnSolution(const Instruction& rInstr, const AddressingMode& rMode) const override; //!< Return true if the mode is filtered by the alignment of its SP base value.
     void Setup(const Generator* pGen) override; //!< Setup the address solution filter.
   protected:
     SpAlignmentFilter(const SpAlignmentFilter& rOther) : AddressSolutionFilter(rOther), mPreventHard(false), mUnalign(false) { } //!< Copy constructor.
@@ -16,6 +16,7 @@
 #ifndef Force_AddressSolver_H
 #define Force_AddressSolver_H
 
+#include <set>
 #include <vector>
 
 #include "Defines.h"
@@ -573,6 +574,9 @@ namespace Force {
     bool GetRegisterChoiceCombinations(const Generator& gen, Instruction& instr, std::vector<AddressingMode* >& rRegChoiceCombos) const; //!< Get an AddressingMode instance for each register choice combination.
     const AddressingMode* SolveWithModes(const Generator& gen, const Instruction& instr, const std::vector<AddressingMode* >& rModes); //!< Solve for each of the specified modes and then choose one of the solutions.
     void ChooseSolution(const Generator& rGen, const Instruction& rInstr); //!< Choose from viable solutions.
+    void SampleSolution(const Generator& rGen, const Instruction& rInstr, const std::vector<AddressingMode* >& rModes); //!< Solve the specified modes in weighted random order until a usable solution is chosen.
+    bool SolveMode(AddressingMode* pMode) const; //!< Solve for the specified mode, return true if it has a solution.
+    bool SolutionUsable(AddressingMode& rMode) const; //!< Choose the sub solution of a solved mode and map its target addresses, return true if it can be used.
     bool UpdateSolution(); //!< Update current solution.
     bool IsRegisterUsable(const Register* regPtr, cbool hasIss) const; //!< Return true if register can be used.
   protected:
@@ -583,7 +587,9 @@ namespace Force {
     std::vector<AddressingMode* > mSolutionChoices; //!< Solution choices.
     std::vector<AddressingMode* > mFilteredChoices; //!< Filtered choices.
   private:
-    bool ShouldEnableAddressShortage(const Instruction& instr) const; //!< Indicate whether there is a potential shortage of base register choices with valid addresses.
+    bool ShouldEnableAddressShortage(const Instruction& instr, uint32 numSolutions) const; //!< Indicate whether there is a potential shortage of base register choices with valid addresses.
+    void UpdateAddressShortage(const Generator& rGen, const Instruction& rInstr, uint32 numSolutions) const; //!< Enable the address shortage mode if there is a potential shortage.
+    uint32 CountSolutions(std::vector<std::vector<AddressingMode* > >& rModeTiers, std::set<AddressingMode* >& rSolvedModes) const; //!< Solve the undrawn modes until a second solution is found, return the number of solutions.
   };
 
   /*!
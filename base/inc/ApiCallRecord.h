@@ -0,0 +1,198 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef Force_ApiCallRecord_H
+#define Force_ApiCallRecord_H
+
+#include <fstream>
+#include <functional>
+#include <map>
+#include <string>
+
+#include "Python.h"
+#include "pybind11/pybind11.h"
+
+#include "Config.h"
+#include "Defines.h"
+#include "Enums.h"
+#include "Log.h"
+#include "PyInterface.h"
+#include "Scheduler.h"
+
+namespace py = pybind11;
+
+namespace Force {
+
+  typedef std::function<void(PyInterface&, const py::tuple&)> ApiReplayFunction; //!< Function replaying a recorded call to one PyInterface API.
+
+  /*!
+    \class ApiCallRecorder
+    \brief Records the API calls a test template makes through PyInterface, so that they can be replayed without running the template.
+
+    Every call is written with its arguments, together with the number of random values the front end drew since control was last
+    passed to it.  Call backs into the front end are bracketed in the record so that the calls made from them are replayed at the same point.
+  */
+  class ApiCallRecorder {
+  public:
+    explicit ApiCallRecorder(const std::string& rFilePath); //!< Constructor, open the record file.
+    ~ApiCallRecorder() { } //!< Destructor.
+    ASSIGNMENT_OPERATOR_ABSENT(ApiCallRecorder);
+    COPY_CONSTRUCTOR_ABSENT(ApiCallRecorder);
+
+    void Start(); //!< Start recording, control is about to be passed to the front end.
+    void Finish(); //!< Finish recording, the front end has returned.
+    void EnterApi(const std::string& rName, const py::tuple& rArgs); //!< Record an API call entering the back end.
+    void ExitApi(); //!< Note an API call returning to the front end.
+    void EnterCallBack(const std::string& rName); //!< Record a call back into the front end.
+    void ExitCallBack(uint64 result); //!< Record a call back returning to the back end with its result.
+    void RecordUnsupported(const std::string& rName); //!< Record a call that can't be replayed.
+  private:
+    void NoteDraws(); //!< Note the random value counts when control passes to the front end.
+    void WriteDraws(); //!< Write the number of random values the front end drew since control was passed to it.
+    bool WriteValue(std::ostream& rOutStream, const py::handle& rValue); //!< Write an argument value, return false if the value can't be recorded.
+  private:
+    std::string mFilePath; //!< Path to the record file.
+    std::ofstream mFile; //!< Record file.
+    uint64 mDraws32; //!< 32-bit random value count when control was last passed to the front end.
+    uint64 mDraws64; //!< 64-bit random value count when control was last passed to the front end.
+  };
+
+  /*!
+    \class ApiCallScope
+    \brief Records an API call for as long as it is in scope.
+  */
+  class ApiCallScope {
+  public:
+    ApiCallScope(ApiCallRecorder* pRecorder, const std::string& rName, const py::tuple& rArgs) : mpRecorder(pRecorder) { mpRecorder->EnterApi(rName, rArgs); } //!< Constructor, record the call.
+    ~ApiCallScope() { mpRecorder->ExitApi(); } //!< Destructor, note the call returning.
+    ASSIGNMENT_OPERATOR_ABSENT(ApiCallScope);
+    COPY_CONSTRUCTOR_ABSENT(ApiCallScope);
+  private:
+    ApiCallRecorder* mpRecorder; //!< Recorder of the call.
+  };
+
+  /*!
+    \class ApiCallReplayer
+    \brief Replays the API calls recorded by ApiCallRecorder into PyInterface in place of running the test template.
+
+    The random values drawn by the front end are skipped rather than drawn, and call backs into the front end return their recorded
+    results, so with the seed and options of the recording the generated test is identical.  The replay fails as soon as the back
+    end departs from the record.
+  */
+  class ApiCallReplayer {
+  public:
+    explicit ApiCallReplayer(const std::string& rFilePath); //!< Constructor, open the record file.
+    ~ApiCallReplayer() { } //!< Destructor.
+    ASSIGNMENT_OPERATOR_ABSENT(ApiCallReplayer);
+    COPY_CONSTRUCTOR_ABSENT(ApiCallReplayer);
+
+    void Run(PyInterface& rInterface); //!< Replay all recorded calls.
+    uint64 ReplayCallBack(const std::string& rName); //!< Replay the calls made from a call back into the front end, return the recorded result.
+    static void RegisterApi(const std::string& rName, const ApiReplayFunction& rFunction); //!< Register the function replaying calls to an API.
+  private:
+    void ReplayUntil(char endTag); //!< Replay records until the one with the specified tag.
+    void ReplayCall(); //!< Replay one recorded API call.
+    void SkipDraws(); //!< Read a random value count and skip the values drawn by the front end.
+    char ReadTag(); //!< Read the tag starting the next record.
+    std::string ReadWord(); //!< Read the next space separated word.
+    py::object ReadValue(); //!< Read an argument value.
+  private:
+    std::string mFilePath; //!< Path to the record file.
+    std::ifstream mFile; //!< Record file.
+    PyInterface* mpInterface; //!< Interface the calls are replayed into.
+    static std::map<std::string, ApiReplayFunction> msReplayFunctions; //!< Functions replaying calls, indexed by API name.
+  };
+
+  uint64 call_back_front_end(const std::string& rName, const std::function<uint64()>& rCallBack); //!< Call back into the front end, recording or replaying the call back when API calls are recorded or replayed.
+
+  /*!
+    \struct ApiArgIndices
+    \brief Compile time sequence of the indices of the arguments of a replayed API call.
+  */
+  template <std::size_t... Indices> struct ApiArgIndices { };
+  template <std::size_t N, std::size_t... Indices> struct MakeApiArgIndices : MakeApiArgIndices<N - 1, N - 1, Indices...> { };
+  template <std::size_t... Indices> struct MakeApiArgIndices<0, Indices...> { typedef ApiArgIndices<Indices...> type; };
+
+  /*!
+    \struct ReplayableApiObject
+    \brief Locates the recorder, and the object replayed calls are made on, for the classes with replayable APIs.
+  */
+  template <class Object> struct ReplayableApiObject;
+
+  template <> struct ReplayableApiObject<PyInterface> {
+    static ApiCallRecorder* Recorder(const PyInterface& rSelf) { return rSelf.GetApiCallRecorder(); } //!< Return the recorder of the API calls, nullptr if not recording.
+    static PyInterface& ReplayObject(PyInterface& rInterface) { return rInterface; } //!< Return the object replayed calls are made on.
+  };
+
+  template <> struct ReplayableApiObject<Config> {
+    static ApiCallRecorder* Recorder(const Config& rSelf) { return Scheduler::Instance()->GetPyInterface()->GetApiCallRecorder(); } //!< Return the recorder of the API calls, nullptr if not recording.
+    static Config& ReplayObject(PyInterface& rInterface) { return *Config::Instance(); } //!< Return the object replayed calls are made on.
+  };
+
+  /*!
+    \class ReplayableApi
+    \brief Binds a back end method to a Python API, recording the calls when recording is on and registering how to replay them.
+  */
+  template <class Object, class Method, class Ret, class... Args>
+  class ReplayableApi {
+  public:
+    ReplayableApi(const char* pName, Method method) //!< Constructor, register the replay function of the API.
+      : mpName(pName), mMethod(method)
+    {
+      ApiCallReplayer::RegisterApi(pName, [pName, method](PyInterface& rInterface, const py::tuple& rArgs) {
+          if (rArgs.size() != sizeof...(Args)) {
+            LOG(fail) << "{ReplayableApi} recorded call to \"" << pName << "\" has " << std::dec << rArgs.size() << " arguments, expecting " << sizeof...(Args) << "." << std::endl;
+            FAIL("api-replay-argument-count");
+          }
+          Replay(ReplayableApiObject<Object>::ReplayObject(rInterface), method, rArgs, typename MakeApiArgIndices<sizeof...(Args)>::type());
+        });
+    }
+
+    Ret operator()(Object& rSelf, Args... args) const //!< Call the method, recording the call if recording.
+    {
+      ApiCallRecorder* recorder = ReplayableApiObject<Object>::Recorder(rSelf);
+      if (nullptr == recorder) {
+        return (rSelf.*mMethod)(args...);
+      }
+
+      ApiCallScope call_scope(recorder, mpName, py::make_tuple(args...));
+      return (rSelf.*mMethod)(args...);
+    }
+  private:
+    template <std::size_t... Indices>
+    static void Replay(Object& rSelf, Method method, const py::tuple& rArgs, ApiArgIndices<Indices...>) //!< Call the method with the recorded arguments.
+    {
+      (rSelf.*method)(rArgs[Indices].template cast<typename std::decay<Args>::type>()...);
+    }
+  private:
+    const char* mpName; //!< Name of the API.
+    Method mMethod; //!< Method called by the API.
+  };
+
+  template <class Object, class Ret, class... Args>
+  ReplayableApi<Object, Ret (Object::*)(Args...), Ret, Args...> replayable_api(const char* pName, Ret (Object::*method)(Args...)) //!< Bind a method to a replayable Python API.
+  {
+    return ReplayableApi<Object, Ret (Object::*)(Args...), Ret, Args...>(pName, method);
+  }
+
+  template <class Object, class Ret, class... Args>
+  ReplayableApi<Object, Ret (Object::*)(Args...) const, Ret, Args...> replayable_api(const char* pName, Ret (Object::*method)(Args...) const) //!< Bind a const method to a replayable Python API.
+  {
+    return ReplayableApi<Object, Ret (Object::*)(Args...) const, Ret, Args...>(pName, method);
+  }
+
+}
+
+#endif
@@ -45,6 +45,7 @@ namespace Force {
   class AddressFilteringRegulator;
   class AddressSolutionFilter;
   class AddressTableManager;
+  class NativeExecutor;
   class SimAPI;
 
   /*!
@@ -90,6 +91,7 @@ namespace Force {
     virtual const std::string FindOperandShortName(const std::string& longName) const { return ""; } //!< return operand short name
     virtual PhysicalPageManager* InstantiatePhysicalPageManager(EMemBankType bankType, MemoryTraitsManager* pMemTraitsManager) const { return nullptr; } //!< Instantiate a PhysicalPageManager object based on the ArchInfo type.
     virtual MemoryTraitsRegistry* InstantiateMemoryTraitsRegistry() const { return nullptr; } //!< Instantiate a MemoryTraitsRegistry object based on the ArchInfo type.
+    virtual NativeExecutor* InstantiateNativeExecutor() const { return nullptr; } //!< Instantiate a NativeExecutor object based on the ArchInfo type, nullptr if the architecture doesn't support native execution.
     virtual void SetupSimAPIs() { } //!< Setup simulator APIs.
   protected:
     explicit ArchInfo(const std::string& name);
@@ -24,6 +24,7 @@
 namespace Force {
 
   class BntNode;
+  struct MemoryUsage;
 
   /*!
     \class BntNodeManager
@@ -42,6 +43,7 @@ namespace Force {
     void SwapBntNodes(std::vector<BntNode*>& rSwapVec); //!< swap Bnt nodes
     BntNode* GetHotSpeculativeBntNode() const { return mpHotSpeculativeBntNode; } //!< get hot speculative Bnt node
     void PopSpeculativeBntNode(); //!< pop speculative Bnt node from the stack and set to be hot.
+    void AccountMemory(MemoryUsage& rUsage) const; //!< Add the estimated memory held by the saved Bnt nodes.
 
     ASSIGNMENT_OPERATOR_ABSENT(BntNodeManager);
   protected:
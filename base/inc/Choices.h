@@ -57,6 +57,8 @@ namespace Force {
     virtual const Choice* Choose() const { return this; } //!< Return a const pointer to self.
     virtual Choice* ChooseMutable() { return this; } //!< Return a mutable pointer to self.
     virtual uint32 ApplyFilter(const ChoicesFilter& filter); //!< Apply choices filter.
+    virtual uint32 FilteredWeight(const ChoicesFilter& filter) const; //!< Return the weight the Choice would have after ApplyFilter(), without modifying it.
+    virtual const Choice* ChooseFiltered(const ChoicesFilter& filter) const { return this; } //!< Return a const pointer to self.
 
     virtual const Choice* CyclicChoose() //!< Method used by hierarchical cyclic choosing.
     {
@@ -130,6 +132,8 @@ class RangeChoice : public Choice {
     const Choice* Choose() const override; //!< Choose a random choice from the children.
     Choice* ChooseMutable() override; //!< Return a mutable pointer to chosen choice.
     uint32 ApplyFilter(const ChoicesFilter& filter) override; //!< Apply choices filter to the ChoiceTree.
+    uint32 FilteredWeight(const ChoicesFilter& filter) const override; //!< Return the weight the ChoiceTree would have after ApplyFilter(), without modifying it.
+    const Choice* ChooseFiltered(const ChoicesFilter& filter) const override; //!< Choose a random choice as Choose() would after ApplyFilter(), without cloning or modifying the ChoiceTree.
     const Choice* CyclicChoose() override; //!< Method used by hierarchical cyclic choosing.
     void RestoreWeight(const Choice* pRefChoice) override; //!< Restore weight from reference ChoiceTree object.
     uint64 ChooseValueWithHardConstraint(const ConstraintSet& rHardConstr); //!< Choose value with a hard constraint, if no choice available then randomly choose from the hard constraint.  Constraint is applied to the ChoiceTree.
@@ -59,6 +59,27 @@ namespace Force {
     const ConstraintSet* mpConstraint; //!< Pointer to to-be-applied ConstraintSet object.
   };
 
+  /*!
+    \class CombinedChoicesFilter
+    \brief Filtering choices by two filters, a Choice is usable only if both filters find it usable.
+  */
+
+  class CombinedChoicesFilter : public ChoicesFilter {
+  public:
+    ASSIGNMENT_OPERATOR_ABSENT(CombinedChoicesFilter);
+    COPY_CONSTRUCTOR_DEFAULT(CombinedChoicesFilter);
+    CombinedChoicesFilter(const ChoicesFilter* pFirstFilter, const ChoicesFilter* pSecondFilter) //!< Constructor with the two filters to combine.
+      : ChoicesFilter(), mpFirstFilter(pFirstFilter), mpSecondFilter(pSecondFilter)
+    {
+    }
+    ~CombinedChoicesFilter() { mpFirstFilter = nullptr; mpSecondFilter = nullptr; }
+
+    bool Usable(const Choice* choice) const override; //!< Check if a Choice object is usable.
+  protected:
+    const ChoicesFilter* mpFirstFilter; //!< Pointer to the first filter.
+    const ChoicesFilter* mpSecondFilter; //!< Pointer to the second filter.
+  };
+
   class MultiRegisterOperand;
 
   /*!
@@ -61,6 +61,7 @@ namespace Force {
     uint32 Id() const { return mId; } //!< Return modification set ID
     void Clear(); //!< Clear all modifications
     void ApplyModifications(ChoiceTree* choiceTree) const; //!< Apply modifications to a ChoiceTree, if applicable
+    bool HasModifications(const std::string& choiceTreeName) const { return mModificationSet.find(choiceTreeName) != mModificationSet.end(); } //!< Return whether the set has modifications for a ChoiceTree
     void Merge(const ChoiceModificationSet& rOther); //!< Merge modifications from the other set, the other set's modification take precedence
     uint32 AddChoicesModification(const std::string& choiceTreeName, const std::map<std::string, uint32>& modifications); //!< add modifications for a ChoiceTree to the set
     const std::string ToString() const; //!< return a string description of the contents of the modification set
@@ -89,6 +90,7 @@ namespace Force {
 
     ChoiceTree* CloneChoiceTree(const std::string& treeName) const; //!< clone a ChoiceTree from the base line choice set and apply ChoiceModification if there is any
     ChoiceTree* TryCloneChoiceTree(const std::string& treeName) const; //!< clone a ChoiceTree from the base line choice set and apply ChoiceModification if there is any, called when not sure if the choice tree exists or not
+    bool HasModifications(const std::string& treeName) const { return mCurrentModificationSet.HasModifications(treeName); } //!< Return whether any committed ChoiceModification applies to the ChoiceTree
     void AddChoicesModification(const std::string& treeName, const std::map<std::string, uint32>& modifications, uint32 setId); //!< Add modifcations for a ChoiceTree to mNewModificationSet.
     void CommitModificationSet(uint32 setId); //!< Commit the mNewModifciationSet to the stack, clear it and increment the ID
     void RevertModificationSet(uint32 setId);  //!< Found and remove the modification set from the stack
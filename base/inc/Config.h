@@ -68,6 +68,10 @@ namespace Force {
     uint64 NumThreads() const { return mNumThreads; } //!< Return number of threads per core to simulate with.
     const std::string& IssApiTraceFile() const { return mIssApiTraceFile; } //!< Return path to simulator API trace file
     void SetIssApiTraceFile(const std::string& apitrace_file) { mIssApiTraceFile = apitrace_file; } //!< Set path to simulator API trace file
+    const std::string& ApiRecordFile() const { return mApiRecordFile; } //!< Return path to the file recording the template API calls.
+    void SetApiRecordFile(const std::string& rRecordFile) { mApiRecordFile = rRecordFile; } //!< Set path to the file recording the template API calls.
+    const std::string& ApiReplayFile() const { return mApiReplayFile; } //!< Return path to the recorded template API calls to replay.
+    void SetApiReplayFile(const std::string& rReplayFile) { mApiReplayFile = rReplayFile; } //!< Set path to the recorded template API calls to replay.
     bool ParseOptions(const std::string& optionsString); //!< Parse options string.
     void SetOption(const std::string& optName, const std::string& optValue); //!< Set option value.
     uint64 GetOptionValue(const std::string& optName, bool& valid) const; //!< Return a option value, if available.
@@ -81,7 +85,7 @@ namespace Force {
     const std::string HeadOfImage() const; //!< return the head string of the Image file.
     uint64 MaxVectorLen() const; //!< Return max vector register length allowed to be simulated.
   private:
-    Config() : mMainPath(), mTestTemplate(), mMemoryFile(), mBntFile(), mChoicesModificationFile(), mIssApiTraceFile(), mLimits(), mOptionValues(), mOptionStrings(), mGlobalStateValues(), mGlobalStateStrings(), mImportFiles(), mOutputAssembly(true), mOutputImage(false), mDoSimulate(false), mOutputWithSeed(false), mInitialSeed(0), mMaxInstructions(0), mNumChips(1), mNumCores(1), mNumThreads(1), mFailOverrides(false), mConfigFile(), mCommandLine(), mMaxVectorLen(0) { }  //!< Constructor, private.
+    Config() : mMainPath(), mTestTemplate(), mMemoryFile(), mBntFile(), mChoicesModificationFile(), mIssApiTraceFile(), mApiRecordFile(), mApiReplayFile(), mLimits(), mOptionValues(), mOptionStrings(), mGlobalStateValues(), mGlobalStateStrings(), mImportFiles(), mOutputAssembly(true), mOutputImage(false), mDoSimulate(false), mOutputWithSeed(false), mInitialSeed(0), mMaxInstructions(0), mNumChips(1), mNumCores(1), mNumThreads(1), mFailOverrides(false), mConfigFile(), mCommandLine(), mMaxVectorLen(0) { }  //!< Constructor, private.
     virtual ~Config() { } //!< Destructor, private.
     void Setup(const std::string& programPath); //!< Config object setup.
     bool ParseOption(const std::string& optString); //!< Parse option string.
@@ -94,6 +98,8 @@ namespace Force {
     std::string mBntFile; //!< Name of the Bnt file
     std::string mChoicesModificationFile; //!< name of the choices modification file
     std::string mIssApiTraceFile; //!< Name of simulator API trace file.
+    std::string mApiRecordFile; //!< Name of the file recording the template API calls.
+    std::string mApiReplayFile; //!< Name of the file with recorded template API calls to replay.
     std::map<ELimitType, uint64> mLimits; //!< Limitation value of various aspects of the design.
     std::map<std::string, uint64> mOptionValues; //!< Test option values.
     std::map<std::string, std::string> mOptionStrings; //!< Test option strings.
@@ -29,6 +29,7 @@ namespace Force {
   struct ConstraintTwoResult;
   class IndexMaskOperator;
   struct PageAlignTraits;
+  struct MemoryUsage;
 
   /*!
     \class Constraint
@@ -214,9 +215,11 @@ namespace Force {
     void Clear(); //!< Clear the ConstraintSet, make it empty.
     uint64 Size() const { return mSize; } //!< Return the constraint set size.
     uint32 VectorSize() const { return mConstraints.size(); } //!< Return the Constraint object vector size.
+    void AccountMemory(MemoryUsage& rUsage) const; //!< Add the estimated memory held by the ConstraintSet.
     uint64 LowerBound() const; //!< Return lower bound of the ConstraintSet, call with care, ensure the set is not empty.
     uint64 UpperBound() const; //!< Return upper bound of the ConstraintSet, call with care, ensure the set is not empty.
     uint64 ChooseValue() const; //!< Choose a value from the ConstraintSet.
+    void ChooseValues(uint64 count, uint64 align, bool unique, std::vector<uint64>& rValues) const; //!< Choose count align-aligned values from the ConstraintSet, optionally without repetition.
     bool Intersects(const ConstraintSet& rConstrSet) const; //!< Check if the two ConstraintSet intersects each other.
     void AddRange(uint64 lower, uint64 upper); //!< Add a value range to the constraint set.
     void AddValue(uint64 value); //!< Add a single value to the constraint set.
@@ -232,6 +235,7 @@ namespace Force {
     bool ContainsRange(uint64 lower, uint64 upper) const; //!< Check if a range is part of the ConstraintSet.
     bool ContainsConstraint(const Constraint& constr) const; //!< Check if a Constraint is part of the ConstraintSet.
     bool ContainsConstraintSet(const ConstraintSet& rConstrSet) const; //!< Check if a ConstraintSet is contained by this ConstraintSet.
+    const Constraint* ContainingConstraint(uint64 lower, uint64 upper) const; //!< Return the Constraint containing the whole range, or nullptr if no single Constraint contains it.
     void ShiftRight(uint32 shiftAmount); //!< Shift the ConstraintSet object to the right by shiftAmount.
     void AlignWithSize(uint64 alignMask, uint64 alignSize); //!< Align Constraint object considering required size.
     void AlignOffsetWithSize(uint64 alignMask, uint64 alignOffset, uint64 alignSize); //!< Align Constraint boundaries to the specified offset from zero while considering required size.
@@ -16,6 +16,8 @@
 #ifndef Force_GenInstructionAgent_H
 #define Force_GenInstructionAgent_H
 
+#include <map>
+#include <string>
 #include <vector>
 
 #include "Defines.h"
@@ -27,11 +29,14 @@ namespace Force {
 
   class GenInstructionRequest;
   class Instruction;
+  class InstructionStructure;
+  class NativeExecutor;
   class SimAPI;
   class Register;
   class ReadOnlyRegister;
   class ReadOnlyRegisterField;
   class BntNode;
+  class VmMapper;
   struct RegUpdate;
   struct MemUpdate;
   struct ExceptionUpdate;
@@ -42,7 +47,7 @@ namespace Force {
   */
   class GenInstructionAgent : public GenAgent, public NotificationSender, public NotificationReceiver {
   public:
-    GenInstructionAgent() : GenAgent(), Receiver(), mInstrSimulated(0), mpInstructionRequest(nullptr), mRegisterInitializations() { } //!< Constructor.
+    GenInstructionAgent() : GenAgent(), Receiver(), mInstrSimulated(0), mpInstructionRequest(nullptr), mRegisterInitializations(), mSimplePrototypes(), mpNativeExecutor(nullptr), mNativeExecutionCheck(false), mNativeInstructions(0), mNativeNextPC(0), mNativeRegisters(), mNativeFetchPage(MAX_UINT64), mpNativeFetchMapper(nullptr) { } //!< Constructor.
     ~GenInstructionAgent(); //!< Destructor.
     ASSIGNMENT_OPERATOR_ABSENT(GenInstructionAgent);
 
@@ -51,30 +56,35 @@ namespace Force {
 
     EGenAgentType GenAgentType() const override { return EGenAgentType::GenInstructionAgent; } //!< Return type of the generator agent.
     void SetGenRequest(GenRequest* genRequest) override; //!< Set pointer to GenRequest object.
-    void StepInstruction(const Instruction* pInstr); //!< Step commited instruction.
+    void StepInstruction(const Instruction* pInstr, bool allowNative = true); //!< Step commited instruction, on the ISS only if allowNative is false.
     void ExecuteHandler(); //!< Step through exception handler.
     void ExceptionReturn(); //!< Handle exception return.
     void ReExecute(cuint64 addr, cuint32 maxReExeInstr); //!< Handles re-execution.
     void HandleNotification(const NotificationSender* sender, ENotificationType eventType, Object* payload) override; //!< Handle a notification.
     void InitializeReadOnlyRegistersWithISS(const std::vector<ReadOnlyRegister* >& rRegs); //!< Initialize readonly register by reading values from ISS.
     void ResetReadOnlyRegisterFieldsWithISS(const std::vector<ReadOnlyRegisterField* >& rRegFields); //!< initialize readonly register fields by reading values from ISS
+    void SetupNativeExecution(); //!< Set up generator side execution of simple integer instructions according to the NativeExecution and NativeExecutionCheck options.
+    void SyncNativeExecution(); //!< Bring the ISS up to date with the instructions executed on the generator side since the last sync.
   protected:
     GenInstructionAgent(const GenInstructionAgent& rOther); //!< Copy constructor.
     void HandleRequest() override; //!< Handle GenRequest transaction.
     void StepInstructionNoSimulation(const Instruction* pInstr); //!< Step commited instruction with no ISS.
     bool StepInstructionWithSimulation(const Instruction* pInstr=nullptr); //!< simulate generated instruction with ISS, return true if there is an event.
     void UpdateRegisterFromSimulation(const std::vector<RegUpdate>& regUpdates, bool hasExceptEvent, uint64& targetPC); //!< update register from iss updates.
+    void UpdateNativeFetchPage(cuint64 fetchPC, bool hasExceptEvent, const std::vector<RegUpdate>& rRegUpdates); //!< Update the page natively executed instructions can be fetched from after an ISS step of the instruction at fetchPC.
     void UpdateMemoryFromSimulation(const std::vector<MemUpdate>& memUpdates); //!< update memory from iss updates.
     void SendInitsToISS(); //!< Send initializations to ISS before stepping.
     void ReleaseInits(); //!< Release initializations when ISS is not available.
     bool HasExceptionEvent(const std::vector<ExceptionUpdate> & rExcepEvents, bool& hasEretEvent) const; //!< Check if there is exception event, return true if there is an event.
     bool UpdateExceptionEvent(std::vector<ExceptionUpdate> & rExcepEvents); //!< Update exception event.
     void UpdateInstructionCount(); //!< Update simulated instruction count.
+    void RecordSegmentJournalUpdates(const std::vector<RegUpdate>& rRegUpdates, const std::vector<MemUpdate>& rMemUpdates); //!< Record the state changes of ISS steps in the segment journal, if recording one.
     void UpdateAccurateBnt(const Instruction* pInstr, uint64 targetPC = 0); //!< Update BNT information when branch direction is accurate.
     virtual bool IsLowPower(uint32 exceptionId) const { return false; } //!< whether the exception is low power
     virtual bool IsSimExit(uint32 exceptionId) const { return false; } //!< whether the exception is sim exit
     virtual bool IsEret(uint32 exceptionId) const { return false; } //!< whether the exception is eret
     void SkipRequest(Instruction* pInstr); //!< skip request and delete resource
+    const Instruction* SimpleInstructionPrototype(const InstructionStructure* pInstrStruct); //!< Return the initialized prototype of a simple instruction, nullptr if the instruction is not simple.
 
     void RecoverExceptionBeforeUpdate(const std::vector<ExceptionUpdate>& exceptUpdates, const std::vector<RegUpdate>& regUpdates, SimAPI* pSimAPI); //!< Recover exception
     void SaveRegisterBeforeUpdate(const std::vector<RegUpdate>& regUpdates, BntNode* pBntNode); //!< Save register states before update.
@@ -82,10 +92,21 @@ namespace Force {
     void SaveMemoryBeforeUpdate(const std::vector<MemUpdate>& memUpdates, BntNode* pBntNode); //!< Save memory states before update.
     void SaveLoopMemoryBeforeUpdate(const std::vector<MemUpdate>& memUpdates); //!< Save loop memory states before update.
     void UpdateUnpredictedConstraint(const Instruction* pInstr); //!< Does some uppredicted constraint on operand registers
+    bool NativeExecutionAllowed(const Instruction* pInstr) const; //!< Return whether the generator state allows executing the instruction on the generator side.
+    bool ExecuteNatively(const Instruction* pInstr); //!< Execute the instruction on the generator side, deferring the ISS update, return false if the instruction has to be stepped on the ISS.
+    void CheckNativeExecution(const Instruction* pInstr, const std::string& rDestRegName, uint64 destValue, uint64 nextPC, const std::vector<RegUpdate>& rRegUpdates) const; //!< Fail if the ISS register updates of a step differ from the natively computed result.
   protected:
     uint64 mInstrSimulated; //!< Number of instructions simulated.
     GenInstructionRequest* mpInstructionRequest; //!< Pointer to GenInstructionRequest object.
     std::vector<Register* > mRegisterInitializations; //!< Vector of initialized registers.
+    std::map<const InstructionStructure*, Instruction* > mSimplePrototypes; //!< Prototypes of simple instructions, nullptr for instructions detected as not simple.
+    NativeExecutor* mpNativeExecutor; //!< Pointer to the native executor, nullptr if native execution is disabled.
+    bool mNativeExecutionCheck; //!< Whether to step the ISS anyway and check the natively computed results against it.
+    uint64 mNativeInstructions; //!< Number of natively executed instructions not yet synced to the ISS.
+    uint64 mNativeNextPC; //!< PC following the last natively executed instruction.
+    std::vector<std::string> mNativeRegisters; //!< Names of the registers written by natively executed instructions not yet synced to the ISS.
+    uint64 mNativeFetchPage; //!< Virtual page the ISS last fetched an instruction from without an exception, MAX_UINT64 if none since the fetch permissions may have changed.
+    const VmMapper* mpNativeFetchMapper; //!< VM mapper that was current when the ISS fetched from the native fetch page.
   private:
     void InitializeLoopMemory(cuint64 startVa, cuint64 memRangeSize) const; //!< Initialize any uninitialized memory that will be recorded by a restore loop.
  };
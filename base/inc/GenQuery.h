@@ -54,6 +54,7 @@ namespace Force {
     const std::string& PrimaryString() const { return mPrimaryString; } //!< Return the primary string for the query.
     virtual void AddDetail(const std::string& attrName, uint64 value) {} //!< Add query detail, with integer value parameter.
     virtual void AddDetail(const std::string& attrName, const std::string& valueStr) {} //!< Add query detail, with value string parameter.
+    virtual void AddDetail(const std::string& attrName, const ConstraintSet& rConstrSet); //!< Add query detail, with constraint set parameter.
     virtual std::string ToString() const; //!< Return details of the GenQuery object.
     virtual void GetResults(py::object& rPyObject) const = 0; //!< Return query results in the passed in rPyObject.
 
@@ -53,6 +53,7 @@ namespace Force {
     virtual void SetPrimaryString(const std::string& valueStr) {} //!< Set primary string.
     virtual void AddDetail(const std::string& attrName, uint64 value) {} //!< Add request detail, with integer value parameter.
     virtual void AddDetail(const std::string& attrName, const std::string& valueStr); //!< Add request detail, with value string parameter.
+    virtual void AddDetail(const std::string& attrName, const ConstraintSet& rConstrSet); //!< Add request detail, with constraint set parameter.
     virtual const std::string ToString() const; //!< Return a string describing the current state of the GenRequest object.
     virtual bool AddingInstruction() const { return false; } //!< Indicates whether the GenRequest will result in adding instruction to the instruction stream, return false by default.
     virtual bool DelayHandle() const { return true; } //!< Indicates whether the GenRequest can be insert by other request, return true by default.
@@ -93,6 +94,7 @@ namespace Force {
     const std::string& InstructionId() const { return mInstructionId; } //!< Return instruction ID.
     void AddOperandRequest(const std::string& oprName, uint64 value); //!< Add individual operand request, with integer value parameter.
     void AddOperandRequest(const std::string& oprName, const std::string& valueStr); //!< Add individual operand request, with value string parameter.
+    void AddOperandRequest(const std::string& oprName, const ConstraintSet& rConstrSet); //!< Add individual operand request, with constraint set parameter.
     void AddOperandDataRequest(const std::string& oprName, const std::string& valueStr) const; //!< Add individual operand data request, with value string parameter.
     void AddLSDataRequest(const std::string& valueStr); //!< Add LSData request with value string parameter.
     void AddLSTargetListRequest(const std::string& valueStr); //!< Add LSTargets request with value string parameter.
@@ -101,6 +103,7 @@ namespace Force {
     void SetOperandDataRequest(const std::string& oprName, std::vector<uint64> values, uint32 size) const; //!< For LargeRegister(Z),add individual operand data request, with values parameter.
     void AddDetail(const std::string& attrName, uint64 value) override; //!< Add request detail, with integer value parameter.
     void AddDetail(const std::string& attrName, const std::string& valueStr) override; //!< Add request detail, with value string parameter.
+    void AddDetail(const std::string& attrName, const ConstraintSet& rConstrSet) override; //!< Add request detail, with constraint set parameter.
     bool AddingInstruction() const override { return true; } //!< Indicates GenInstructionRequest will add instruction to the instruction stream.
 
     const OperandRequest* FindOperandRequest(const std::string& opName) const; //!< Find OperandRequest for the operand with the given name, if any.
@@ -629,6 +632,7 @@ namespace Force {
 
     void AddDetail(const std::string& attrName, uint64 value) override; //!< Add request detail, with integer value parameter.
     void AddDetail(const std::string& attrName, const std::string& valueStr) override; //!< Add request detail, with value string parameter.
+    void AddDetail(const std::string& attrName, const ConstraintSet& rConstrSet) override; //!< Add request detail, with constraint set parameter.
 
     EVmRequestType VmRequestType() const { return mVmRequestType; } //!< Return sequence type.
     EMemDataType DataType() const { return mDataType; } //!< Return data type of the request.
@@ -50,7 +50,7 @@ namespace Force {
     void GenPA(); //!< Generate a valid physical address.
     void GenVAforPA(); //!< Generate a valid virtual address that translates to the given physical address.
     void GenFreePageRanges(); //!< Generate free page ranges
-    virtual void GenVmContext() { }; //!< Generate a VmContext.
+    virtual void GenVmContext(); //!< Generate a VmContext.
     void UpdateVm(); //!<  Handle Activate VM request.
     void GetPhysicalRegion(); //!< Request a physicl region.
     void HandlerMemory(); //!< Allocate handler memory.
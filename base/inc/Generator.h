@@ -68,6 +68,7 @@ namespace Force {
   class BntNodeManager;
   class AddressTableManager;
   class SimAPI;
+  class SegmentJournal;
 
   /*!
     \class Generator
@@ -107,7 +108,6 @@ namespace Force {
     GenPC* GetGenPC() const { return mpGenPC; } //!< Return pointer to GenPC object.
     ReExecutionManager* GetReExecutionManager() const { return mpReExecutionManager; } //!< Return pointer to ReExecutionManager object.
     ResourceDependence* GetDependenceInstance() const { return mpDependence; } //!< Return pointer to ResourceInterDependence object.
-    void SetDependenceInstance(ResourceDependence* pDependence); //!< Set dependence instance.
     const PageRequestRegulator* GetPageRequestRegulator() const { return mpPageRequestRegulator; } //!< Return pointer to PageRequestRegulator object.
     const AddressFilteringRegulator* GetAddressFilteringRegulator() const { return mpAddressFilteringRegulator; } //!< Return pointer to AddressFilteringRegulator object.
     bool IsReturningToUser(PaTuple &returnAddress); //!< Returns true if the target of the current ERET is user code.
@@ -195,6 +195,7 @@ namespace Force {
     void ExecuteHandler(); //!< Excecute exception handler.
     void SleepOnLowPower(); //!< Sleep on low power status
     void ExceptionReturn(); //!< Handle exception return.
+    void SyncNativeExecution(); //!< Bring the ISS up to date with natively executed instructions.
     void ReExecute(cuint64 addr, cuint32 maxReExeInstr); //!< Handle re-execution request.
 
     // Forwarded Register related APIs
@@ -229,6 +230,9 @@ namespace Force {
     BntNodeManager* GetBntNodeManager() const { return mpBntNodeManager; } //!< Get Bnt node manager.
     AddressTableManager* GetAddressTableManager() const { return mpAddressTableManager; } //!< Return pointer to AddressTableManager object.
     SimAPI* GetSimAPI() const { return mpSimAPI; } //!< Return a pointer to the SimAPI object.
+    SegmentJournal* GetSegmentJournal() const { return mpSegmentJournal; } //!< Return the journal recording an independent segment, nullptr if not recording.
+    void StartSegmentJournal(); //!< Start recording what is added to the test in a journal, for an independent segment.
+    void FinishSegmentJournal(const std::string& rFilePath); //!< Write the segment journal with the current PC as the segment end and stop recording.
 
     void OutputImage(ImageIO* imageIO) const; //!< Output image in text format.
     void SolveAddressShortage(); //!< Handle Address shortage.
@@ -275,6 +279,7 @@ namespace Force {
     BntHookManager* mpBntHookManager; //!< Pointer to the BntHookManager object for this GenThread.
     BntNodeManager* mpBntNodeManager; //!< Pointer to BntNodeManager object
     AddressTableManager* mpAddressTableManager; //!< Pointer to AddressTableManager object.
+    SegmentJournal* mpSegmentJournal; //!< Pointer to the journal recording an independent segment, nullptr if not recording.
     std::vector<GenAgent* > mAgents; //!< Various agent class to delegate generator functions.
     std::map<EGenStateType, uint64> mGenStateValues; //!< Value type generator states.
     std::map<EGenStateType, std::string> mGenStateStrings; //!< String type generator states.
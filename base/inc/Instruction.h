@@ -34,6 +34,7 @@ namespace Force {
   class ConstraintSet;
   class BntNode;
   class ResourceAccessStage;
+  struct MemoryUsage;
 
   /*!
     \class Instruction
@@ -112,6 +113,7 @@ namespace Force {
     //\ section - instruction record
     EInstructionGroupType Group() const;
     const std::vector<Operand* > GetOperands() const { return mOperands; }
+    void AccountMemory(MemoryUsage& rUsage) const; //!< Add the estimated memory held by the instruction and its operands.
     const std::vector<ConstraintSet* >& LoadStoreGatherScatterTargetListConstraints() const;  //!< Return the targetlist constraint if available.
   protected:
     Instruction(const Instruction& rOther); //!< Copy constructor.
@@ -17,9 +17,11 @@
 #define Force_InstructionResults_H
 
 #include <map>
+#include <string>
 #include <vector>
 
 #include "Defines.h"
+#include "MemoryAccounting.h"
 #include "Object.h"
 
 namespace Force {
@@ -29,8 +31,8 @@ namespace Force {
 
   class InstructionResultsBank : public Object  {
   public:
-    explicit InstructionResultsBank(uint32 bank) : Object(), mBank(bank), mResults() {} //!< Constructor with bank ID given.
-    InstructionResultsBank() : Object(), mBank(0), mResults() {} //!< Default constructor.
+    explicit InstructionResultsBank(uint32 bank) : Object(), mBank(bank), mResults(), mImportedResults() {} //!< Constructor with bank ID given.
+    InstructionResultsBank() : Object(), mBank(0), mResults(), mImportedResults() {} //!< Default constructor.
     Object* Clone() const override;  //!< Return a cloned InstructionResultsBank object of the same type
     const std::string ToString() const override; //!< Return a string describing the current state of the InstructionResultsBank object.
     const char* Type() const override { return "InstructionResultsBank"; } //!< Return a string describing the actual type of the InstructionResultsBank object
@@ -40,12 +42,15 @@ namespace Force {
     const Instruction* LookupInstruction(uint64 address) const; //!< Look up instruction by its program address.
     void AddInstruction(uint64 pa, Instruction* instr); //!< Add an instruction.
     const std::map<uint64, Instruction* >& GetInstructions() const { return mResults; } //!< Return instruction results in the memory bank.
+    void ImportInstruction(uint64 pa, uint32 opcode, const std::string& rAsmText); //!< Add an instruction generated by another generator instance.
+    const std::map<uint64, std::pair<uint32, std::string> >& GetImportedInstructions() const { return mImportedResults; } //!< Return opcodes and assembly text of the imported instructions in the memory bank.
     uint32 GetInstructionCount() const; //!< Return number of instructions.
   protected:
     InstructionResultsBank(const InstructionResultsBank& rOther); //!< Copy constructor.
   private:
     uint32 mBank; //!< Memory bank ID.
     std::map<uint64, Instruction* > mResults; //!< Container of all generated instructions in a memory bank.
+    std::map<uint64, std::pair<uint32, std::string> > mImportedResults; //!< Opcodes and assembly text of the instructions imported from other generator instances.
   };
 
   /*!
@@ -65,12 +70,15 @@ namespace Force {
     void GenSummary(); // !< Generate the Instruction summary
     const Instruction* LookupInstruction(uint32 bank, uint64 address) const; //!< Look up instruction by its physical address.
     const std::map<uint64, Instruction* >& GetInstructions(uint32 bank) const; //!< Return instruction results in a memory bank.
+    void ImportInstruction(uint32 bank, uint64 pa, uint32 opcode, const std::string& rAsmText); //!< Add an instruction generated by another generator instance.
+    const std::map<uint64, std::pair<uint32, std::string> >& GetImportedInstructions(uint32 bank) const; //!< Return opcodes and assembly text of the imported instructions in a memory bank.
     uint32 GetInstructionCount(cuint32 bank) const; //!< Return number of instructions for the specified bank.
     uint32 GetBankCount() const; //!< Return number of instruction results banks.
     void InvalidCurrentBankAddress(); //!< Invalidate current bank and address.
     void GetCurrentInstructionRecordId (std::string& rec_id); //!< Return current isntruction record id
+    void AccountMemory(MemoryUsage& rUsage) const; //!< Add the estimated memory held by the committed instructions.
   protected:
-    ThreadInstructionResults() : Object(), mBanks(), mCurBank(0), mCurAddr(0), mCurAddrValid(false), mRecordId() { } //!< Default constructor.
+    ThreadInstructionResults() : Object(), mBanks(), mCurBank(0), mCurAddr(0), mCurAddrValid(false), mRecordId(), mInstructionUsage() { } //!< Default constructor.
     ThreadInstructionResults(const ThreadInstructionResults& rOther); //!< Copy constructor.
     void AddInstruction(uint32 bank, uint64 pa, Instruction* instr); //!< Add an instruction.
   private:
@@ -79,6 +87,7 @@ namespace Force {
     uint64 mCurAddr; //!< Current instruction address
     bool mCurAddrValid; //!< Flag indicating whether the current instruction address value is valid
     std::string mRecordId; //!< current record id
+    MemoryUsage mInstructionUsage; //!< Estimated memory held by the committed instruction objects, accumulated as they are added while the memory report is enabled.
   };
 
   /*!
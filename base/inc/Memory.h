@@ -28,6 +28,7 @@ namespace Force {
 
   class MemoryBytes;
   struct MetaAccess;
+  struct MemoryUsage;
 
   /*!
     \class Section
@@ -62,6 +63,7 @@ namespace Force {
     void Dump(std::ostream& out_str) const;                  //!< dump memory model for debug
     void Dump (std::ostream& out_str, uint64 address, uint64 nBytes) const; //!< dump memory range
     void GetSections(std::vector<Section>& rSections) const;    //!< Get sections the memory object contained, by address ascending order
+    void AccountMemory(MemoryUsage& rUsage) const; //!< Add the estimated memory held by the memory content.
 
     explicit Memory(EMemBankType bankType) : mBankType(bankType), mContent() { }  //!< Constructor.
     ~Memory(); //!< Destructor.
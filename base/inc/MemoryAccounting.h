@@ -0,0 +1,104 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef Force_MemoryAccounting_H
+#define Force_MemoryAccounting_H
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Defines.h"
+
+namespace Force {
+
+  /*!
+    \struct MemoryUsage
+    \brief Estimated live bytes and object count of a generator subsystem.
+  */
+  struct MemoryUsage {
+    MemoryUsage() : mBytes(0), mObjects(0) { } //!< Default constructor.
+
+    void Add(uint64 bytes, uint64 objects) { mBytes += bytes; mObjects += objects; } //!< Add bytes and objects to the usage.
+    void Add(const MemoryUsage& rOther) { Add(rOther.mBytes, rOther.mObjects); } //!< Add another usage to the usage.
+
+    uint64 mBytes; //!< Estimated live bytes.
+    uint64 mObjects; //!< Number of live objects.
+  };
+
+  const uint64 MAP_NODE_OVERHEAD = 32; //!< Bytes of tree node bookkeeping per std::map element.
+
+  /*!
+    Return the estimated heap bytes held by the nodes of a std::map, not counting objects the mapped values point to.
+   */
+  template <typename MapType>
+  inline uint64 map_memory_bytes(const MapType& rMap)
+  {
+    return rMap.size() * (sizeof(typename MapType::value_type) + MAP_NODE_OVERHEAD);
+  }
+
+  /*!
+    Return the heap bytes held by the buffer of a std::vector, not counting objects the elements point to.
+   */
+  template <typename T>
+  inline uint64 vector_memory_bytes(const std::vector<T>& rVector)
+  {
+    return rVector.capacity() * sizeof(T);
+  }
+
+  /*!
+    \class MemoryAccounting
+    \brief Write estimated memory usage of the major generator subsystems to a CSV report.
+
+    The report is enabled by the MemoryReportInterval option. A snapshot is written every MemoryReportInterval instructions
+    committed by all harts together, and at test end; an interval of 0 gives the test end snapshot only. Each row is
+    "Event, Instructions, Hart, Subsystem, Bytes, Objects", with Hart being "shared" for the subsystems of the memory banks.
+    The estimates are computed from container sizes and object sizes, so they are cheap enough to leave on.
+  */
+  class MemoryAccounting {
+  public:
+    static void Initialize(); //!< Initialize memory accounting.
+    static void Destroy(); //!< Clean up memory accounting.
+    static MemoryAccounting* Instance() { return mspMemoryAccounting; } //!< Access memory accounting instance.
+
+    inline bool Enabled() const { return mEnabled; } //!< Return whether the memory report is enabled.
+    inline void InstructionCommitted() //!< Count a committed instruction, writing a snapshot at each interval.
+    {
+      if (mEnabled and (++mInstructionCount == mNextReport)) {
+        Report("interval");
+        mNextReport += mInterval;
+      }
+    }
+    void ReportTestEnd(); //!< Write the test end snapshot.
+
+    COPY_CONSTRUCTOR_ABSENT(MemoryAccounting);
+    ASSIGNMENT_OPERATOR_ABSENT(MemoryAccounting);
+  private:
+    MemoryAccounting(); //!< Default constructor.
+    ~MemoryAccounting(); //!< Destructor.
+    void Report(const std::string& rEvent); //!< Write a snapshot of all subsystems.
+    void WriteRow(const std::string& rEvent, const std::string& rHart, const std::string& rSubsystem, const MemoryUsage& rUsage); //!< Write one report row.
+  private:
+    static MemoryAccounting* mspMemoryAccounting; //!< Static pointer to memory accounting instance.
+    bool mEnabled; //!< Whether the memory report is enabled.
+    uint64 mInterval; //!< Number of committed instructions between snapshots, 0 for test end only.
+    uint64 mInstructionCount; //!< Number of instructions committed by all harts.
+    uint64 mNextReport; //!< Instruction count of the next interval snapshot.
+    std::ofstream mReportFile; //!< Report output stream.
+  };
+
+}
+
+#endif
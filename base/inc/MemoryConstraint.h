@@ -26,6 +26,7 @@
 namespace Force {
 
   class ConstraintSet;
+  struct MemoryUsage;
 
   /*!
     \class LargeConstraintSet
@@ -44,6 +45,7 @@ namespace Force {
     void SubRange(uint64 lower, uint64 upper); //!< Subtract a value range from the LargeConstraintSet.
     void MergeConstraintSet(const ConstraintSet& rConstrSet); //!< Merge a ConstraintSet object.
     void SubConstraintSet(const ConstraintSet& rConstrSet); //!< Subtract a ConstraintSet from the LargeConstraintSet.
+    void AccountMemory(MemoryUsage& rUsage) const; //!< Add the estimated memory held by the main and cached ConstraintSets.
 
     ASSIGNMENT_OPERATOR_ABSENT(LargeConstraintSet);
   private:
@@ -64,6 +66,39 @@ namespace Force {
     ELargeConstraintSetStateBaseType mState; //!< Update state of the LargeConstraintSet object.
   };
 
+  /*!
+    \class DataAccessStates
+    \brief Shared, last-read and last-written states of data addresses for one thread, kept as an ordered map of disjoint address ranges.
+
+    Addresses without an entry have no state.  Adjacent ranges with the same states are coalesced so the map stays small.
+  */
+  class DataAccessStates {
+  public:
+    DataAccessStates() : mStateRanges() { } //!< Default constructor.
+    COPY_CONSTRUCTOR_DEFAULT(DataAccessStates);
+    DESTRUCTOR_DEFAULT(DataAccessStates);
+    ASSIGNMENT_OPERATOR_ABSENT(DataAccessStates);
+
+    void Clear() { mStateRanges.clear(); } //!< Clear all states.
+    void UpdateStates(uint64 lower, uint64 upper, uint32 setStates, uint32 clearStates); //!< Clear and then set the specified states for an address range.
+    void AccountMemory(MemoryUsage& rUsage) const; //!< Add the estimated memory held by the state ranges.
+    void GetMatching(const ConstraintSet& rConstrSet, uint32 states, ConstraintSet& rMatchingConstr) const; //!< Add the parts of the ConstraintSet with any of the specified states to rMatchingConstr.
+  public:
+    static constexpr uint32 smShared = 0x1; //!< Address is shared.
+    static constexpr uint32 smLastRead = 0x2; //!< Address was last accessed by a data read.
+    static constexpr uint32 smLastWritten = 0x4; //!< Address was last accessed by a data write.
+  private:
+    void SplitAt(uint64 address); //!< Split the range containing the address, if any, so that a range starts at the address.
+    void Coalesce(uint64 lower, uint64 upper); //!< Coalesce adjacent ranges with equal states from the range containing lower through the range following upper.
+  private:
+    struct StateRange {
+      uint64 mUpper; //!< Upper bound of the address range.
+      uint32 mStates; //!< States of the addresses in the range.
+    };
+
+    std::map<uint64, StateRange> mStateRanges; //!< State ranges keyed by lower bound.
+  };
+
   class AddressReuseMode;
 
   /*!
@@ -92,20 +127,28 @@ namespace Force {
     void UnmarkUsed(cuint64 startAddress, cuint64 endAddress); //!< Mark the addresses specified by the constraint set as unused for all memory and access types.
     void UnmarkUsed(const ConstraintSet& constrSet); //!< Mark the addresses specified by the constraint set as unused for all memory and access types.
     inline const ConstraintSet* Usable() const { return mpUsable->GetConstraintSet(); } //!< Return the most restrictive usable memory constraint.
+    bool UsableContainsRange(uint64 lower, uint64 upper) const; //!< Return true if a single usable range contains the whole address range, checking the cached usable window first.
     const ConstraintSet* Shared() const { return mpShared->GetConstraintSet(); } //!< Return the shared memory constraint.
     void ApplyToConstraintSet(const EMemDataType memDataType, const EMemAccessType memAccessType, cuint32 threadId, const AddressReuseMode& rAddrReuseMode, ConstraintSet* constrSet) const; //!< Apply the appropriate constraints to the specified constraint set.
     void ReplaceUsableInRange(uint64 lower, uint64 upper, ConstraintSet& rReplaceConstr); //!< Replace the range with translated new ranges.
+    virtual void AccountMemory(MemoryUsage& rUsage) const; //!< Add the estimated memory held by the memory constraints.
   protected:
     virtual void MarkDataUsedForType(cuint64 startAddress, cuint64 endAddress, const EMemAccessType memAccessType, cuint32 threadId) = 0; //!< Mark a data address range as used for a given access type.
-    virtual const ConstraintSet* DataReadUsed(cuint32 threadId) const = 0; //!< Return used addresses for data reads.
-    virtual const ConstraintSet* DataWriteUsed(cuint32 threadId) const = 0; //!< Return used addresses for data writes.
+    virtual void MarkDataShared(cuint64 startAddress, cuint64 endAddress) = 0; //!< Mark a data address range as shared for all threads.
+    virtual const DataAccessStates* GetDataAccessStates(cuint32 threadId) const = 0; //!< Return data access states for a thread.
+    static void UpdateDataAccessStates(cuint64 startAddress, cuint64 endAddress, const EMemAccessType memAccessType, DataAccessStates* pDataStates); //!< Update the last-read/last-written states of a data address range for a given access type.
   private:
     void ApplyToDataConstraintSet(const EMemAccessType memAccessType, cuint32 threadId, const AddressReuseMode& rAddrReuseMode, ConstraintSet* constrSet) const; //!< Apply the appropriate constraints to the specified data address constraint set.
     void ApplyToNonDataConstraintSet(ConstraintSet* constrSet) const; //!< Apply the appropriate constraints to the specified non-data address constraint set.
+    void TrimUsableWindow(uint64 lower, uint64 upper); //!< Shrink the usable window so it excludes an address range no longer usable.
+    void TrimUsableWindow(const ConstraintSet& rConstrSet); //!< Shrink the usable window so it excludes the addresses of a ConstraintSet no longer usable.
   private:
     LargeConstraintSet* mpUsable; //!< General usable memory constraint.
     LargeConstraintSet* mpShared; //!< Shared addresses.
     bool mInitialized; //!< Indicates whether MemoryConstraint is initialized.
+    mutable uint64 mUsableWindowLower; //!< Lower bound of the usable window, the last found part of a usable range.
+    mutable uint64 mUsableWindowUpper; //!< Upper bound of the usable window.
+    mutable bool mUsableWindowValid; //!< Indicates whether the usable window holds usable addresses.
   };
 
   /*!
@@ -123,14 +166,14 @@ namespace Force {
     const char* Type() const override { return "SingleThreadMemoryConstraint"; } //!< Return a string describing the actual type of the Object.
 
     void Uninitialize() override; //!< Clear constraints and set to uninitialized state.
+    void AccountMemory(MemoryUsage& rUsage) const override; //!< Add the estimated memory held by the memory constraints.
   protected:
     void MarkDataUsedForType(cuint64 startAddress, cuint64 endAddress, const EMemAccessType memAccessType, cuint32 threadId) override; //!< Mark a data address range as used for a given access type.
-    const ConstraintSet* DataReadUsed(cuint32 threadId) const override; //!< Return used addresses for data reads.
-    const ConstraintSet* DataWriteUsed(cuint32 threadId) const override; //!< Return used addresses for data writes.
+    void MarkDataShared(cuint64 startAddress, cuint64 endAddress) override; //!< Mark a data address range as shared for all threads.
+    const DataAccessStates* GetDataAccessStates(cuint32 threadId) const override; //!< Return data access states for a thread.
   private:
     cuint32 mThreadId; //!< Thread ID associated with the memory constraints.
-    LargeConstraintSet* mpDataReadUsed; //!< Used addresses for data reads.
-    LargeConstraintSet* mpDataWriteUsed; //!< Used addresses for data writes.
+    DataAccessStates mDataStates; //!< Data access states.
   };
 
   /*!
@@ -148,13 +191,13 @@ namespace Force {
     const char* Type() const override { return "MultiThreadMemoryConstraint"; } //!< Return a string describing the actual type of the Object.
 
     void Uninitialize() override; //!< Clear constraints and set to uninitialized state.
+    void AccountMemory(MemoryUsage& rUsage) const override; //!< Add the estimated memory held by the memory constraints.
   protected:
     void MarkDataUsedForType(cuint64 startAddress, cuint64 endAddress, const EMemAccessType memAccessType, cuint32 threadId) override; //!< Mark a data address range as used for a given access type.
-    const ConstraintSet* DataReadUsed(cuint32 threadId) const override; //!< Return used addresses for data reads.
-    const ConstraintSet* DataWriteUsed(cuint32 threadId) const override; //!< Return used addresses for data writes.
+    void MarkDataShared(cuint64 startAddress, cuint64 endAddress) override; //!< Mark a data address range as shared for all threads.
+    const DataAccessStates* GetDataAccessStates(cuint32 threadId) const override; //!< Return data access states for a thread.
   private:
-    std::map<cuint32, LargeConstraintSet*> mDataReadUsedByThread; //!< Used addresses for data reads by thread ID.
-    std::map<cuint32, LargeConstraintSet*> mDataWriteUsedByThread; //!< Used addresses for data writes by thread ID.
+    std::map<cuint32, DataAccessStates> mDataStatesByThread; //!< Data access states by thread ID.
   };
 
 }
@@ -38,11 +38,13 @@ namespace Force {
   class MemoryReservation;
   class PhysicalRegion;
   class PaTuple;
+  class SegmentJournal;
   class PagingChoicesAdapter;
   class MemoryConstraint;
   class AddressReuseMode;
   class SymbolManager;
   class MemoryTraitsManager;
+  struct MemoryUsage;
 
   /*!
     \class MemoryBank
@@ -70,6 +72,7 @@ namespace Force {
     uint8 GetByteMemoryAttributes(cuint64 address) const; //!< Get memory attributes of the byte at the specified address.
     const ConstraintSet* Free() const { return mpFree; } //!< Return const pointer to free ConstraintSet.
     const ConstraintSet* Usable() const; //!< Return const pointer to usable ConstraintSet.
+    bool UsableContainsRange(uint64 lower, uint64 upper) const; //!< Return true if a single usable range contains the whole address range.
     const ConstraintSet* Shared() const; //!< Return const pointer to shared ConstraintSet.
     const ConstraintSet* Unmapped() const; //!< Return const pointer to ConstraintSet of unmapped addresses.
     void ApplyUsableConstraint(const EMemDataType memDataType, const EMemAccessType memAccessType, cuint32 threadId, const AddressReuseMode& rAddrReuseMode, ConstraintSet* constrSet) const; //!< Apply usable constraint to specified constraint.
@@ -81,6 +84,7 @@ namespace Force {
     PageTableManager* GetPageTableManager() const { return mpPageTableManager; } //!< Return the page table manager.
     SymbolManager* GetSymbolManager() const { return mpSymbolManager; } //!< Return the symbol manager.
     MemoryTraitsManager* GetMemoryTraitsManager() const { return mpMemTraitsManager; } //!< Return the memory traits manager.
+    void AccountConstraintMemory(MemoryUsage& rUsage) const; //!< Add the estimated memory held by the base, free and usable memory constraints.
   private:
     Memory* mpMemory; //!< Pointer to memory object.
     ConstraintSet* mpBaseConstraint; //!< Pointer to base memory constraint.
@@ -143,9 +147,12 @@ namespace Force {
     bool PaInitialized(const PaTuple& rPaTuple, cuint32 size) const; //!< Check if the memory from target PA through target PA + size - 1 is initialized.
     bool InstructionPaInitialized(const PaTuple& rPaTuple) const; //!< Check if the instruction-sized block of memory starting at the target PA is initialized.
     void OutputImage() const; //!< Output image in text format.
+    void SetSegmentJournal(SegmentJournal* pSegmentJournal) { mpSegmentJournal = pSegmentJournal; } //!< Set the journal recording memory initializations, nullptr to stop recording.
   private:
     MemoryManager();  //!< Constructor, private.
+    COPY_CONSTRUCTOR_ABSENT(MemoryManager);
     ~MemoryManager(); //!< Destructor, private.
+    ASSIGNMENT_OPERATOR_ABSENT(MemoryManager);
     void Setup(); //!< Setup memory banks.
     void BankOutOfBound(uint32 bank) const; //!< Report memory bank index out of bank error.
   private:
@@ -154,6 +161,7 @@ namespace Force {
     bool mConstraintConfigured; //!< Indicates whether memory constraints are configured.
     std::map<std::string, MemoryReservation* > mReservations; //!< Container of all memory reservations.
     std::vector<PhysicalRegion* > mPhysicalRegions; //!< Physical memory regions to be mapped by virtual memory system.
+    SegmentJournal* mpSegmentJournal; //!< Journal recording memory initializations of an independent segment, nullptr if not recording.
   };
 
 }
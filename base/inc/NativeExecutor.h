@@ -0,0 +1,45 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef Force_NativeExecutor_H
+#define Force_NativeExecutor_H
+
+#include <string>
+
+#include "Defines.h"
+
+namespace Force {
+
+  class Generator;
+  class Instruction;
+
+  /*!
+    \class NativeExecutor
+    \brief Base class computing the architectural result of side-effect-free instructions on the generator side.
+
+    A native executor only models instructions whose sole effects are writing one general purpose register and advancing the PC
+    to the next instruction.  Everything else is left to the ISS.
+  */
+  class NativeExecutor {
+  public:
+    NativeExecutor() { } //!< Default constructor.
+    virtual ~NativeExecutor() { } //!< Destructor.
+
+    virtual bool Execute(const Generator& rGen, const Instruction& rInstr, std::string& rDestRegName, uint64& rDestValue) const = 0; //!< Compute the destination register value of the instruction, return false if the instruction can't be executed natively.  rDestRegName is left empty if no register is written.
+  };
+
+}
+
+#endif
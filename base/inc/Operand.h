@@ -239,7 +239,7 @@ namespace Force {
     OperandConstraint* InstantiateOperandConstraint() const override; //!< Return an instance of appropriate OperandConstraint object for ChoicesOperand.
     void GenerateChoice(Generator& gen, Instruction& instr); //!< Generate a Choice.
     virtual ChoicesFilter * GetChoicesFilter(const ConstraintSet* pConstrSet) const; //!< Return choices filter
-    virtual void SetChooseResultWithConstraint(Generator&gen, Instruction& instr, const Choice *pChoiceTree); //!< set choose result with constraint
+    virtual void SetChooseResultWithConstraint(Generator&gen, Instruction& instr, const Choice *pChoiceTree, const ChoicesFilter* pChoicesFilter); //!< set choose result with constraint, pChoicesFilter is the operand constraint filter or nullptr if there is none
     virtual void SetChoiceResult(Generator& gen, Instruction& instr, const Choice* choice);
   protected:
     std::string mChoiceText; //!< Text associated with the choice value.
@@ -275,7 +275,7 @@ namespace Force {
       : ChoicesOperand(rOther)
     {
     }
-    void SetChooseResultWithConstraint(Generator& gen, Instruction& instr, const Choice *pChoiceTree) override; //!< set choose result with constraint
+    void SetChooseResultWithConstraint(Generator& gen, Instruction& instr, const Choice *pChoiceTree, const ChoicesFilter* pChoicesFilter) override; //!< set choose result with constraint
     void SetChoiceResult(Generator& gen, Instruction& instr, const Choice* choice) override; //!< set Choice result
     void SaveResource(const Generator& gen, const Instruction& rInstr) const; //!< Save register resource.
     OperandConstraint* InstantiateOperandConstraint() const override; //!< Return an instance of appropriate OperandConstraint object for RegisterOperand.
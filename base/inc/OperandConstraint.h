@@ -165,15 +165,16 @@ namespace Force {
   class ChoicesOperandConstraint : public OperandConstraint {
   public:
     ASSIGNMENT_OPERATOR_ABSENT(ChoicesOperandConstraint);
-    ChoicesOperandConstraint() : OperandConstraint(), mpChoiceTree(nullptr) { } //!< Constructor.
+    ChoicesOperandConstraint() : OperandConstraint(), mpChoiceTree(nullptr), mChoiceTreeShared(false) { } //!< Constructor.
     ~ChoicesOperandConstraint(); //!< Destructor.
     void Setup(const Generator& rGen, const Instruction& rInstr, const OperandStructure& rOperandStruct) override; //!< Setup dynamic operand constraints for ChoicesOperand
     virtual const ChoiceTree* GetChoiceTree() const { return mpChoiceTree; } //!< Return const pointer to mpChoiceTree.
 
   protected:
-    ChoiceTree* mpChoiceTree; //!< Pointer to associated choice tree.
+    const ChoiceTree* mpChoiceTree; //!< Pointer to associated choice tree.
+    bool mChoiceTreeShared; //!< Whether the choice tree is the shared baseline tree rather than a clone owned by the constraint.
   protected:
-    ChoicesOperandConstraint(const ChoicesOperandConstraint& rOther) : OperandConstraint(rOther), mpChoiceTree(nullptr) { } //!< Copy constructor, not meant to be used.
+    ChoicesOperandConstraint(const ChoicesOperandConstraint& rOther) : OperandConstraint(rOther), mpChoiceTree(nullptr), mChoiceTreeShared(false) { } //!< Copy constructor, not meant to be used.
     ChoiceTree* SetupExtraChoiceTree(uint32 index, const Generator& rGen, const Instruction& rInstr, const OperandStructure& rOperandStruct); //!< Setup extra choices tree.
   };
 
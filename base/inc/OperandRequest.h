@@ -32,6 +32,7 @@ namespace Force {
     ASSIGNMENT_OPERATOR_ABSENT(OperandRequest);
     OperandRequest(const std::string& name, uint64 value); //!< Constructor with name and value given.
     OperandRequest(const std::string& name, const std::string& valueStr); //!< Constructor with name and value string given.
+    OperandRequest(const std::string& name, const ConstraintSet& rConstrSet); //!< Constructor with name and value constraint set given.
     ~OperandRequest(); //!< Destructor.
     Object* Clone() const override;  //!< Return a cloned OperandRequest object of the same type and content.
     const std::string ToString() const override; //!< Return a string describing the current state of the OperandRequest object.
@@ -40,6 +41,7 @@ namespace Force {
     const std::string& Name() const { return mName; } //!< Return operand name.
     void SetValueRequest(uint64 value); //!< Set value request of the operand.
     void SetValueRequest(const std::string& valueStr); //!< Set value request of the operand in string format.
+    void SetValueRequest(const ConstraintSet& rConstrSet); //!< Set value request of the operand as a constraint set.
     inline void SetApplied() const {mApplied = true;} //!< the request is applied
     inline bool IsApplied() const {return mApplied; }//!< return applied status
     inline void SetIgnored() const {mIgnored = true; } //!< the request is ignored
@@ -66,6 +66,9 @@ namespace Force {
     virtual uint32 Level() const; //!< Return the table level of the page table entry.
     virtual uint32 ParentTableLevel() const; //!< Return the parent table level of the page table entry
     inline bool ContainsPa(uint64 PA) const { return ((PA >= mPhysicalLower) && (PA <= mPhysicalUpper)); } //!< Return whether the physical address is contained by the PageTableEntry.
+    void AddReference() { ++ mReferences; } //!< Add a reference from another page table sharing the PageTableEntry.
+    bool ReleaseReference() { return (-- mReferences == 0); } //!< Release a reference to the PageTableEntry, return true if it is no longer referenced.
+    inline bool Shared() const { return (mReferences > 1); } //!< Return whether the PageTableEntry is referenced by more than one page table.
   protected:
     PageTableEntry(const PageTableEntry& rOther); //!< Copy constructor.
   protected:
@@ -74,6 +77,7 @@ namespace Force {
     std::map<EPageGenAttributeType, uint32> mGenAttributes; //!< Attributes that generator need to keep about the PTE about generating it.
     uint64 mPhysicalLower; //!< Lower bound of the physical address range that the PTE covers.
     uint64 mPhysicalUpper; //!< Upper bound of the physical address range that the PTE covers.
+    uint32 mReferences; //!< Number of page tables holding the PTE.
   };
 
   /*!
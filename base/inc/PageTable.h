@@ -17,6 +17,7 @@
 #define Force_PageTable_H
 
 #include <map>
+#include <set>
 #include <vector>
 
 #include "Defines.h"
@@ -29,7 +30,9 @@ namespace Force {
   class Page;
   class GenPageRequest;
   class TablePte;
+  class ConstraintSet;
   struct PageTableInfoRec;
+  struct MemoryUsage;
 
   /*!
     \class PageTable
@@ -54,6 +57,8 @@ namespace Force {
     void ConstructPageTableWalk(uint64 VA, Page* pageObj, VmAddressSpace* pVmas, const GenPageRequest& pPageReq); //!< Construct page table walk details.
     const TablePte* PageTableWalk(const Page* pageObj, const VmAddressSpace* pVmas, PageTableInfoRec& page_table_rec) const; // page table walk one step at a time without table construction
     const std::string PageTableInfo() const; //!< Return brief page table info in a string format.
+    void AccountMemory(MemoryUsage& rUsage, std::set<const PageTableEntry* >& rAccountedEntries) const; //!< Add the estimated memory held by the table entries and down stream tables, skipping the entries already accounted.
+    void ShareEntries(const PageTable& rSharingTable, const ConstraintSet& rVaRanges, VmAddressSpace* pVmas, const GenPageRequest& rPageReq); //!< Share the entries of another address space's table whose whole VA span is mapped and inside the VA ranges.
   protected:
     ASSIGNMENT_OPERATOR_ABSENT(PageTable);
     //COPY_CONSTRUCTOR_ABSENT(PageTable);
@@ -61,6 +66,10 @@ namespace Force {
     uint32 GetPteIndex(uint64 address) const; //!< Get index for associated PTE given the address it covers.
     TablePte* GetNextLevelTable(uint64 pageStart) const; //!< Get next level table that covers the address passed in.
     void CommitPageTableEntry(uint64 pageStart, PageTableEntry* pPte, VmAddressSpace* pVmas); //!< Insert PTE object into the table.
+    void CommitPageTableEntryAt(uint32 pteIndex, PageTableEntry* pPte, VmAddressSpace* pVmas); //!< Insert PTE object into the table at the given index.
+    void WriteEntryDescriptor(uint32 pteIndex, const PageTableEntry* pPte, VmAddressSpace* pVmas) const; //!< Write the descriptor of the PTE at the given index to memory.
+    void CommitSharedEntries(VmAddressSpace* pVmas) const; //!< Commit the pages and down stream tables of a shared table to an address space.
+    uint64 MappedSize(uint64& rFirstVa) const; //!< Return the number of bytes mapped through the table, and the VA of its first entry.
   protected:
     EMemBankType mMemoryBank; //!< The memory bank where the page table is located.
     uint32 mMask; //!< Mask to extract index for PTE in the table.
@@ -35,6 +35,7 @@ namespace Force
   class  VmAddressSpace;
   class  PagingChoicesAdapter;
   class  PageTableAllocator;
+  struct MemoryUsage;
 
   /*!
     \class PageTableManager
@@ -56,10 +57,14 @@ namespace Force
 
     bool AllocateRootPageTable(VmAddressSpace* pVmas); //!< allocate a new or alias an existing root page table
     void CommitRootPageTable(RootPageTable* pRootTable); //!< add a newly created root page table to the sorted vector of root tables
+    bool HasRootPageTable(uint64 tableBase) const; //!< return true if a root page table is located at the given base address
+    const VmAddressSpace* PageTableSharingAddressSpace(const VmAddressSpace* pVmas) const; //!< return an initialized address space with a compatible page table context to share page tables with, or nullptr
 
     //Interfaces to PageTableAllocator functions
     const ConstraintSet* Allocated() const { return mpPageTableAllocator->Allocated(); } //!< Interface to get the allocated constraint set from PTA
     bool AllocatePageTableBlock(uint64 align, uint64 size, const ConstraintSet* usable, const ConstraintSet* range, uint64& start) { return mpPageTableAllocator->AllocatePageTableBlock(align, size, usable, range, start); }
+
+    void AccountMemory(MemoryUsage& rUsage) const; //!< Add the estimated memory held by the root page tables and their down stream tables.
   private:
     bool NewRootPageTable(VmAddressSpace* pVmas); //!< function to attempt to create a new root page table for a given context.
     bool AliasRootPageTable(VmAddressSpace* pVmas); //!< function to attempt to alias an existing root table based on context matching the address spaces
@@ -40,6 +40,7 @@ namespace Force {
     void Setup(const ChoicesModerator* pChoicesMod, const VariableModerator* pVar); //!< Setup paging choices moderator.
     uint64 GetPlainPagingChoice(const std::string& rChoiceName) const; //!< Return a randomly picked value from the specified paging choice, without applying suffix to the choice name.
     uint64 GetPagingChoice(const std::string& rChoiceName) const; //!< Return a randomly picked value from the specified paging choice.
+    bool PlainPagingChoiceEnabled(const std::string& rChoiceName, uint32 value) const; //!< Return whether the choice with the specified value has a non-zero weight in the specified paging choice, without applying suffix to the choice name or drawing a random value.
     ChoiceTree* GetPagingChoiceTree(const std::string& rChoiceName) const; //!< Return a ChoiceTree object based on the name provided.
     ChoiceTree* GetPagingChoiceTreeWithGranule(const std::string& rChoiceName, const std::string& rSuffixGranule) const; //!< Return a ChoiceTree object based on the name provided.
     inline ChoiceTree* GetPageSizeChoiceTree(const std::string& rSuffixGranule) const //!< Return a cloned ChoiceTree object pointing to page size choices.
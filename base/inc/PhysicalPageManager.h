@@ -36,6 +36,7 @@ namespace Force
   class  MemoryTraitsManager;
   class  MemoryTraitsRange;
   struct PageSizeInfo;
+  struct MemoryUsage;
 
   /*!
     \class PhysicalPageManager
@@ -58,6 +59,7 @@ namespace Force
     const ConstraintSet* GetUsable() const { return mpFreeRanges; } //!< Return the free ranges.
     void HandleMemoryConstraintUpdate(const MemoryConstraintUpdate& rMemConstrUpdate) const; //!< Update objects dependent on the physical memory constraint.
     const Page* GetVirtualPage(uint64 PA, const VmAddressSpace* pVmas) const;
+    void AccountMemory(MemoryUsage& rUsage) const; //!< Add the estimated memory held by the managed ranges and physical pages.
   protected:
     virtual const std::vector<EPteType>& GetPteTypes() const = 0; //! Return vector of EPteTypes
   private:
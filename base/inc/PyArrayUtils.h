@@ -0,0 +1,40 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef Force_PyArrayUtils_H
+#define Force_PyArrayUtils_H
+
+#include <vector>
+
+#include "pybind11/pybind11.h"
+
+#include "Defines.h"
+
+namespace py = pybind11;
+
+namespace Force {
+
+  /*!
+    Return the values in a Python array.array of unsigned 64-bit integers, which holds them compactly rather than as a list of Python int objects.
+  */
+  inline py::object to_py_uint64_array(const std::vector<uint64>& rValues)
+  {
+    py::bytes values_bytes(reinterpret_cast<const char*>(rValues.data()), rValues.size() * sizeof(uint64));
+    return py::module::import("array").attr("array")("Q", values_bytes);
+  }
+
+}
+
+#endif  // Force_PyArrayUtils_H
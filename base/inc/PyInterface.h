@@ -32,6 +32,8 @@ namespace py = pybind11;
 namespace Force {
 
   class Scheduler;
+  class ApiCallRecorder;
+  class ApiCallReplayer;
 
   /*!
     \class PyInterface
@@ -40,12 +42,14 @@ namespace Force {
 
   class PyInterface {
   public:
-    explicit PyInterface(Scheduler* scheduler) : mpScheduler(scheduler), mLibPath(), mEnvObject(), mTemplateObject() {} //!< Constructor
-    ~PyInterface() {} //!< Destructor
+    explicit PyInterface(Scheduler* scheduler) : mpScheduler(scheduler), mLibPath(), mEnvObject(), mTemplateObject(), mpApiRecorder(nullptr), mpApiReplayer(nullptr) {} //!< Constructor
+    ~PyInterface(); //!< Destructor
     ASSIGNMENT_OPERATOR_ABSENT(PyInterface);
-    COPY_CONSTRUCTOR_DEFAULT(PyInterface);
+    COPY_CONSTRUCTOR_ABSENT(PyInterface);
     void RunTest(); //!< Run test template to generate test.
     uint32 CallBackTemplate(uint32 threadId, ECallBackTemplateType callBackType, const std::string& primaryValue, const std::map<std::string, uint64>& callBackValues); //!< call back some fuction on test template
+    ApiCallRecorder* GetApiCallRecorder() const { return mpApiRecorder; } //!< Return the recorder of the API calls, nullptr if not recording.
+    ApiCallReplayer* GetApiCallReplayer() const { return mpApiReplayer; } //!< Return the replayer of the API calls, nullptr if not replaying.
     // Interface functions that will be exposed to front end
     uint32 NumberOfChips() const; //!< API that returns number of chips in the system.
     uint32 NumberOfCores() const; //!< API that returns number of cores in each chip.
@@ -115,6 +119,13 @@ namespace Force {
 
     py::object GenSemaphore(uint32 threadId, const std::string& name, uint64 counter, uint32 bank, uint32 size); //!< Generate a semaphore
 
+    // Independent segment APIs
+    bool PrepareSegmentFork(uint32 threadId); //!< Check if independent segments can be generated in forked processes, flush the buffered output if so.
+    void BeginSegment(uint32 threadId, uint64 seed, const std::string& simTraceFile); //!< Start generating an independent segment in a forked process.
+    void EndSegment(uint32 threadId, const std::string& journalFile); //!< Finish generating an independent segment in a forked process, write its journal.
+    py::object ImportSegment(uint32 threadId, const std::string& journalFile); //!< Import the journal of an independent segment, return the (name, value, mask) of the register bits it reads before writing them.
+    void ImportSegmentState(uint32 threadId, const std::string& journalFile); //!< Set the final state of an imported independent segment, continuing from the PC it ended at.
+
     // Misc APIs
     py::object GetOption(const std::string& optName) const; //!< API that return an options value and if it is valid.
     py::object Query(uint32 threadId, const std::string& queryName, const std::string& primaryString, const py::dict& rParams) const;  //!< API for query of various types.
@@ -128,6 +139,8 @@ namespace Force {
     bool VerifyVirtualAddress(uint32 threadId, uint64 va, uint64 size, bool isInstr) const; //!< verify virtual address is usable or not
   private:
     void SetupModulePaths(const std::string& templatePath); //!< Setup necessary paths for loading Python modules.
+    void SetupApiCallRecord(); //!< Setup recording or replaying the API calls made by the test template.
+    void RejectRecordedSegmentApi(const std::string& rName) const; //!< Fail a segment API that can't be recorded when API calls are recorded.
     void GenerateTemplate(py::object& template_obj); //!< Generate test using test template.
     std::string GetLibModuleName(const std::string& inFilePath); //!< Convert file path to library module name.
     py::object LoadTestTemplate(const std::string& templatePath, py::object& globals); //!< Load the test template as a Python module.
@@ -136,6 +149,8 @@ namespace Force {
     std::string mLibPath; //!< Path to generator Python library.
     py::object mEnvObject; //!< front-end enviroment object
     py::object mTemplateObject; //!< front-end template object
+    ApiCallRecorder* mpApiRecorder; //!< Recorder of the API calls made by the test template, if recording.
+    ApiCallReplayer* mpApiReplayer; //!< Replayer of recorded API calls run in place of the test template, if replaying.
   };
 
 }
@@ -16,6 +16,8 @@
 #ifndef Force_Random_H
 #define Force_Random_H
 
+#include <vector>
+
 #include "Defines.h"
 
 namespace Force {
@@ -37,7 +39,10 @@ namespace Force {
     uint64 RandomSeed() const; //!< Obtain a random initial seed if no seed is specified at the command line
     uint32 Random32(uint32 min=0, uint32 max=MAX_UINT32) const; //!< Obtain a random 32 bit integer value
     uint64 Random64(uint64 min=0, uint64 max=MAX_UINT64) const; //!< Obtain a random 64 bit integer value
+    void Random64Values(uint64 min, uint64 max, uint64 count, bool unique, std::vector<uint64>& rValues) const; //!< Obtain count random 64 bit integer values, optionally without repetition
     double RandomReal(double min=0.0, double max=1.0) const; //!< Obtain a random 64 bit real value
+    void GetDrawCounts(uint64& rDraws32, uint64& rDraws64) const; //!< Return the number of values drawn from the 32-bit and 64-bit engines so far.
+    void Discard(uint64 draws32, uint64 draws64); //!< Advance the 32-bit and 64-bit engines as if the given numbers of values had been drawn.
   private:
     Random();  //!< Constructor, private.
     ~Random(); //!< Destructor, private.
@@ -26,6 +26,7 @@ namespace Force {
 
   uint32 random_value32(uint32 min, uint32 max); //!< Return a random 32-bit integer value in the range [min, max]
   uint64 random_value64(uint64 min, uint64 max); //!< Return a random 64-bit integer value in the range [min, max]
+  void random_values64(uint64 min, uint64 max, uint64 count, uint64 align, bool unique, std::vector<uint64>& rValues); //!< Return count random align-aligned 64-bit integer values in the range [min, max], optionally without repetition.
   double random_real(double min, double max); //!< Return a random 64-bit real value in the range [min, max)
   void report_error(const char* pErrMsg); //!< Report an error message.
 
@@ -61,6 +62,31 @@ namespace Force {
       return nullptr;
     }
 
+  /*!
+    Draw items considering weights without replacement, from the first tier on, until the accept function accepts one. Drawn items are removed
+    from their tier. Return the accepted item, which is chosen in proportion to the weights among the acceptable items of the first tier that
+    has any, or nullptr if none is accepted.
+  */
+  template <typename T, typename AcceptFunc>
+    T* draw_weighted_item(std::vector<std::vector<T *> >& rTiers, AcceptFunc acceptFunc)
+    {
+      for (auto& tier_items : rTiers) {
+        while (not tier_items.empty()) {
+          T* drawn_item = choose_weighted_item(tier_items);
+          if (nullptr == drawn_item) {
+            break; // only zero weight items left in this tier.
+          }
+          tier_items.erase(std::find(tier_items.begin(), tier_items.end(), drawn_item));
+
+          if (acceptFunc(drawn_item)) {
+            return drawn_item;
+          }
+        }
+      }
+
+      return nullptr;
+    }
+
   /*!
     Return an item's index in the vector considering relative weights..
   */
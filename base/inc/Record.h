@@ -25,6 +25,8 @@
 
 namespace Force {
 
+  struct MemoryUsage;
+
   /*!
     \class Record
     \brief Base class of various record object.
@@ -104,6 +106,7 @@ namespace Force {
     MemoryInitRecord* GetMemoryInitRecord(cuint32 threadId, uint32 size, uint32 elementSize, EMemDataType type) const; //!< Return a MemoryInitRecord object.
     MemoryInitRecord* GetMemoryInitRecord(cuint32 threadId, uint32 size, uint32 elementSize, EMemDataType type, const EMemAccessType memAccessType) const; //!< Return a MemoryInitRecord object.
     void SwapMemoryInitRecords(std::vector<MemoryInitRecord* >& rSwapVec); //!< Swap MemoryInitRecords vector
+    void AccountMemory(MemoryUsage& rUsage) const; //!< Add the estimated memory held by the MemoryInitRecords not yet swapped out.
   protected:
     RecordArchive(const RecordArchive& rOther) : Object(rOther), mCurrentId(0), mRecords() { } //!< Copy constructor
   private:
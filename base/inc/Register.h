@@ -96,6 +96,7 @@ namespace Force {
     friend class BitField;
     friend class LinkedPhysicalRegister;
     friend class ImageLoader;
+    friend class SegmentJournal;
   };
 
   /*!
@@ -16,6 +16,7 @@
 #ifndef Force_ResourceAccess_H
 #define Force_ResourceAccess_H
 
+#include <map>
 #include <vector>
 
 #include "Defines.h"
@@ -114,6 +115,7 @@ namespace Force {
     void Setup(uint32 numEntries); //!< Set up resource age entries.
     void UpdateAge(uint32 index, uint32 age, EAccessAgeType ageType, ResourceAccessQueue* pAccessQueue); //!< Update resource access age.
     const AccessAge& GetAccessAge(uint32 index) const; //!< Return access age for an entry.
+    void RestoreAccessAge(const AccessAge& rAge) { mAges[rAge.Index()] = rAge; } //!< Restore a previously saved access age.
     EResourceType ResourceType() const { return mType; } //!< Return the type attribute.
   private:
     ResourceTypeAges() : mType(EResourceType(0)), mAges() { } //!< Default constructor.
@@ -227,6 +229,25 @@ namespace Force {
     WindowLookUpNear(const WindowLookUpNear& rOther) : WindowLookUp(rOther) { }  //!< copy constructor
   };
 
+  /*!
+    \class ResourceAccessCheckpoint
+    \brief Saves the parts of a ResourceAccessQueue changed after the checkpoint was taken, so that the queue can be restored to it.
+  */
+  class ResourceAccessCheckpoint {
+  public:
+    ResourceAccessCheckpoint(uint32 age, uint32 index, const std::vector<ResourceTypeEntropy* >& rTypeEntropies); //!< Constructor with the queue state to restore.
+    ~ResourceAccessCheckpoint(); //!< Destructor.
+    ASSIGNMENT_OPERATOR_ABSENT(ResourceAccessCheckpoint);
+    COPY_CONSTRUCTOR_ABSENT(ResourceAccessCheckpoint);
+  private:
+    uint32 mAge; //!< Resource age when the checkpoint was taken.
+    uint32 mIndex; //!< Index of the current resources slot when the checkpoint was taken.
+    std::vector<ResourceTypeEntropy* > mTypeEntropies; //!< Copies of the entropies when the checkpoint was taken.
+    std::map<uint32, ResourceAccessStage* > mSavedStages; //!< Stages replaced or changed since the checkpoint was taken, indexed by queue slot.
+    std::vector<AccessAge> mSavedAges; //!< Access ages before each change since the checkpoint was taken, in the order changed.
+    friend class ResourceAccessQueue;
+  };
+
   /*!
     \class ResourceAccessQueue
     \brief Resource access queue.
@@ -251,10 +272,12 @@ namespace Force {
     const ConstraintSet* GetOptimalResourceConstraint(uint32 chosenValue,const WindowLookUp& rLookUp, EResourceType resType, EDependencyType depType) const; //!< Get optimal resource constraint.
     const ConstraintSet* GetRandomResourceConstraint(uint32 low, uint32 high, EResourceType resType, EDependencyType depType) const; //!< Get random resource constraint.
     inline const std::vector<ResourceTypeEntropy* >& GetResourceTypeEntropies() const { return mTypeEntropies; } //!< Get resource Type entropies
+    ResourceAccessCheckpoint* TakeCheckpoint(); //!< Take a checkpoint that the queue can later be restored to.
+    void RestoreCheckpoint(ResourceAccessCheckpoint* pCheckpoint); //!< Restore the queue to the latest checkpoint, which is deleted.
   protected:
     ResourceAccessQueue(const ResourceAccessQueue& rOther); //!< Copy constructor.
-    ResourceAccessQueue(ResourceAccessQueue& rOther); //!< Copy constructor.
     void RetireReuseStage(); //!< Retire a stage item from the queue and reuse it.
+    ResourceAccessStage* ModifiableAccessStage(uint32 dist); //!< Get slot item by distance, saving it to the latest checkpoint before it is changed.
     void UpdateAccessAge(const ResourceAccessStage* pHotResource); //!< Update resource access age.
     void UpdateAccessEntropy(const ResourceAccessStage* pHotResource); //!< update resource access entropy
     void UpdateEntropyState(); //!< update resource entropy state
@@ -276,6 +299,7 @@ namespace Force {
     std::vector<ResourceAccessStage* > mQueue; //!< Resource access entries submitted.
     std::vector<ResourceTypeAges* > mTypeAges; //!< Ages contains for all supported resource types.
     std::vector<ResourceTypeEntropy* > mTypeEntropies; //!< Entropies contains for all supported resource types.
+    std::vector<ResourceAccessCheckpoint* > mCheckpoints; //!< Checkpoints taken and not yet restored, the latest last.
   };
 
 }
@@ -45,10 +45,9 @@ namespace Force {
     void Setup(const Generator* pGen); //!< set up choice and trees and so on
     const ConstraintSet* GetDependenceConstraint(ERegAttrType access, EResourceType resType, const ResourceAccessStage* pHotResource) const; //!< Get dependence constraint.
     void HandleNotification(const NotificationSender* sender, ENotificationType eventType, Object* pPayload) override; //!< Receive Notification override
-    const ResourceDependence* Snapshot() const; //!< take a snapshot
+    ResourceAccessCheckpoint* Snapshot() { return TakeCheckpoint(); } //!< take a snapshot of the access history, to be restored with RestoreCheckpoint.
   protected:
     ResourceDependence(const ResourceDependence& rOther); //!< Copy constructor.
-    ResourceDependence(ResourceDependence& rOther); //!< Copy constructor.
     const ConstraintSet* GetInterDependenceConstraint(ERegAttrType access, EResourceType resType) const; //!< get resource inter-dependence on the register operand.
     const ConstraintSet* GetIntraDependenceConstraint(ERegAttrType access, EResourceType resType, const ResourceAccessStage* pHotResource) const; //!< get resource inter-dependence on the register operand.
     void UpdateChoiceTrees( ); //!< Clone choice trees.
@@ -31,6 +31,7 @@ namespace Force {
   class PhysicalRegister;
   class ResourcePeState;
   class ResourceDependence;
+  class ResourceAccessCheckpoint;
 
   /*!
     \class ResourcePeStateStack
@@ -227,7 +228,7 @@ namespace Force {
   */
   class DependencePeState : public ResourcePeState {
   public:
-    explicit DependencePeState(const ResourceDependence* pDependence) : ResourcePeState(), mpDependence(pDependence) { } //!< copy construtor
+    DependencePeState(ResourceDependence* pDependence, ResourceAccessCheckpoint* pCheckpoint) : ResourcePeState(), mpDependence(pDependence), mpCheckpoint(pCheckpoint) { } //!< Constructor with the checkpoint to restore the dependence to.
 
     const std::string ToString() const override; //!< Return a string describing resource state.
     const char* Type() const override; //!< Return a string describing the actual type of resource state.
@@ -238,7 +239,8 @@ namespace Force {
     ASSIGNMENT_OPERATOR_ABSENT(DependencePeState);
     COPY_CONSTRUCTOR_ABSENT(DependencePeState);
   protected:
-    mutable const ResourceDependence *mpDependence; //!< the pointer to dependence
+    ResourceDependence* mpDependence; //!< the pointer to dependence
+    mutable ResourceAccessCheckpoint* mpCheckpoint; //!< the checkpoint of the dependence access history
   };
 
 }
@@ -23,6 +23,7 @@
 
 #include "Defines.h"
 #include "Enums.h"
+#include "SegmentJournal.h"
 #include ARCH_ENUM_HEADER
 
 namespace Force {
@@ -50,6 +51,7 @@ namespace Force {
     static void Initialize(); //!< Create Scheduler instance.
     static void Destroy(); //!< Destroy Scheduler instance.
     static Scheduler* Instance() { return mspScheduler; } //!< Access Scheduler instance.
+    PyInterface* GetPyInterface() const { return mpPyInterface; } //!< Return the Python interface instance.
 
     void Run(); //!< Start up scheduler, run the generator threads.
     void OutputTest(); //!< Output test.
@@ -129,6 +131,11 @@ namespace Force {
     void GetFreeThreads(std::vector<uint32>& freeThreads) const; //!< get free threads
     bool GenSemaphore(uint32 threadId, const std::string& name, uint64 counter, uint32 bank, uint32 size, uint64& address, bool& reverseEndian); //!< generate a semaphore
     void SynchronizeWithBarrier(uint32 threadId, const ConstraintSet& rSynchronizedThreadIds); //!< Let threadId participate in the synchronize barrier specified by threadIds.
+    bool PrepareSegmentFork(uint32 threadId); //!< Check if independent segments can be generated in forked processes, flush the buffered output if so.
+    void BeginSegment(uint32 threadId, uint64 seed, const std::string& rSimTraceFile); //!< Start generating an independent segment in a forked process.
+    void EndSegment(uint32 threadId, const std::string& rJournalFile); //!< Finish generating an independent segment in a forked process, write its journal.
+    void ImportSegment(uint32 threadId, const std::string& rJournalFile, std::vector<SegmentJournal::JournalRegisterValue>& rLiveInRegisters); //!< Import the journal of an independent segment, return the register bits it reads before writing them.
+    void ImportSegmentState(uint32 threadId, const std::string& rJournalFile); //!< Set the final state of an imported independent segment, continuing from the PC it ended at.
   private:
     Scheduler(); //!< Constructor.
     COPY_CONSTRUCTOR_ABSENT(Scheduler);
@@ -54,10 +54,14 @@ namespace Force
   /*!
     \class ShuffledRoundRobinSchedulingStrategy
     \brief Round robin thread scheduling strategy.
+
+    The scheduling quantum is the number of NextThread() calls, one per front end API call, that the current thread is
+    allowed to run before the schedule rotates to the next thread. The default quantum of 1 interleaves the threads on
+    every API call. A thread that is deactivated or removed gives up the rest of its quantum.
   */
   class ShuffledRoundRobinSchedulingStrategy : public SchedulingStrategy {
   public:
-    ShuffledRoundRobinSchedulingStrategy(); //!< Constructor.
+    explicit ShuffledRoundRobinSchedulingStrategy(uint32 quantum = 1); //!< Constructor.
     SUBCLASS_DESTRUCTOR_DEFAULT(ShuffledRoundRobinSchedulingStrategy); //!< Use default sub class destructor.
 
     inline uint32 CurrentThreadId() const override //!< Return current thread ID.
@@ -90,8 +94,11 @@ namespace Force
     {
       mCurrentThreadId = mActiveThreadIds.at(mNextIndex);
       mNextIndex += 1;
+      mQuantumCount = 0;
     }
 
+    bool ContinueQuantum(); //!< Return true if the current thread keeps running for its quantum.
+
   private:
     ESchedulingState mState; //!< Scheduling state enum.
     uint32 mCurrentThreadId; //!< Current thread ID.
@@ -99,6 +106,8 @@ namespace Force
     ESchedulingState mLockingState; //!< The scheduler state when thread locking occurs.
     uint32 mLockingLevel; //!< Schedule locking level.
     uint32 mLockingThreadId; //!< ThreadId of the thread that holds the schedule lock.
+    uint32 mQuantum; //!< Number of NextThread() calls a thread runs before the schedule rotates.
+    uint32 mQuantumCount; //!< Number of NextThread() calls the current thread has run in its quantum.
     std::vector<uint32> mThreadIds; //!< Vector of the thread IDs to schedule.
     std::vector<uint32> mActiveThreadIds; //!< Vector of the active thread IDs to schedule.
   };
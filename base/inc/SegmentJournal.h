@@ -0,0 +1,119 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef Force_SegmentJournal_H
+#define Force_SegmentJournal_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Defines.h"
+#include "Enums.h"
+
+namespace Force {
+
+  class Generator;
+  class MemoryInitRecord;
+  struct RegUpdate;
+  struct MemUpdate;
+
+  /*!
+    \class SegmentJournal
+    \brief Records what a generator adds to the test while generating an independent code segment, so that the segment can be imported into another instance of the generator.
+
+    The journal holds the memory initializations, the committed instructions' assembly text and the register initial values sent to the ISS
+    while it is active.  From the ISS step updates it also records the registers the segment reads before writing them, and the registers
+    and memory it writes, whose final values are written out with the PC the segment ended at.  Importing a journal applies the
+    initializations to the importing generator, failing on any memory byte or register bit that was already initialized to a different
+    value.  Importing its state afterwards sets the final register and memory values and the end PC in the generator and the ISS, so the
+    segment doesn't have to be executed again.
+  */
+  class SegmentJournal {
+  public:
+    /*!
+      \struct JournalRegisterValue
+      \brief A recorded physical register value.
+    */
+    struct JournalRegisterValue {
+      JournalRegisterValue() : mName(), mValue(0), mMask(0) { } //!< Default constructor.
+      JournalRegisterValue(const std::string& rName, uint64 value, uint64 mask) : mName(rName), mValue(value), mMask(mask) { } //!< Constructor.
+
+      std::string mName; //!< Physical register name.
+      uint64 mValue; //!< Register value.
+      uint64 mMask; //!< Mask of the recorded bits.
+    };
+
+    SegmentJournal() : mMemoryInits(), mRegisterInits(), mInstructions(), mLiveInRegisters(), mFinalRegisters(), mFinalMemory(), mAccessedRegisters(), mEndPC(0) { } //!< Constructor.
+    ~SegmentJournal() { } //!< Destructor.
+    ASSIGNMENT_OPERATOR_ABSENT(SegmentJournal);
+    COPY_CONSTRUCTOR_ABSENT(SegmentJournal);
+
+    void RecordMemoryInit(const MemoryInitRecord& rMemInitRecord); //!< Record a memory initialization.
+    void RecordInstruction(uint32 bank, uint64 pa, uint32 opcode, const std::string& rAsmText); //!< Record a committed instruction.
+    void RecordRegisterInit(const std::string& rPhysRegName, uint64 value, uint64 mask); //!< Record a physical register initial value sent to the ISS.
+    void RecordRegisterUpdates(const std::vector<RegUpdate>& rRegUpdates); //!< Record the register bits read before being written and the register bits written by ISS steps.
+    void RecordMemoryUpdates(const std::vector<MemUpdate>& rMemUpdates); //!< Record the memory bytes written by ISS steps.
+    void Write(const std::string& rFilePath, uint64 endPC) const; //!< Write the journal to a file, ending at the specified PC.
+    static void Import(Generator& rGenerator, const std::string& rFilePath, std::vector<JournalRegisterValue>& rLiveInRegisters); //!< Import the initializations and instructions of a journal file into a generator, return the register bits the segment reads before writing them.
+    static void ImportState(Generator& rGenerator, const std::string& rFilePath); //!< Set the final values of the registers and memory the segment writes and its end PC in a generator and its ISS.
+  private:
+    /*!
+      \struct JournalMemoryInit
+      \brief A recorded memory initialization.
+    */
+    struct JournalMemoryInit {
+      JournalMemoryInit() : mBank(0), mAddress(0), mType(EMemDataType::Init), mAccessType(EMemAccessType::Unknown), mData(), mAttributes() { } //!< Default constructor.
+
+      uint32 mBank; //!< Memory bank.
+      uint64 mAddress; //!< Physical address.
+      EMemDataType mType; //!< Initialization data type.
+      EMemAccessType mAccessType; //!< Memory access type.
+      std::vector<uint8> mData; //!< Initialization data bytes.
+      std::vector<uint8> mAttributes; //!< Memory attributes of the data bytes.
+    };
+
+    /*!
+      \struct JournalInstruction
+      \brief A recorded committed instruction.
+    */
+    struct JournalInstruction {
+      JournalInstruction() : mBank(0), mAddress(0), mOpcode(0), mAsmText() { } //!< Default constructor.
+      JournalInstruction(uint32 bank, uint64 address, uint32 opcode, const std::string& rAsmText) : mBank(bank), mAddress(address), mOpcode(opcode), mAsmText(rAsmText) { } //!< Constructor.
+
+      uint32 mBank; //!< Memory bank.
+      uint64 mAddress; //!< Physical address.
+      uint32 mOpcode; //!< Instruction opcode.
+      std::string mAsmText; //!< Assembly text.
+    };
+
+    void Read(const std::string& rFilePath); //!< Read a journal file.
+    static void ImportMemoryInit(Generator& rGenerator, const JournalMemoryInit& rMemInit); //!< Initialize the importing generator's memory with the bytes it doesn't already hold.
+    static void ImportRegisterInit(Generator& rGenerator, const JournalRegisterValue& rRegInit); //!< Initialize a physical register of the importing generator and the ISS.
+    static bool ImportFinalRegister(Generator& rGenerator, const JournalRegisterValue& rFinalReg); //!< Set the final value of a written physical register in the importing generator and the ISS, return whether it is a system register.
+  private:
+    std::vector<JournalMemoryInit> mMemoryInits; //!< Recorded memory initializations.
+    std::vector<JournalRegisterValue> mRegisterInits; //!< Recorded physical register initial values.
+    std::vector<JournalInstruction> mInstructions; //!< Recorded committed instructions.
+    std::map<std::string, JournalRegisterValue> mLiveInRegisters; //!< Register bits read before being written, with the values read.
+    std::map<std::string, JournalRegisterValue> mFinalRegisters; //!< Final values of the written register bits.
+    std::map<uint32, std::map<uint64, uint8> > mFinalMemory; //!< Final values of the written memory bytes, by memory bank and physical address.
+    std::map<std::string, uint64> mAccessedRegisters; //!< Masks of the register bits read or written so far.
+    uint64 mEndPC; //!< The PC the segment ended at, read from a journal file.
+  };
+
+}
+
+#endif
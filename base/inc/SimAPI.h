@@ -180,6 +180,10 @@ namespace Force {
     virtual void EnterSpeculativeMode(uint32 cpuId) = 0; //!< The CPU thread enters speculative mode.
     virtual void LeaveSpeculativeMode(uint32 cpuId) = 0; //!< The CPU thread leaves speculative mode.
     virtual void RecordExceptionUpdate(const SimException *pException) = 0; //!< Record exceptions.
+    virtual void SetRegisterReadUpdates(bool enable) { } //!< Choose whether register reads are reported in step updates; off unless enabled.
+    virtual void GetDisassembly(uint32 CpuID, const uint64_t* pPc, std::string& rOpcode, std::string& rDisassembly) { } //!< Obtain the opcode and disassembly at a given PC; left empty by simulators without disassembly.
+    void FlushTraceFiles(); //!< Write out what is buffered for the trace files, so that a forked process doesn't write it again.
+    void RedirectTraceFiles(const std::string& rSimTraceFile); //!< Write the simulation trace of a forked process to its own file and stop the API trace, which belongs to the parent process.
 
     //!< form 'cpuID' from cluster,core,thread...
     uint32 CpuID(uint32 socket, uint32 cluster, uint32 core, uint32 thread);
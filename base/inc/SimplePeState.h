@@ -24,6 +24,7 @@ namespace Force {
 
   class Generator;
   class Register;
+  struct MemoryUsage;
 
   /*!
     \class SimpleRegisterState
@@ -51,6 +52,7 @@ namespace Force {
     COPY_CONSTRUCTOR_DEFAULT(SimplePeState);
     void SaveState(Generator* pGen, const std::vector<Register* >& rRegContext); //!< Save PE state.
     bool RestoreState(); //!< Restore PE state;
+    void AccountMemory(MemoryUsage& rUsage) const; //!< Add the estimated memory held by the saved PE state.
   private:
     std::vector<SimpleRegisterState> mRegisterStates;
     Register* mpGpr; //!< Pointer to an useable GPR register.
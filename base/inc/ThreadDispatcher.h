@@ -75,6 +75,9 @@ namespace Force {
   /*!
     \class MultiThreadDispatcher
     \brief Class to coerce threads into executing in a prescribed, repeatable order when multiple threads are executing.
+
+    Each execution thread waits on its own condition variable, so handing off to the next scheduled thread wakes only that
+    thread. The thread ID of an execution thread is kept in thread local storage, so it can be retrieved without locking.
   */
   class MultiThreadDispatcher : public ThreadDispatcher {
   public:
@@ -93,13 +96,14 @@ namespace Force {
     void RegisterExecutionThread(cuint32 threadId); //!< Establish link between the execution thread and its thread ID; this method must be called on the execution thread for the specified thread ID.
     void ReportThreadDone(); //!< Notify dispatcher that the execution thread is about to terminate.
   private:
-    void UnlockMutex(); //!< Unlock the mutex and notify other threads to progress.
+    void UnlockMutex(); //!< Unlock the mutex and notify the next scheduled thread to progress.
     void UnlockMutexNoAdvance(); //!< Unlock the mutex; do not notify other threads to progress.
+    std::condition_variable_any& GetCondVar(cuint32 threadId); //!< Return the condition variable the specified thread waits on; the dispatch mutex must be held.
   private:
     Scheduler* mpScheduler; //!< Scheduler
     CountingMutex mDispatchMutex; //!< Reentrant mutex with lock count
-    std::condition_variable_any mCondVar; //!< Condition variable to ensure thread is current thread
-    std::map<std::thread::id, uint32> mThreadIds; //!< Mapping between internal execution thread ID and application thread ID
+    std::map<uint32, std::condition_variable_any> mCondVars; //!< Condition variables to ensure each thread is current thread, keyed by application thread ID; entries are never erased, so references to them stay valid
+    static thread_local uint32 msThreadId; //!< Application thread ID registered by the calling execution thread
   };
 
   /*!
@@ -23,6 +23,7 @@
 namespace Force {
 
   class AddressReuseMode;
+  class ChoiceTree;
   class GenPageRequest;
   class MemoryConstraint;
   class MemoryConstraintUpdate;
@@ -53,6 +54,7 @@ namespace Force {
 
     void Setup(Generator* gen) override; //!< Setup the virtual memory address space object.
     const ConstraintSet* VirtualUsableConstraintSet(bool isInstr) const override; //!< Return const pointer to applicable virtual constraint object.
+    bool VirtualUsableContainsRange(uint64 lower, uint64 upper, bool isInstr) const override; //!< Return true if a single applicable virtual usable range contains the whole address range.
     ConstraintSet* VirtualUsableConstraintSetClone(bool isInstr) override; //!< Return cloned pointer to applicable virtual constraint object.
     const ConstraintSet* VirtualSharedConstraintSet() const override; //!< Return const pointer to virtual shared constraint object.
     void ApplyVirtualUsableConstraint(const EMemDataType memDataType, const EMemAccessType memAccessType, const AddressReuseMode& rAddrReuseMode, ConstraintSet* constrSet) const override; //!< Apply virtual usable constraint to specified constraint.
@@ -76,6 +78,8 @@ namespace Force {
     bool UpdateContext(const VmContext* pVmContext); //!< UpdateContextParams in Control Block
     GenPageRequest* DefaultPageRequest(bool isInstr) const; //!< Return a default GenPageRequest object.
     TablePte* CreateNextLevelTable(uint64, const PageTable* parentTable, const GenPageRequest& pPageReq); //!< Create next level page table object.
+    void CommitSharedTable(uint64 VA, const PageTable* parentTable, const TablePte* pTablePte); //!< Commit a page table shared with another address space.
+    void CommitSharedPage(const Page* pSharedPage); //!< Commit a copy of a page mapped by a page table shared with another address space.
     void WriteDescriptor(uint64 descrAddr, EMemBankType memBankType, uint64 descrValue, uint32 descrSize); //!< Write descriptor to memory
     const PagingChoicesAdapter* GetChoicesAdapter() const; //!< Get paging choices adapter.
     bool GetPageInfo(uint64 addr, const std::string& type, uint32 bank, PageInformation& rPageInfo) const override; //!< Return the page information record according to the given address/address type
@@ -114,11 +118,13 @@ namespace Force {
     const Page* MapAddress(uint64 VA, uint64 size, bool isInstr, const GenPageRequest* pPageReq, bool& newAlloc); //!< Map one virtual address.
     const Page* MapAddressForPA(uint64 PA, EMemBankType bank, uint64 size, bool isInstr, const GenPageRequest* pPageReq); //!< Map one virtual address to the given physical address.
     const Page* SetupPageMapping(uint64 VA, uint64 size, bool isSysPage, GenPageRequest* pPageReq); //!< Setup mapping of VA to page
+    const Page* SetupSuperpageMapping(uint64 VA, uint64 size, GenPageRequest* pPageReq, const ChoiceTree* pPageSizeTree); //!< Setup mapping of VA to a superpage the range allows, picked by page size choice weight, return nullptr if none.
     const Page* SetupPageMappingForPA(uint64 VA, EMemBankType bank, uint64 size, bool isInstr, GenPageRequest* pPageReq); //!< Setup mapping of VA to page
     bool AllocatePhysicalPage(uint64 VA, uint64 size, GenPageRequest* pPageReq, PageSizeInfo& rSizeInfo, EMemBankType memBank, const PagingChoicesAdapter* pChoicesAdapter); //!< Allocate physical page.
     void ConstructPageTableWalk(Page* pageObj, const GenPageRequest& pPageReq); //!< Construct page table walk.
     void CommitPage(const Page* pageObj, uint64 size); //!< Commit page.
     void MapEssentialPhysicalRegions(); //!< Map essential physical regions.
+    void SharePageTables(const VmAddressSpace& rSharingVmas, const std::vector<const PhysicalRegion* >& rPhysRegions); //!< Share the page tables mapping only the physical regions with another address space.
     void MapPhysicalRegions(); //!< Map local physical regions, such as page tables.
     bool MapPhysicalRegion(const PhysicalRegion* pPhysRegion); //!< Map the specified physical region.
   protected:
@@ -130,6 +136,7 @@ namespace Force {
     std::vector<const Page* >     mPages; //!< Sorted vector holding pointers to all Page objects.
     std::vector<PhysicalRegion* > mPhysicalRegions; //!< Physical regions to be mapped.
     std::vector<Page* > mNoTablePages; //!< The pages that is not part of the page table hierarch.
+    std::vector<Page* > mSharedPages; //!< Copies of the pages mapped by page tables shared with other address spaces.
     std::vector<ConstraintSet* > mVmConstraints; //!< Container of all the applicable VM constraints.
     std::vector<PageTableConstraint* > mPageTableConstraints; //!< Pointer to page table related constraints.
     bool mFlatMapped;
@@ -34,6 +34,7 @@ namespace Force {
   class VmFactory;
   class VmContext;
   class VmContextInfo;
+  class Register;
 
   /*!
     \class VmManager
@@ -46,7 +47,7 @@ namespace Force {
     const std::string ToString() const override { return Type(); } //!< Return a string describing the VmManager object.
     const char* Type() const override { return "VmManager"; }
 
-    VmManager() : Object(), mpCurrentRegime(nullptr), mpCurrentMapper(nullptr), mpGenerator(nullptr), mpVmInfo(nullptr), mVmRegimes(), mVmContextInfoCache(), mVmFactories() { } //!< Default constructor.
+    VmManager() : Object(), mpCurrentRegime(nullptr), mpCurrentMapper(nullptr), mpGenerator(nullptr), mpVmInfo(nullptr), mVmRegimes(), mVmContextInfoCache(), mContextRegisters(), mContextFingerprint(), mVmFactories() { } //!< Default constructor.
     ~VmManager(); //!< Destructor.
     ASSIGNMENT_OPERATOR_ABSENT(VmManager);
 
@@ -59,6 +60,7 @@ namespace Force {
     bool GetVmContextDelta(std::map<std::string, uint64> & rDeltaMap, uint32 contextId) const;//!< Find the delta map between contextId and currect default context.
     uint32 GetVmCurrentContext() const;//!< Get Current VM Context.
     virtual void Update(); //!< Called to update VmManager.
+    bool IsContextRegister(const Register* pReg) const; //!< Return true if the register is in the register context of any VmRegime.
     void UpdateVmContext(EVmRegimeType regimeType, uint32 contextId); //!< Switch the address space for the specified regime.
 
     VmMapper* GetVmMapper(const VmInfo& rVmInfo) const; //!< Get VmMapper by using VmInfo for lookup.
@@ -72,6 +74,7 @@ namespace Force {
     VmRegime* GetVmRegime(EVmRegimeType regimeType) const; //!< Return a VmRegime object.
     const VmContextInfo* GetVmContextInfo(uint32 contextId) const; //!< Retrieve VmContextInfo with the specified context ID.
     uint32 UpdateVmMapperCache(EVmRegimeType regimeType, VmMapper* pVmMapper); //!< add VmMapper to the cache.
+    bool GetContextFingerprint(std::vector<uint64>& rFingerprint) const; //!< Collect the context register values, return false if any of them is not fully initialized.
   protected:
     VmRegime* mpCurrentRegime; //!< Pointer to the current virtual memory regime.
     VmMapper* mpCurrentMapper; //!< Pointer to the current virtual memory mapper.
@@ -79,6 +82,8 @@ namespace Force {
     VmInfo* mpVmInfo; //!< VmInfo object used for querying.
     std::vector<VmRegime* > mVmRegimes; //!< Container for all VmRegime objects in the virtual memory system.
     std::map<uint32, const VmContextInfo* > mVmContextInfoCache; //!< Stores information to help lookup all VmContext objects.
+    std::vector<Register* > mContextRegisters; //!< Sorted union of the context registers of all VmRegime objects.
+    std::vector<uint64> mContextFingerprint; //!< Context register values the current regime was last activated with, empty if unknown.
   private:
     mutable std::map<EVmRegimeType, VmFactory*> mVmFactories; //!< Container of all VmFactories.  Not to be copied.
   };
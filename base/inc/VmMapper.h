@@ -92,6 +92,7 @@ namespace Force {
     virtual RegisterReload*       GetRegisterReload() const = 0; //!< Get register reload pointer
     virtual const AddressTagging* GetAddressTagging() const = 0; //!< Get address tagging object.
     virtual const ConstraintSet*  VirtualUsableConstraintSet(bool isInstr) const = 0; //!< Return const pointer to applicable virtual constraint object.
+    virtual bool                  VirtualUsableContainsRange(uint64 lower, uint64 upper, bool isInstr) const = 0; //!< Return true if a single applicable virtual usable range contains the whole address range.
     virtual const ConstraintSet*  VirtualSharedConstraintSet() const = 0; //!< Return const pointer to virtual shared constraint object.
     virtual const ConstraintSet*  GetVmConstraint(EVmConstraintType constrType) const = 0; //!< Obtaisn certain type of VM constraint.
     virtual const Page*           GetPage(uint64 VA) const = 0; //!< Return the page that contains the virtual address, if exists.
@@ -199,6 +200,7 @@ namespace Force {
     virtual RegisterReload* GetRegisterReload() const override; //!< Get register reload pointer.
     virtual const AddressTagging* GetAddressTagging() const override { return mpAddressTagging; } //!< Get address tagging object.
     virtual const ConstraintSet* VirtualUsableConstraintSet(bool isInstr) const override; //!< Return const pointer to applicable virtual constraint object.
+    virtual bool VirtualUsableContainsRange(uint64 lower, uint64 upper, bool isInstr) const override; //!< Return true if a single applicable virtual usable range contains the whole address range.
     virtual const ConstraintSet* VirtualSharedConstraintSet() const override; //!< Return const pointer to virtual shared constraint object.
     virtual const ConstraintSet* GetVmConstraint(EVmConstraintType constrType) const override; //!< Obtain VM constraint of the specified type.
     virtual const Page* GetPage(uint64 VA) const override { return nullptr; } //!< Return the page that contains the virtual address, if exists.
@@ -269,6 +271,7 @@ namespace Force {
     virtual const AddressTagging* GetAddressTagging() const override { return mpAddressTagging; } //!< Get address tagging object.
     virtual const ConstraintSet* GetVmConstraint(EVmConstraintType constrType) const override; //!< Obtain VM constraint of the specified type.
     virtual const ConstraintSet* VirtualUsableConstraintSet(bool isInstr) const override; //!< Return const pointer to applicable virtual constraint object.
+    virtual bool VirtualUsableContainsRange(uint64 lower, uint64 upper, bool isInstr) const override; //!< Return true if a single applicable virtual usable range contains the whole address range.
     virtual const ConstraintSet* VirtualSharedConstraintSet() const override; //!< Return const pointer to virtual shared constraint object.
     virtual const Page* GetPage(uint64 VA) const override; //!< Return the page that contains the virtual address, if exists.
     virtual ETranslationResultType TranslateVaToPa(uint64 VA, uint64& PA, uint32& bank) const override; //!< Translate VA to PA, return true if address is mapped.
@@ -55,6 +55,7 @@ namespace Force {
     bool Validate(std::string& rErrMsg) const override; //!< Return true only if all initialized context are valid.
 
     virtual bool InitializeRootPageTable(VmAddressSpace* pVmas, RootPageTable* pRootTable); //!< Initialize root page table.
+    virtual bool CompatiblePageTableContext(const VmasControlBlock* pOtherControlBlock) const; //!< Return true if the other control block's address space can use the same page tables.
 
     virtual GenPageRequest* PhysicalRegionPageRequest(const PhysicalRegion* pPhysRegion, bool& rRegionCompatible) const { return nullptr; }         //!< Return page-request object for a given physical region type.
     virtual uint32          PteShift()                                             const { return 0; }               //!< Return PTE shift based on PTE size.
@@ -0,0 +1,62 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef Force_WeightedPicker_H
+#define Force_WeightedPicker_H
+
+#include <vector>
+
+#include "Defines.h"
+
+namespace Force {
+
+  /*!
+    \class WeightedPicker
+    \brief Weighted tree of items compiled once and picked from repeatedly.
+
+    Each node holds weighted entries that are either leaves or child nodes; node 0 is the root. Picking draws one random value per
+    node visited, in the order the entries were added, so it follows the same random sequence as picking through the weighted dicts
+    the tree was compiled from.
+  */
+  class WeightedPicker {
+  public:
+    WeightedPicker() : mNodes() { } //!< Constructor.
+    COPY_CONSTRUCTOR_ABSENT(WeightedPicker);
+    ~WeightedPicker() { } //!< Destructor.
+    ASSIGNMENT_OPERATOR_ABSENT(WeightedPicker);
+
+    uint32 AddNode(); //!< Add an empty node and return its index.
+    void AddLeaf(uint32 nodeIndex, uint64 weight, uint32 leafIndex); //!< Add a leaf entry to the specified node.
+    void AddBranch(uint32 nodeIndex, uint64 weight, uint32 childIndex); //!< Add a child node entry to the specified node.
+    uint32 Pick() const; //!< Pick a leaf considering the weights along the way down from the root, return its leaf index.
+  private:
+    /*!
+      \struct WeightedEntry
+      \brief Entry of a node, keyed by the sum of the weights up to and including the entry.
+    */
+    struct WeightedEntry {
+      uint64 mWeightBound; //!< Sum of the weights of the entries up to and including this one.
+      uint32 mIndex; //!< Leaf index or child node index.
+      bool mIsLeaf; //!< Whether the entry is a leaf.
+    };
+
+    void AddEntry(uint32 nodeIndex, uint64 weight, uint32 index, bool isLeaf); //!< Add an entry to the specified node.
+  private:
+    std::vector<std::vector<WeightedEntry> > mNodes; //!< Entries of each node.
+  };
+
+}
+
+#endif  // Force_WeightedPicker_H
@@ -20,6 +20,7 @@
 
 #include "pybind11/pybind11.h"
 
+#include "ApiCallRecord.h"
 #include "Config.h"
 #include "Enums.h"
 #include "Log.h"
@@ -33,8 +34,8 @@ namespace Force {
     py::class_<Config, std::unique_ptr<Config, py::nodelete>>(mod, "Config")
       .def_static("getInstance", &Config::Instance, py::return_value_policy::reference, py::call_guard<ThreadContext>())
       .def("getLimitValue", &Config::LimitValue, py::call_guard<ThreadContext>())
-      .def("setGlobalState", &Config::SetGlobalStateValue, py::call_guard<ThreadContext>())
-      .def("setGlobalState", &Config::SetGlobalStateString, py::call_guard<ThreadContext>())
+      .def("setGlobalState", replayable_api("setGlobalStateValue", &Config::SetGlobalStateValue), py::call_guard<ThreadContext>())
+      .def("setGlobalState", replayable_api("setGlobalStateString", &Config::SetGlobalStateString), py::call_guard<ThreadContext>())
       .def("getGlobalState",
         [](const Config& rSelf, const EGlobalStateType globalStateType) -> py::object {
           bool exists = false;
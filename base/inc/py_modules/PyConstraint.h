@@ -20,59 +20,71 @@
 #include "pybind11/pybind11.h"
 
 #include "Constraint.h"
+#include "PyArrayUtils.h"
 #include "ThreadContext.h"
 
 namespace py = pybind11;
 
 namespace Force {
 
+  // The methods below that only operate on the objects they are called on are bound without a thread context call guard and don't go
+  // through the thread dispatcher.  Methods that use shared generator state, such as the random number generator, or that log an error
+  // when their arguments are invalid keep the call guard.
   PYBIND11_MODULE(Constraint, mod) {
     py::class_<Constraint>(mod, "Constraint");
 
     py::class_<ValueConstraint, Constraint>(mod, "ValueConstraint")
-      .def("lowerBound", &ValueConstraint::LowerBound, py::call_guard<ThreadContextNoAdvance>())
-      .def("upperBound", &ValueConstraint::UpperBound, py::call_guard<ThreadContextNoAdvance>())
+      .def("lowerBound", &ValueConstraint::LowerBound)
+      .def("upperBound", &ValueConstraint::UpperBound)
       ;
 
     py::class_<RangeConstraint, Constraint>(mod, "RangeConstraint")
-      .def("lowerBound", &RangeConstraint::LowerBound, py::call_guard<ThreadContextNoAdvance>())
-      .def("upperBound", &RangeConstraint::UpperBound, py::call_guard<ThreadContextNoAdvance>())
+      .def("lowerBound", &RangeConstraint::LowerBound)
+      .def("upperBound", &RangeConstraint::UpperBound)
       ;
 
     py::class_<ConstraintSet>(mod, "ConstraintSet")
-      .def(py::init<uint64, uint64>(), py::call_guard<ThreadContextNoAdvance>())
-      .def(py::init<uint64>(), py::call_guard<ThreadContextNoAdvance>())
+      .def(py::init<uint64, uint64>())
+      .def(py::init<uint64>())
       .def(py::init<std::string>(), py::call_guard<ThreadContextNoAdvance>())
-      .def(py::init(), py::call_guard<ThreadContextNoAdvance>())
+      .def(py::init())
       .def(py::init([](const ConstraintSet& rOther) {  // Defines copy constructor
           return rOther.Clone();
-        }),
-        py::call_guard<ThreadContextNoAdvance>())
-      .def(py::self == py::self, py::call_guard<ThreadContextNoAdvance>())  // Binds operator ==
-      .def(py::self != py::self, py::call_guard<ThreadContextNoAdvance>())  // Binds operator !=
-      .def("isEmpty", &ConstraintSet::IsEmpty, py::call_guard<ThreadContextNoAdvance>())
-      .def("clear", &ConstraintSet::Clear, py::call_guard<ThreadContextNoAdvance>())
-      .def("size", &ConstraintSet::Size, py::call_guard<ThreadContextNoAdvance>())
+        }))
+      .def(py::self == py::self)  // Binds operator ==
+      .def(py::self != py::self)  // Binds operator !=
+      .def("isEmpty", &ConstraintSet::IsEmpty)
+      .def("clear", &ConstraintSet::Clear)
+      .def("size", &ConstraintSet::Size)
       .def("lowerBound", &ConstraintSet::LowerBound, py::call_guard<ThreadContextNoAdvance>())
       .def("upperBound", &ConstraintSet::UpperBound, py::call_guard<ThreadContextNoAdvance>())
       .def("chooseValue", &ConstraintSet::ChooseValue, py::call_guard<ThreadContextNoAdvance>())
-      .def("intersects", &ConstraintSet::Intersects, py::call_guard<ThreadContextNoAdvance>())
-      .def("addRange", &ConstraintSet::AddRange, py::call_guard<ThreadContextNoAdvance>())
-      .def("addValue", &ConstraintSet::AddValue, py::call_guard<ThreadContextNoAdvance>())
-      .def("subRange", &ConstraintSet::SubRange, py::call_guard<ThreadContextNoAdvance>())
-      .def("subValue", &ConstraintSet::SubValue, py::call_guard<ThreadContextNoAdvance>())
-      .def("subConstraintSet", &ConstraintSet::SubConstraintSet, py::call_guard<ThreadContextNoAdvance>())
+      .def("chooseValues", [](const ConstraintSet& rConstrSet, uint64 count, uint64 align, bool unique) {
+          std::vector<uint64> values;
+          {
+            ThreadContextNoAdvance thread_context;
+            rConstrSet.ChooseValues(count, align, unique, values);
+          }
+          return to_py_uint64_array(values);
+        },
+        py::arg("aCount"), py::arg("aAlign") = 1, py::arg("aUnique") = false)
+      .def("intersects", &ConstraintSet::Intersects)
+      .def("addRange", &ConstraintSet::AddRange)
+      .def("addValue", &ConstraintSet::AddValue)
+      .def("subRange", &ConstraintSet::SubRange)
+      .def("subValue", &ConstraintSet::SubValue)
+      .def("subConstraintSet", &ConstraintSet::SubConstraintSet)
       .def("applyConstraintSet", &ConstraintSet::ApplyConstraintSet, py::call_guard<ThreadContextNoAdvance>())
       .def("mergeConstraintSet", &ConstraintSet::MergeConstraintSet, py::call_guard<ThreadContextNoAdvance>())
-      .def("containsValue", &ConstraintSet::ContainsValue, py::call_guard<ThreadContextNoAdvance>())
-      .def("containsRange", &ConstraintSet::ContainsRange, py::call_guard<ThreadContextNoAdvance>())
-      .def("containsConstraintSet", &ConstraintSet::ContainsConstraintSet, py::call_guard<ThreadContextNoAdvance>())
-      .def("shiftRight", &ConstraintSet::ShiftRight, py::call_guard<ThreadContextNoAdvance>())
+      .def("containsValue", &ConstraintSet::ContainsValue)
+      .def("containsRange", &ConstraintSet::ContainsRange)
+      .def("containsConstraintSet", &ConstraintSet::ContainsConstraintSet)
+      .def("shiftRight", &ConstraintSet::ShiftRight)
       .def("alignWithSize", &ConstraintSet::AlignWithSize, py::call_guard<ThreadContextNoAdvance>())
       .def("alignOffsetWithSize", &ConstraintSet::AlignOffsetWithSize, py::call_guard<ThreadContextNoAdvance>())
       .def("alignWithPage", &ConstraintSet::AlignWithPage, py::call_guard<ThreadContextNoAdvance>())
-      .def("getConstraints", &ConstraintSet::GetConstraints, py::return_value_policy::reference, py::call_guard<ThreadContextNoAdvance>())
-      .def("__str__", &ConstraintSet::ToSimpleString, py::call_guard<ThreadContextNoAdvance>())  // Allows conversion with Python str() method
+      .def("getConstraints", &ConstraintSet::GetConstraints, py::return_value_policy::reference)
+      .def("__str__", &ConstraintSet::ToSimpleString)  // Allows conversion with Python str() method
       ;
   }
 
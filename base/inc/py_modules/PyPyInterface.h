@@ -18,6 +18,7 @@
 
 #include "pybind11/pybind11.h"
 
+#include "ApiCallRecord.h"
 #include "PyInterface.h"
 #include "ThreadContext.h"
 
@@ -29,65 +30,72 @@ namespace Force {
     mod.doc() = "Force backend library interface plugin";
 
     py::class_<PyInterface>(mod, "Interface")
-      .def("numberOfChips", &PyInterface::NumberOfChips /* No call guard because used when initializing environment, prior to creating thread dispatcher */)
-      .def("numberOfCores", &PyInterface::NumberOfCores /* No call guard because used when initializing environment, prior to creating thread dispatcher */)
-      .def("numberOfThreads", &PyInterface::NumberOfThreads /* No call guard because used when initializing environment, prior to creating thread dispatcher */)
-      .def("createGeneratorThread", &PyInterface::CreateGeneratorThread /* No call guard because used when initializing environment, prior to creating thread dispatcher */)
-      .def("genInstruction", &PyInterface::GenInstruction, py::call_guard<ThreadContext>())
-      .def("genMetaInstruction", &PyInterface::GenMetaInstruction, py::call_guard<ThreadContext>())
-      .def("initializeMemory", &PyInterface::InitializeMemory, py::call_guard<ThreadContext>())
-      .def("addChoicesModification", &PyInterface::AddChoicesModification, py::call_guard<ThreadContext>())
-      .def("commitModificationSet",  &PyInterface::CommitModificationSet, py::call_guard<ThreadContext>())
-      .def("revertModificationSet",  &PyInterface::RevertModificationSet, py::call_guard<ThreadContext>())
-      .def("genPA", &PyInterface::GenPA, py::call_guard<ThreadContext>())
-      .def("genVA", &PyInterface::GenVA, py::call_guard<ThreadContext>())
-      .def("genVMVA", &PyInterface::GenVMVA, py::call_guard<ThreadContext>())
-      .def("genVAforPA", &PyInterface::GenVAforPA, py::call_guard<ThreadContext>())
-      .def("genFreePagesRange", &PyInterface::GenFreePagesRange, py::call_guard<ThreadContext>())
-      .def("sample", &PyInterface::Sample, py::call_guard<ThreadContext>())
-      .def("getRandomRegisters", &PyInterface::GetRandomRegisters, py::call_guard<ThreadContext>())
-      .def("getRandomRegistersForAccess", &PyInterface::GetRandomRegistersForAccess, py::call_guard<ThreadContext>())
-      .def("isRegisterReserved", &PyInterface::IsRegisterReserved, py::call_guard<ThreadContext>())
-      .def("reserveRegisterByIndex", &PyInterface::ReserveRegisterByIndex, py::call_guard<ThreadContext>())
-      .def("reserveRegister", &PyInterface::ReserveRegister, py::call_guard<ThreadContext>())
-      .def("unreserveRegisterByIndex", &PyInterface::UnreserveRegisterByIndex, py::call_guard<ThreadContext>())
-      .def("unreserveRegister", &PyInterface::UnreserveRegister, py::call_guard<ThreadContext>())
-      .def("readRegister", &PyInterface::ReadRegister, py::call_guard<ThreadContext>())
-      .def("writeRegister", &PyInterface::WriteRegister, py::call_guard<ThreadContext>())
-      .def("initializeRegister", &PyInterface::InitializeRegister, py::call_guard<ThreadContext>())
-      .def("initializeRegisterFields", &PyInterface::InitializeRegisterFields, py::call_guard<ThreadContext>())
-      .def("randomInitializeRegister", &PyInterface::RandomInitializeRegister, py::call_guard<ThreadContext>())
-      .def("randomInitializeRegisterFields", &PyInterface::RandomInitializeRegisterFields, py::call_guard<ThreadContext>())
-      .def("getRegisterFieldMask", &PyInterface::GetRegisterFieldMask, py::call_guard<ThreadContext>())
-      .def("genSequence", &PyInterface::GenSequence, py::call_guard<ThreadContext>())
-      .def("addMemoryRange", &PyInterface::AddMemoryRange /* No call guard because used when initializing environment, prior to creating thread dispatcher */)
-      .def("subMemoryRange", &PyInterface::SubMemoryRange /* No call guard because used when initializing environment, prior to creating thread dispatcher */)
-      .def("addArchitectureMemoryAttributes", &PyInterface::AddArchitectureMemoryAttributes, py::arg(), py::arg(), py::arg(), py::arg(), py::arg("thread_id") = 0 /* No call guard because used when initializing environment, prior to creating thread dispatcher */)
-      .def("addImplementationMemoryAttributes", &PyInterface::AddImplementationMemoryAttributes, py::arg(), py::arg(), py::arg(), py::arg(), py::arg("thread_id") = 0 /* No call guard because used when initializing environment, prior to creating thread dispatcher */)
-      .def("getOption", &PyInterface::GetOption, py::call_guard<ThreadContext>())
-      .def("query", &PyInterface::Query, py::call_guard<ThreadContext>())
-      .def("virtualMemoryRequest", &PyInterface::VirtualMemoryRequest, py::call_guard<ThreadContext>())
-      .def("stateRequest", &PyInterface::StateRequest, py::call_guard<ThreadContext>())
-      .def("reserveMemory", &PyInterface::ReserveMemory, py::call_guard<ThreadContext>())
-      .def("unreserveMemory", &PyInterface::UnreserveMemory, py::call_guard<ThreadContext>())
-      .def("exceptionRequest", &PyInterface::ExceptionRequest, py::call_guard<ThreadContext>())
-      .def("beginStateRestoreLoop", &PyInterface::BeginStateRestoreLoop, py::call_guard<ThreadContext>())
-      .def("endStateRestoreLoop", &PyInterface::EndStateRestoreLoop, py::call_guard<ThreadContext>())
-      .def("generateLoopRestoreInstructions", &PyInterface::GenerateLoopRestoreInstructions, py::call_guard<ThreadContext>())
-      .def("modifyVariable", &PyInterface::ModifyVariable, py::call_guard<ThreadContext>())
-      .def("getVariable", &PyInterface::GetVariable, py::call_guard<ThreadContext>())
-      .def("registerModificationSet", &PyInterface::RegisterModificationSet, py::call_guard<ThreadContext>())
-      .def("verifyVirtualAddress", &PyInterface::VerifyVirtualAddress, py::call_guard<ThreadContext>())
+      .def("numberOfChips", replayable_api("numberOfChips", &PyInterface::NumberOfChips) /* No call guard because used when initializing environment, prior to creating thread dispatcher */)
+      .def("numberOfCores", replayable_api("numberOfCores", &PyInterface::NumberOfCores) /* No call guard because used when initializing environment, prior to creating thread dispatcher */)
+      .def("numberOfThreads", replayable_api("numberOfThreads", &PyInterface::NumberOfThreads) /* No call guard because used when initializing environment, prior to creating thread dispatcher */)
+      .def("createGeneratorThread", replayable_api("createGeneratorThread", &PyInterface::CreateGeneratorThread) /* No call guard because used when initializing environment, prior to creating thread dispatcher */)
+      .def("genInstruction", replayable_api("genInstruction", &PyInterface::GenInstruction), py::call_guard<ThreadContext>())
+      .def("genMetaInstruction", replayable_api("genMetaInstruction", &PyInterface::GenMetaInstruction), py::call_guard<ThreadContext>())
+      .def("initializeMemory", replayable_api("initializeMemory", &PyInterface::InitializeMemory), py::call_guard<ThreadContext>())
+      .def("addChoicesModification", replayable_api("addChoicesModification", &PyInterface::AddChoicesModification), py::call_guard<ThreadContext>())
+      .def("commitModificationSet", replayable_api("commitModificationSet", &PyInterface::CommitModificationSet), py::call_guard<ThreadContext>())
+      .def("revertModificationSet", replayable_api("revertModificationSet", &PyInterface::RevertModificationSet), py::call_guard<ThreadContext>())
+      .def("genPA", replayable_api("genPA", &PyInterface::GenPA), py::call_guard<ThreadContext>())
+      .def("genVA", replayable_api("genVA", &PyInterface::GenVA), py::call_guard<ThreadContext>())
+      .def("genVMVA", replayable_api("genVMVA", &PyInterface::GenVMVA), py::call_guard<ThreadContext>())
+      .def("genVAforPA", replayable_api("genVAforPA", &PyInterface::GenVAforPA), py::call_guard<ThreadContext>())
+      .def("genFreePagesRange", replayable_api("genFreePagesRange", &PyInterface::GenFreePagesRange), py::call_guard<ThreadContext>())
+      .def("sample", replayable_api("sample", &PyInterface::Sample), py::call_guard<ThreadContext>())
+      .def("getRandomRegisters", replayable_api("getRandomRegisters", &PyInterface::GetRandomRegisters), py::call_guard<ThreadContext>())
+      .def("getRandomRegistersForAccess", replayable_api("getRandomRegistersForAccess", &PyInterface::GetRandomRegistersForAccess), py::call_guard<ThreadContext>())
+      .def("isRegisterReserved", replayable_api("isRegisterReserved", &PyInterface::IsRegisterReserved), py::call_guard<ThreadContext>())
+      .def("reserveRegisterByIndex", replayable_api("reserveRegisterByIndex", &PyInterface::ReserveRegisterByIndex), py::call_guard<ThreadContext>())
+      .def("reserveRegister", replayable_api("reserveRegister", &PyInterface::ReserveRegister), py::call_guard<ThreadContext>())
+      .def("unreserveRegisterByIndex", replayable_api("unreserveRegisterByIndex", &PyInterface::UnreserveRegisterByIndex), py::call_guard<ThreadContext>())
+      .def("unreserveRegister", replayable_api("unreserveRegister", &PyInterface::UnreserveRegister), py::call_guard<ThreadContext>())
+      .def("readRegister", replayable_api("readRegister", &PyInterface::ReadRegister), py::call_guard<ThreadContext>())
+      .def("writeRegister", replayable_api("writeRegister", &PyInterface::WriteRegister), py::call_guard<ThreadContext>())
+      .def("initializeRegister", replayable_api("initializeRegister", &PyInterface::InitializeRegister), py::call_guard<ThreadContext>())
+      .def("initializeRegisterFields", replayable_api("initializeRegisterFields", &PyInterface::InitializeRegisterFields), py::call_guard<ThreadContext>())
+      .def("randomInitializeRegister", replayable_api("randomInitializeRegister", &PyInterface::RandomInitializeRegister), py::call_guard<ThreadContext>())
+      .def("randomInitializeRegisterFields", replayable_api("randomInitializeRegisterFields", &PyInterface::RandomInitializeRegisterFields), py::call_guard<ThreadContext>())
+      .def("getRegisterFieldMask", replayable_api("getRegisterFieldMask", &PyInterface::GetRegisterFieldMask), py::call_guard<ThreadContext>())
+      .def("genSequence", replayable_api("genSequence", &PyInterface::GenSequence), py::call_guard<ThreadContext>())
+      .def("addMemoryRange", replayable_api("addMemoryRange", &PyInterface::AddMemoryRange) /* No call guard because used when initializing environment, prior to creating thread dispatcher */)
+      .def("subMemoryRange", replayable_api("subMemoryRange", &PyInterface::SubMemoryRange) /* No call guard because used when initializing environment, prior to creating thread dispatcher */)
+      .def("addArchitectureMemoryAttributes", replayable_api("addArchitectureMemoryAttributes", &PyInterface::AddArchitectureMemoryAttributes), py::arg(), py::arg(), py::arg(), py::arg(), py::arg("thread_id") = 0 /* No call guard because used when initializing environment, prior to creating thread dispatcher */)
+      .def("addImplementationMemoryAttributes", replayable_api("addImplementationMemoryAttributes", &PyInterface::AddImplementationMemoryAttributes), py::arg(), py::arg(), py::arg(), py::arg(), py::arg("thread_id") = 0 /* No call guard because used when initializing environment, prior to creating thread dispatcher */)
+      .def("getOption", replayable_api("getOption", &PyInterface::GetOption), py::call_guard<ThreadContext>())
+      .def("query", replayable_api("query", &PyInterface::Query), py::call_guard<ThreadContext>())
+      .def("virtualMemoryRequest", replayable_api("virtualMemoryRequest", &PyInterface::VirtualMemoryRequest), py::call_guard<ThreadContext>())
+      .def("stateRequest", replayable_api("stateRequest", &PyInterface::StateRequest), py::call_guard<ThreadContext>())
+      .def("reserveMemory", replayable_api("reserveMemory", &PyInterface::ReserveMemory), py::call_guard<ThreadContext>())
+      .def("unreserveMemory", replayable_api("unreserveMemory", &PyInterface::UnreserveMemory), py::call_guard<ThreadContext>())
+      .def("exceptionRequest", replayable_api("exceptionRequest", &PyInterface::ExceptionRequest), py::call_guard<ThreadContext>())
+      .def("beginStateRestoreLoop", replayable_api("beginStateRestoreLoop", &PyInterface::BeginStateRestoreLoop), py::call_guard<ThreadContext>())
+      .def("endStateRestoreLoop", replayable_api("endStateRestoreLoop", &PyInterface::EndStateRestoreLoop), py::call_guard<ThreadContext>())
+      .def("generateLoopRestoreInstructions", replayable_api("generateLoopRestoreInstructions", &PyInterface::GenerateLoopRestoreInstructions), py::call_guard<ThreadContext>())
+      .def("modifyVariable", replayable_api("modifyVariable", &PyInterface::ModifyVariable), py::call_guard<ThreadContext>())
+      .def("getVariable", replayable_api("getVariable", &PyInterface::GetVariable), py::call_guard<ThreadContext>())
+      .def("registerModificationSet", replayable_api("registerModificationSet", &PyInterface::RegisterModificationSet), py::call_guard<ThreadContext>())
+      .def("verifyVirtualAddress", replayable_api("verifyVirtualAddress", &PyInterface::VerifyVirtualAddress), py::call_guard<ThreadContext>())
       // Multi-threading APIs
-      .def("partitionThreadGroup", &PyInterface::PartitionThreadGroup, py::call_guard<ThreadContext>())
-      .def("setThreadGroup", &PyInterface::SetThreadGroup, py::call_guard<ThreadContext>())
-      .def("queryThreadGroup", &PyInterface::QueryThreadGroup, py::call_guard<ThreadContext>())
-      .def("getThreadGroupId", &PyInterface::GetThreadGroupId, py::call_guard<ThreadContext>())
-      .def("getFreeThreads", &PyInterface::GetFreeThreads, py::call_guard<ThreadContext>())
-      .def("lockThreadScheduler", &PyInterface::LockThreadScheduler, py::call_guard<ThreadContext>())
-      .def("unlockThreadScheduler", &PyInterface::UnlockThreadScheduler, py::call_guard<ThreadContext>())
-      .def("genSemaphore", &PyInterface::GenSemaphore, py::call_guard<ThreadContext>())
-      .def("synchronizeWithBarrier", &PyInterface::SynchronizeWithBarrier, py::call_guard<ThreadContext>())
+      .def("partitionThreadGroup", replayable_api("partitionThreadGroup", &PyInterface::PartitionThreadGroup), py::call_guard<ThreadContext>())
+      .def("setThreadGroup", replayable_api("setThreadGroup", &PyInterface::SetThreadGroup), py::call_guard<ThreadContext>())
+      .def("queryThreadGroup", replayable_api("queryThreadGroup", &PyInterface::QueryThreadGroup), py::call_guard<ThreadContext>())
+      .def("getThreadGroupId", replayable_api("getThreadGroupId", &PyInterface::GetThreadGroupId), py::call_guard<ThreadContext>())
+      .def("getFreeThreads", replayable_api("getFreeThreads", &PyInterface::GetFreeThreads), py::call_guard<ThreadContext>())
+      .def("lockThreadScheduler", replayable_api("lockThreadScheduler", &PyInterface::LockThreadScheduler), py::call_guard<ThreadContext>())
+      .def("unlockThreadScheduler", replayable_api("unlockThreadScheduler", &PyInterface::UnlockThreadScheduler), py::call_guard<ThreadContext>())
+      .def("genSemaphore", replayable_api("genSemaphore", &PyInterface::GenSemaphore), py::call_guard<ThreadContext>())
+      .def("synchronizeWithBarrier", replayable_api("synchronizeWithBarrier", &PyInterface::SynchronizeWithBarrier), py::call_guard<ThreadContext>())
+      // Independent segment APIs: prepareSegmentFork returns false when API calls are recorded, so the segments are generated in sequence
+      // and the other segment APIs, which fail when recording, are never called.
+      .def("prepareSegmentFork", replayable_api("prepareSegmentFork", &PyInterface::PrepareSegmentFork), py::call_guard<ThreadContext>())
+      .def("beginSegment", &PyInterface::BeginSegment, py::call_guard<ThreadContext>())
+      .def("endSegment", &PyInterface::EndSegment, py::call_guard<ThreadContext>())
+      .def("importSegment", &PyInterface::ImportSegment, py::call_guard<ThreadContext>())
+      .def("importSegmentState", &PyInterface::ImportSegmentState, py::call_guard<ThreadContext>())
       ;
   }
 
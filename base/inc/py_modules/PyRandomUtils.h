@@ -18,8 +18,10 @@
 
 #include "pybind11/pybind11.h"
 
+#include "PyArrayUtils.h"
 #include "RandomUtils.h"
 #include "ThreadContext.h"
+#include "WeightedPicker.h"
 
 namespace py = pybind11;
 
@@ -29,8 +31,25 @@ namespace Force {
     mod
       .def("random32", &random_value32, py::arg("aMin") = 0, py::arg("aMax") = MAX_UINT32, py::call_guard<ThreadContext>())
       .def("random64", &random_value64, py::arg("aMin") = 0, py::arg("aMax") = MAX_UINT64, py::call_guard<ThreadContext>())
+      .def("randomValues64", [](uint64 count, uint64 min, uint64 max, uint64 align, bool unique) {
+          std::vector<uint64> values;
+          {
+            ThreadContext thread_context;
+            random_values64(min, max, count, align, unique, values);
+          }
+          return to_py_uint64_array(values);
+        },
+        py::arg("aCount"), py::arg("aMin") = 0, py::arg("aMax") = MAX_UINT64, py::arg("aAlign") = 1, py::arg("aUnique") = false)
       .def("randomReal", &random_real, py::arg("aMin") = 0.0, py::arg("aMax") = 1.0, py::call_guard<ThreadContext>())
       ;
+
+    py::class_<WeightedPicker>(mod, "WeightedPicker")
+      .def(py::init<>())
+      .def("addNode", &WeightedPicker::AddNode)
+      .def("addLeaf", &WeightedPicker::AddLeaf)
+      .def("addBranch", &WeightedPicker::AddBranch)
+      .def("pick", &WeightedPicker::Pick, py::call_guard<ThreadContext>())
+      ;
   }
 
 }
@@ -19,6 +19,7 @@
 #include "pybind11/pybind11.h"
 #include "pybind11/stl.h"
 
+#include "ApiCallRecord.h"
 #include "GenRequest.h"
 #include "Generator.h"
 #include "Scheduler.h"
@@ -35,6 +36,16 @@ namespace Force {
 
     std::vector<EStateElementType> empty_elem_type_order;
 
+    auto set_default_order_mode = [](cuint32 threadId, const EStateTransitionType stateTransType, const EStateTransitionOrderMode orderMode, const std::vector<EStateElementType>& rStateElemTypeOrder) {
+      StateTransitionManagerRepository* state_trans_manager_repo = StateTransitionManagerRepository::Instance();
+      StateTransitionManager* state_trans_manager = state_trans_manager_repo->GetStateTransitionManager(threadId);
+      state_trans_manager->SetDefaultStateTransitionOrderMode(stateTransType, orderMode, rStateElemTypeOrder);
+    };
+
+    ApiCallReplayer::RegisterApi("setDefaultStateTransitionOrderMode", [set_default_order_mode](PyInterface& rInterface, const py::tuple& rArgs) {
+        set_default_order_mode(rArgs[0].cast<uint32>(), rArgs[1].cast<EStateTransitionType>(), rArgs[2].cast<EStateTransitionOrderMode>(), rArgs[3].cast<std::vector<EStateElementType>>());
+      });
+
     mod
       .def("registerStateTransitionHandler",
         [](const py::object stateTransHandler, const EStateTransitionType stateTransType, const std::vector<EStateElementType>& rStateElemTypes) {
@@ -53,12 +64,18 @@ namespace Force {
           state_trans_manager->SetDefaultStateTransitionHandler(stateTransHandler, stateElemType);
         })
       .def("setDefaultStateTransitionOrderMode",
-        [](const EStateTransitionType stateTransType, const EStateTransitionOrderMode orderMode, const std::vector<EStateElementType>& rStateElemTypeOrder) {
+        [set_default_order_mode](const EStateTransitionType stateTransType, const EStateTransitionOrderMode orderMode, const std::vector<EStateElementType>& rStateElemTypeOrder) {
           ThreadContext thread_context;
 
-          StateTransitionManagerRepository* state_trans_manager_repo = StateTransitionManagerRepository::Instance();
-          StateTransitionManager* state_trans_manager = state_trans_manager_repo->GetStateTransitionManager(thread_context.GetThreadId());
-          state_trans_manager->SetDefaultStateTransitionOrderMode(stateTransType, orderMode, rStateElemTypeOrder);
+          uint32 thread_id = thread_context.GetThreadId();
+          ApiCallRecorder* recorder = Scheduler::Instance()->GetPyInterface()->GetApiCallRecorder();
+          if (nullptr != recorder) {
+            ApiCallScope call_scope(recorder, "setDefaultStateTransitionOrderMode", py::make_tuple(thread_id, stateTransType, orderMode, rStateElemTypeOrder));
+            set_default_order_mode(thread_id, stateTransType, orderMode, rStateElemTypeOrder);
+          }
+          else {
+            set_default_order_mode(thread_id, stateTransType, orderMode, rStateElemTypeOrder);
+          }
         },
         py::arg(), py::arg(), py::arg("aStateElemTypeOrder") = empty_elem_type_order)
       .def("transitionToState",
@@ -66,6 +83,11 @@ namespace Force {
           ThreadContext thread_context;
 
           Scheduler* scheduler = Scheduler::Instance();
+          ApiCallRecorder* recorder = scheduler->GetPyInterface()->GetApiCallRecorder();
+          if (nullptr != recorder) {
+            recorder->RecordUnsupported("transitionToState"); // State objects are built by the front end.
+          }
+
           Generator* generator = scheduler->LookUpGenerator(thread_context.GetThreadId());
           generator->GenSequence(new GenStateTransitionRequest(&rState, EStateTransitionType::Explicit, orderMode, rStateElemTypeOrder));
         },
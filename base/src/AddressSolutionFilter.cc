@@ -266,6 +266,15 @@ namespace Force {
     return any_filtered;
   }
 
+  bool SpAlignmentFilter::FilterOnSolution(const Instruction& rInstr, const AddressingMode& rMode) const
+  {
+    if (not (mPreventHard or rInstr.AlignedSP())) {
+      return false;
+    }
+
+    return (not rMode.ShouldApplyIndexFilters()) and (rMode.Base()->RegisterType() == ERegisterType::SP);
+  }
+
   bool SpAlignmentFilter::FilterSolutions(AddressSolver& rAddrSolver, const Instruction& rInstr, uint32& rRemainder) const
   {
     vector<AddressingMode* >& ref_solutions = rAddrSolver.GetSolutionChoicesForFiltering();
@@ -1560,34 +1560,148 @@ namespace {
       return nullptr;
     }
 
+    // Modes with index solutions are filtered per index solution, so all of their solutions are needed before choosing.
+    if (not mpModeTemplate->ShouldApplyIndexFilters()) {
+      SampleSolution(gen, instr, rModes);
+      return mpChosenSolution;
+    }
+
+    for (auto mode : rModes) {
+      if (SolveMode(mode)) {
+        LOG(info) << "{AddressSolver::SolveWithModes} choice: " << mode->ToString() << endl;
+        mSolutionChoices.push_back(mode);
+        continue;
+      }
+      delete mode;
+    }
+
+    // try to set address shortage flag.
+    UpdateAddressShortage(gen, instr, mSolutionChoices.size());
+
+    ChooseSolution(gen, instr);
+    return mpChosenSolution;
+  }
+
+  bool AddressSolver::SolveMode(AddressingMode* pMode) const
+  {
+    if (pMode->IsFree()) {
+      return pMode->SolveFree(*mpAddressSolvingShared);
+    }
+
+    return pMode->Solve(*mpAddressSolvingShared);
+  }
+
+  void AddressSolver::SampleSolution(const Generator& rGen, const Instruction& rInstr, const vector<AddressingMode* >& rModes)
+  {
+    vector<AddressSolutionFilter* > filter_vec;
+    rGen.GetAddressFilteringRegulator()->GetAddressSolutionFilters(*mpModeTemplate, filter_vec);
+
+    // The filters are applied to solved values only: the modes whose solution a filter reads are solved before filtering, the others are
+    // filtered by their base register and only solved once drawn.
+    set<AddressingMode* > solved_modes;
     for (auto mode : rModes) {
-      if (mode->IsFree()) {
-        if (mode->SolveFree(*mpAddressSolvingShared)) {
-          LOG(info) << "{AddressSolver::SolveWithModes} choice: " << mode->ToString() << endl;
-          mSolutionChoices.push_back(mode);
+      bool filter_on_solution = any_of(filter_vec.cbegin(), filter_vec.cend(),
+        [&rInstr, mode](const AddressSolutionFilter* pFilter) { return pFilter->FilterOnSolution(rInstr, *mode); });
+
+      if (filter_on_solution) {
+        if (not SolveMode(mode)) {
+          delete mode;
           continue;
         }
-      } else {
-        if (mode->Solve(*mpAddressSolvingShared)) {
-          LOG(info) << "{AddressSolver::SolveWithModes} choice: " << mode->ToString() << endl;
-          mSolutionChoices.push_back(mode);
-          continue;
+        solved_modes.insert(mode);
+      }
+      mSolutionChoices.push_back(mode);
+    }
+
+    // Each filter that narrows the choices leaves a less preferred tier behind, which is only drawn from once the preferred tiers have no
+    // usable solution.
+    vector<vector<AddressingMode* > > mode_tiers;
+    for (auto addr_filter : filter_vec) {
+      uint32 num_remain = 0;
+      if (not addr_filter->FilterSolutions(*this, rInstr, num_remain)) {
+        continue; // no change with the filter, continue to the next filter.
+      }
+
+      if (0 == num_remain) {
+        mSolutionChoices.swap(mFilteredChoices);
+        break;
+      }
+
+      mode_tiers.push_back(mFilteredChoices);
+      mFilteredChoices.clear();
+    }
+
+    mode_tiers.push_back(mSolutionChoices);
+    mSolutionChoices.clear();
+    reverse(mode_tiers.begin(), mode_tiers.end());
+
+    // Drawing without replacement and keeping the first usable solution chooses among the solvable modes in proportion to their
+    // weights, the same as solving every mode and then choosing, without solving the modes that are never drawn.
+    bool shortage_checked = false;
+    AddressingMode* chosen_mode = draw_weighted_item(mode_tiers, [&](AddressingMode* pMode) {
+        if ((solved_modes.erase(pMode) == 0) and (not SolveMode(pMode))) {
+          delete pMode;
+          return false;
+        }
+
+        if (not shortage_checked) {
+          uint32 num_solutions = 1;
+          if (ShouldEnableAddressShortage(rInstr, num_solutions)) {
+            num_solutions = CountSolutions(mode_tiers, solved_modes);
+          }
+          UpdateAddressShortage(rGen, rInstr, num_solutions);
+          shortage_checked = true;
         }
+
+        if (SolutionUsable(*pMode)) {
+          LOG(info) << "{AddressSolver::SampleSolution} choice: " << pMode->ToString() << endl;
+          return true;
+        }
+
+        delete pMode;
+        return false;
+      });
+
+    if (not shortage_checked) {
+      UpdateAddressShortage(rGen, rInstr, 0);
+    }
+
+    for (auto& tier_modes : mode_tiers) {
+      for (auto mode : tier_modes) {
+        delete mode;
       }
-      delete mode;
     }
 
-    // try to set address shortage flag.
-    if (ShouldEnableAddressShortage(instr)) {
-      auto gen_mode = gen.GetGenMode();
+    if (nullptr != chosen_mode) {
+      mSolutionChoices.push_back(chosen_mode);
+      mpChosenSolution = chosen_mode;
+    }
+  }
 
-      if (not gen_mode->IsAddressShortage()) {
-        gen_mode->EnableGenMode(EGenModeTypeBaseType(EGenModeType::AddressShortage));
+  uint32 AddressSolver::CountSolutions(vector<vector<AddressingMode* > >& rModeTiers, set<AddressingMode* >& rSolvedModes) const
+  {
+    // One solution has already been found, so only look for a second one.
+    uint32 num_solutions = 1;
+    for (auto& tier_modes : rModeTiers) {
+      for (auto mode_iter = tier_modes.begin(); mode_iter != tier_modes.end(); ) {
+        if (num_solutions > 1) {
+          return num_solutions;
+        }
+
+        AddressingMode* mode = *mode_iter;
+        if ((rSolvedModes.count(mode) > 0) or SolveMode(mode)) {
+          rSolvedModes.insert(mode);
+          ++ num_solutions;
+          ++ mode_iter;
+        }
+        else {
+          delete mode;
+          mode_iter = tier_modes.erase(mode_iter);
+        }
       }
     }
 
-    ChooseSolution(gen, instr);
-    return mpChosenSolution;
+    return num_solutions;
   }
 
   bool AddressSolver::GetAvailableBaseChoices(Generator& gen, Instruction& instr, vector<AddressingMode* >& rBaseChoices) const
@@ -1787,6 +1901,19 @@ namespace {
     return false;
   }
 
+  bool AddressSolver::SolutionUsable(AddressingMode& rMode) const
+  {
+    if (not rMode.ChooseSolution(*mpAddressSolvingShared)) {
+      return false;
+    }
+
+    vector<uint64> target_addresses;
+    GetTargetAddresses(*mpAddressSolvingShared, rMode, target_addresses);
+
+    return all_of(target_addresses.cbegin(), target_addresses.cend(),
+      [this, &rMode](cuint64 targetAddr) { return mpAddressSolvingShared->MapTargetAddressRange(targetAddr, rMode.VmTimeStampReference()); });
+  }
+
   bool AddressSolver::IsRegisterUsable(const Register* regPtr, cbool hasIss) const
   {
     bool usable = false;
@@ -1817,7 +1944,7 @@ namespace {
 
   // We want to enable address shortage mode if we only have one solution for a load or store
   // instruction that wasn't forced by constraints or by the instruction format.
-  bool AddressSolver::ShouldEnableAddressShortage(const Instruction& instr) const
+  bool AddressSolver::ShouldEnableAddressShortage(const Instruction& instr, uint32 numSolutions) const
   {
     bool enable_addr_shortage = true;
 
@@ -1829,7 +1956,7 @@ namespace {
     if (not instr.IsLoadStore()) {
       enable_addr_shortage = false;
     }
-    else if (mSolutionChoices.size() > 1) {
+    else if (numSolutions > 1) {
       enable_addr_shortage = false;
     }
     else if (constraint->ConstraintForced()) {
@@ -1845,6 +1972,17 @@ namespace {
     return enable_addr_shortage;
   }
 
+  void AddressSolver::UpdateAddressShortage(const Generator& rGen, const Instruction& rInstr, uint32 numSolutions) const
+  {
+    if (ShouldEnableAddressShortage(rInstr, numSolutions)) {
+      auto gen_mode = rGen.GetGenMode();
+
+      if (not gen_mode->IsAddressShortage()) {
+        gen_mode->EnableGenMode(EGenModeTypeBaseType(EGenModeType::AddressShortage));
+      }
+    }
+  }
+
   bool AddressSolverWithOnlyChoice::GetAvailableBaseChoices(Generator& gen, Instruction& instr, std::vector<AddressingMode* >& rBaseChoices) const
   {
     auto cast_opr = dynamic_cast<const ImpliedRegisterOperand *> (mpBaseOperand);
@@ -0,0 +1,379 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "ApiCallRecord.h"
+
+#include <sstream>
+
+#include "Constraint.h"
+#include "Log.h"
+#include "Random.h"
+
+using namespace std;
+
+/*!
+  \file ApiCallRecord.cc
+  \brief Code recording the API calls made by a test template and replaying them.
+
+  The record is a text file starting with a header line, followed by one record per line:
+    C <draws32> <draws64> <api name> <argument count> <arguments>  an API call
+    B <call back name>                                             a call back into the front end
+    E <draws32> <draws64> <result>                                 the call back returning
+    U <name>                                                       a call that can't be replayed, or whose arguments can't be recorded
+    X <draws32> <draws64>                                          the end of the template
+  The draw counts are the numbers of random values the front end drew before passing control back.  Argument values are written as
+  N (None), T, F, i<integer>, r<real>, s<length>:<characters>, l<count> (list), t<count> (tuple), d<count> (dict, keys and values
+  alternating), e<module>.<enum type> i<integer> and c<length>:<characters> (ConstraintSet, as its range list string).
+*/
+
+namespace Force {
+
+  static const string sApiRecordHeader = "ForceApiRecord 1";
+
+  ApiCallRecorder::ApiCallRecorder(const string& rFilePath)
+    : mFilePath(rFilePath), mFile(), mDraws32(0), mDraws64(0)
+  {
+    mFile.open(mFilePath, ofstream::out | ofstream::trunc);
+    if (not mFile.is_open()) {
+      LOG(fail) << "{ApiCallRecorder::ApiCallRecorder} unable to open API record file \"" << mFilePath << "\"." << endl;
+      FAIL("api-record-file-open-failure");
+    }
+  }
+
+  void ApiCallRecorder::Start()
+  {
+    mFile << sApiRecordHeader << "\n";
+    NoteDraws();
+  }
+
+  void ApiCallRecorder::Finish()
+  {
+    mFile << "X";
+    WriteDraws();
+    mFile << "\n";
+    mFile.flush();
+    LOG(notice) << "{ApiCallRecorder::Finish} recorded template API calls to \"" << mFilePath << "\"." << endl;
+  }
+
+  void ApiCallRecorder::EnterApi(const string& rName, const py::tuple& rArgs)
+  {
+    ostringstream args_stream;
+    for (const auto& arg : rArgs) {
+      args_stream << " ";
+      if (not WriteValue(args_stream, arg)) {
+        LOG(warn) << "{ApiCallRecorder::EnterApi} unable to record argument value " << string(py::repr(arg)) << "." << endl;
+        RecordUnsupported(rName);
+        return;
+      }
+    }
+
+    mFile << "C";
+    WriteDraws();
+    mFile << " " << rName << " " << dec << rArgs.size() << args_stream.str() << "\n";
+  }
+
+  void ApiCallRecorder::ExitApi()
+  {
+    NoteDraws();
+  }
+
+  void ApiCallRecorder::EnterCallBack(const string& rName)
+  {
+    mFile << "B " << rName << "\n";
+    NoteDraws();
+  }
+
+  void ApiCallRecorder::ExitCallBack(uint64 result)
+  {
+    mFile << "E";
+    WriteDraws();
+    mFile << " " << dec << result << "\n";
+  }
+
+  void ApiCallRecorder::RecordUnsupported(const string& rName)
+  {
+    LOG(warn) << "{ApiCallRecorder::RecordUnsupported} calls to \"" << rName << "\" can't be replayed." << endl;
+    mFile << "U " << rName << "\n";
+  }
+
+  void ApiCallRecorder::NoteDraws()
+  {
+    Random::Instance()->GetDrawCounts(mDraws32, mDraws64);
+  }
+
+  void ApiCallRecorder::WriteDraws()
+  {
+    uint64 draws32 = 0;
+    uint64 draws64 = 0;
+    Random::Instance()->GetDrawCounts(draws32, draws64);
+    mFile << " " << dec << (draws32 - mDraws32) << " " << (draws64 - mDraws64);
+  }
+
+  bool ApiCallRecorder::WriteValue(ostream& rOutStream, const py::handle& rValue)
+  {
+    py::handle value_type = rValue.get_type();
+    if (rValue.is_none()) {
+      rOutStream << "N";
+    }
+    else if (py::isinstance<py::bool_>(rValue)) {
+      rOutStream << (rValue.cast<bool>() ? "T" : "F");
+    }
+    else if (py::isinstance<py::int_>(rValue)) {
+      rOutStream << "i" << string(py::str(rValue));
+    }
+    else if (py::isinstance<py::float_>(rValue)) {
+      rOutStream << "r" << string(py::repr(rValue));
+    }
+    else if (py::isinstance<py::str>(rValue)) {
+      string value_str = rValue.cast<string>();
+      rOutStream << "s" << dec << value_str.size() << ":" << value_str;
+    }
+    else if (py::isinstance<py::list>(rValue) or py::isinstance<py::tuple>(rValue)) {
+      rOutStream << (py::isinstance<py::list>(rValue) ? "l" : "t") << dec << py::len(rValue);
+      for (const auto& item : rValue) {
+        rOutStream << " ";
+        if (not WriteValue(rOutStream, item)) {
+          return false;
+        }
+      }
+    }
+    else if (py::isinstance<py::dict>(rValue)) {
+      rOutStream << "d" << dec << py::len(rValue);
+      for (const auto& dict_pair : rValue.cast<py::dict>()) {
+        rOutStream << " ";
+        if (not WriteValue(rOutStream, dict_pair.first)) {
+          return false;
+        }
+        rOutStream << " ";
+        if (not WriteValue(rOutStream, dict_pair.second)) {
+          return false;
+        }
+      }
+    }
+    else if (py::isinstance<ConstraintSet>(rValue)) {
+      string value_str = rValue.cast<const ConstraintSet&>().ToSimpleString();
+      rOutStream << "c" << dec << value_str.size() << ":" << value_str;
+    }
+    else if (py::hasattr(value_type, "__members__")) {
+      // enumeration exported by a back end module
+      rOutStream << "e" << string(py::str(value_type.attr("__module__"))) << "." << string(py::str(value_type.attr("__name__"))) << " i" << string(py::str(py::int_(py::reinterpret_borrow<py::object>(rValue))));
+    }
+    else {
+      return false;
+    }
+
+    return true;
+  }
+
+  uint64 call_back_front_end(const string& rName, const function<uint64()>& rCallBack)
+  {
+    PyInterface* py_interface = Scheduler::Instance()->GetPyInterface();
+    ApiCallReplayer* replayer = py_interface->GetApiCallReplayer();
+    if (nullptr != replayer) {
+      return replayer->ReplayCallBack(rName);
+    }
+
+    ApiCallRecorder* recorder = py_interface->GetApiCallRecorder();
+    if (nullptr == recorder) {
+      return rCallBack();
+    }
+
+    recorder->EnterCallBack(rName);
+    uint64 result = rCallBack();
+    recorder->ExitCallBack(result);
+    return result;
+  }
+
+  map<string, ApiReplayFunction> ApiCallReplayer::msReplayFunctions;
+
+  ApiCallReplayer::ApiCallReplayer(const string& rFilePath)
+    : mFilePath(rFilePath), mFile(), mpInterface(nullptr)
+  {
+    mFile.open(mFilePath);
+    if (not mFile.is_open()) {
+      LOG(fail) << "{ApiCallReplayer::ApiCallReplayer} unable to open API record file \"" << mFilePath << "\"." << endl;
+      FAIL("api-record-file-open-failure");
+    }
+  }
+
+  void ApiCallReplayer::RegisterApi(const string& rName, const ApiReplayFunction& rFunction)
+  {
+    msReplayFunctions[rName] = rFunction;
+  }
+
+  void ApiCallReplayer::Run(PyInterface& rInterface)
+  {
+    string header;
+    getline(mFile, header);
+    if (header != sApiRecordHeader) {
+      LOG(fail) << "{ApiCallReplayer::Run} \"" << mFilePath << "\" is not an API record file." << endl;
+      FAIL("api-record-file-format-error");
+    }
+
+    // importing the modules with replayable APIs registers the replay functions.
+    py::module::import("PyInterface");
+    py::module::import("Config");
+    py::module::import("StateTransition");
+    mpInterface = &rInterface;
+
+    LOG(notice) << "{ApiCallReplayer::Run} replaying template API calls from \"" << mFilePath << "\"." << endl;
+    ReplayUntil('X');
+    SkipDraws();
+  }
+
+  uint64 ApiCallReplayer::ReplayCallBack(const string& rName)
+  {
+    char tag = ReadTag();
+    string call_back_name = (tag == 'B') ? ReadWord() : "";
+    if (call_back_name != rName) {
+      LOG(fail) << "{ApiCallReplayer::ReplayCallBack} call back " << rName << " is not in the record." << endl;
+      FAIL("api-replay-diverged");
+    }
+
+    ReplayUntil('E');
+    SkipDraws();
+    uint64 result = 0;
+    mFile >> result;
+    return result;
+  }
+
+  void ApiCallReplayer::ReplayUntil(char endTag)
+  {
+    for (char tag = ReadTag(); tag != endTag; tag = ReadTag()) {
+      switch (tag) {
+      case 'C':
+        ReplayCall();
+        break;
+      case 'U':
+        LOG(fail) << "{ApiCallReplayer::ReplayUntil} the record contains a call to \"" << ReadWord() << "\" which can't be replayed." << endl;
+        FAIL("api-replay-unsupported-call");
+        break;
+      default:
+        LOG(fail) << "{ApiCallReplayer::ReplayUntil} expecting a \'" << endTag << "\' record, got a \'" << tag << "\' record." << endl;
+        FAIL("api-replay-diverged");
+      }
+    }
+  }
+
+  void ApiCallReplayer::ReplayCall()
+  {
+    SkipDraws();
+    string api_name = ReadWord();
+    uint32 arg_count = 0;
+    mFile >> arg_count;
+    py::tuple args(arg_count);
+    for (uint32 i = 0; i < arg_count; ++ i) {
+      args[i] = ReadValue();
+    }
+
+    auto find_iter = msReplayFunctions.find(api_name);
+    if (find_iter == msReplayFunctions.end()) {
+      LOG(fail) << "{ApiCallReplayer::ReplayCall} unknown API \"" << api_name << "\"." << endl;
+      FAIL("api-replay-unknown-api");
+    }
+    find_iter->second(*mpInterface, args);
+  }
+
+  void ApiCallReplayer::SkipDraws()
+  {
+    uint64 draws32 = 0;
+    uint64 draws64 = 0;
+    mFile >> draws32 >> draws64;
+    Random::Instance()->Discard(draws32, draws64);
+  }
+
+  char ApiCallReplayer::ReadTag()
+  {
+    char tag = 0;
+    if (not (mFile >> tag)) {
+      LOG(fail) << "{ApiCallReplayer::ReadTag} unexpected end of API record file \"" << mFilePath << "\"." << endl;
+      FAIL("api-record-file-format-error");
+    }
+    return tag;
+  }
+
+  string ApiCallReplayer::ReadWord()
+  {
+    string word;
+    mFile >> word;
+    return word;
+  }
+
+  py::object ApiCallReplayer::ReadValue()
+  {
+    char tag = ReadTag();
+    switch (tag) {
+    case 'N':
+      return py::none();
+    case 'T':
+      return py::bool_(true);
+    case 'F':
+      return py::bool_(false);
+    case 'i':
+      return py::reinterpret_steal<py::object>(PyLong_FromString(ReadWord().c_str(), nullptr, 10));
+    case 'r':
+      return py::float_(stod(ReadWord()));
+    case 's':
+    case 'c':
+      {
+        uint64 str_size = 0;
+        char separator = 0;
+        mFile >> str_size;
+        mFile.get(separator);
+        string value_str(str_size, ' ');
+        mFile.read(&value_str[0], str_size);
+        if (tag == 'c') {
+          return py::module::import("Constraint").attr("ConstraintSet")(value_str);
+        }
+        return py::str(value_str);
+      }
+    case 'l':
+    case 't':
+      {
+        uint32 item_count = 0;
+        mFile >> item_count;
+        py::list items;
+        for (uint32 i = 0; i < item_count; ++ i) {
+          items.append(ReadValue());
+        }
+        return (tag == 'l') ? py::object(items) : py::object(py::tuple(items));
+      }
+    case 'd':
+      {
+        uint32 item_count = 0;
+        mFile >> item_count;
+        py::dict items;
+        for (uint32 i = 0; i < item_count; ++ i) {
+          py::object key = ReadValue();
+          items[key] = ReadValue();
+        }
+        return items;
+      }
+    case 'e':
+      {
+        string enum_name = ReadWord();
+        size_t dot_pos = enum_name.rfind('.');
+        py::object enum_type = py::module::import(enum_name.substr(0, dot_pos).c_str()).attr(enum_name.substr(dot_pos + 1).c_str());
+        return enum_type(ReadValue());
+      }
+    default:
+      LOG(fail) << "{ApiCallReplayer::ReadValue} unknown value tag \'" << tag << "\' in API record file \"" << mFilePath << "\"." << endl;
+      FAIL("api-record-file-format-error");
+    }
+
+    return py::none();
+  }
+
+}
@@ -19,6 +19,8 @@
 
 #include "BntNode.h"
 #include "Log.h"
+#include "MemoryAccounting.h"
+#include "SimplePeState.h"
 
 /*!
   \file BntNodeManager.cc
@@ -96,6 +98,27 @@ namespace Force {
     }
   }
 
+  void BntNodeManager::AccountMemory(MemoryUsage& rUsage) const
+  {
+    auto account_node = [&rUsage](const BntNode* pBntNode) {
+      rUsage.Add(sizeof(BntNode), 1);
+      if (pBntNode->GetPeState() != nullptr) {
+        pBntNode->GetPeState()->AccountMemory(rUsage);
+      }
+    };
+
+    rUsage.Add(vector_memory_bytes(mBntNodes) + vector_memory_bytes(mSpeculativeBntNodes), 0);
+    for (auto bnt_node : mBntNodes) {
+      account_node(bnt_node);
+    }
+    for (auto bnt_node : mSpeculativeBntNodes) {
+      account_node(bnt_node);
+    }
+    if (mpHotSpeculativeBntNode != nullptr) {
+      account_node(mpHotSpeculativeBntNode);
+    }
+  }
+
   BntNodeManager::BntNodeManager(const BntNodeManager& rOther) : Object(rOther), mBntNodes(), mpHotSpeculativeBntNode(nullptr), mSpeculativeBntNodes()
   {
 
@@ -53,6 +53,11 @@ namespace Force {
     return mWeight;
   }
 
+  uint32 Choice::FilteredWeight(const ChoicesFilter& filter) const
+  {
+    return filter.Usable(this) ? mWeight : 0;
+  }
+
   void Choice::GetAvailableChoices(const ChoicesFilter& filter, vector<const Choice*>& rChoicesList) const
   {
     if ((mWeight > 0) and filter.Usable(this)) {
@@ -255,6 +260,46 @@ namespace Force {
     return mWeight;
   }
 
+  uint32 ChoiceTree::FilteredWeight(const ChoicesFilter& filter) const
+  {
+    uint32 all_weights = accumulate(mChoices.begin(), mChoices.end(), uint32(0),
+      [&filter](cuint32 partialSum, const Choice* choice_item) { return (partialSum + choice_item->FilteredWeight(filter)); });
+
+    return (all_weights == 0) ? 0 : mWeight;
+  }
+
+  /*!
+    Draws the same random value and returns the same choice as calling Choose() on a clone that ApplyFilter() has been applied to.
+   */
+  const Choice* ChoiceTree::ChooseFiltered(const ChoicesFilter& filter) const
+  {
+    vector<uint32> filtered_weights;
+    filtered_weights.reserve(mChoices.size());
+    uint32 all_weights = 0;
+    for (auto const choice_item : mChoices) {
+      filtered_weights.push_back(choice_item->FilteredWeight(filter));
+      all_weights += filtered_weights.back();
+    }
+
+    if (all_weights == 0) {
+      stringstream err_stream;
+      err_stream << "total weight of ChoiceTree: \"" << mName << "\" equals 0.";
+      throw ChoicesError(err_stream.str());
+    }
+
+    uint32 picked_value = Random::Instance()->Random32(0, all_weights - 1);
+    for (uint32 i = 0; i < mChoices.size(); ++ i) {
+      if (picked_value < filtered_weights[i]) {
+        return mChoices[i]->ChooseFiltered(filter);
+      }
+      picked_value -= filtered_weights[i];
+    }
+
+    LOG(fail) << "Failed to choose any choice from ChoiceTree \"" << mName << "\"." << endl;
+    FAIL("fail-choose-from-tree");
+    return nullptr;
+  }
+
   const Choice* ChoiceTree::FindChoiceByValue(uint32 value) const
   {
     Choice* choice_item = nullptr;
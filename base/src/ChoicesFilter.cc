@@ -29,6 +29,11 @@ namespace Force {
     return mpConstraint->ContainsValue(choice->Value());
   }
 
+  bool CombinedChoicesFilter::Usable(const Choice* choice) const
+  {
+    return mpFirstFilter->Usable(choice) and mpSecondFilter->Usable(choice);
+  }
+
   bool MultiRegisterChoicesFilter::Usable(const Choice* choice) const
   {
     ConstraintSet my_indices;
@@ -15,12 +15,14 @@
 //
 #include "Constraint.h"
 
+#include <algorithm>
 #include <numeric>  // C++UP accumulate defined in numeric
 #include <sstream>
 
 #include "ConstraintUtils.h"
 #include "GenException.h"
 #include "Log.h"
+#include "MemoryAccounting.h"
 #include "Random.h"
 #include "StringUtils.h"
 #include "UtilityFunctions.h"
@@ -962,6 +964,12 @@ namespace Force {
       [](cuint64 size, const Constraint* constr_item) { return size + constr_item->Size(); });
   }
 
+  void ConstraintSet::AccountMemory(MemoryUsage& rUsage) const
+  {
+    // count every element as a RangeConstraint, the larger of the two Constraint types.
+    rUsage.Add(sizeof(ConstraintSet) + vector_memory_bytes(mConstraints) + mConstraints.size() * sizeof(RangeConstraint), 1 + mConstraints.size());
+  }
+
   uint64 ConstraintSet::LowerBound() const
   {
     if (IsEmpty()) {
@@ -1001,6 +1009,50 @@ namespace Force {
     }
   }
 
+  void ConstraintSet::ChooseValues(uint64 count, uint64 align, bool unique, vector<uint64>& rValues) const
+  {
+    if (IsEmpty()) {
+      stringstream err_stream;
+      err_stream << "ConstraintSet is empty.";
+      throw ConstraintError(err_stream.str());
+    }
+    if (0 == align) {
+      stringstream err_stream;
+      err_stream << "Zero alignment choosing values from ConstraintSet.";
+      throw ConstraintError(err_stream.str());
+    }
+
+    // number the aligned values of the constraints consecutively, tracking the index of the first aligned value of each constraint.
+    vector<uint64> start_indices;
+    vector<uint64> first_values;
+    uint64 max_index = 0;
+    for (auto constr_ptr : mConstraints) {
+      uint64 lower = constr_ptr->LowerBound();
+      uint64 upper = constr_ptr->UpperBound();
+      uint64 first_value = lower + (align - lower % align) % align;
+      if ((first_value < lower) or (first_value > upper)) {
+        continue;
+      }
+
+      uint64 start_index = start_indices.empty() ? 0 : (max_index + 1);
+      start_indices.push_back(start_index);
+      first_values.push_back(first_value);
+      max_index = start_index + (upper - first_value) / align;
+    }
+
+    if (start_indices.empty()) {
+      stringstream err_stream;
+      err_stream << "ConstraintSet " << ToSimpleString() << " has no value aligned to 0x" << hex << align << ".";
+      throw ConstraintError(err_stream.str());
+    }
+
+    Random::Instance()->Random64Values(0, max_index, count, unique, rValues);
+    for (auto& value : rValues) {
+      uint32 constr_index = (upper_bound(start_indices.begin(), start_indices.end(), value) - start_indices.begin()) - 1;
+      value = first_values[constr_index] + (value - start_indices[constr_index]) * align;
+    }
+  }
+
   void ConstraintSet::FailedChoosingValue(uint64 offset, const std::string& additionalMsg) const
   {
     LOG(fail) << "Failed to choose a value with randomly picked offset : 0x" << hex << offset << " calling from \"" << additionalMsg << "\"." << endl;
@@ -1486,6 +1538,7 @@ namespace Force {
         for (; del_iter != end_iter; ++ del_iter) {
           size_change += (*del_iter)->Size();
           DELETE_CONSTRAINT((*del_iter));
+          (*del_iter) = nullptr;
         }
       }
       else {
@@ -2376,6 +2429,25 @@ namespace Force {
     return true;
   }
 
+  const Constraint* ConstraintSet::ContainingConstraint(uint64 lower, uint64 upper) const
+  {
+    if (IsEmpty()) return nullptr;
+
+    ValueConstraint value_constr(lower);
+    RangeConstraint range_constr(lower, upper);
+    const Constraint* search_constr = &range_constr;
+    if (upper == lower) {
+      search_constr = &value_constr;
+    }
+
+    auto find_iter = std::lower_bound(mConstraints.begin(), mConstraints.end(), search_constr, &compare_constraints);
+    if ((find_iter == mConstraints.end()) or (not (*find_iter)->Contains(*search_constr))) {
+      return nullptr;
+    }
+
+    return *find_iter;
+  }
+
   /*!
     \class CsIntersectionSeeker
     \brief A class used in ConstraintSet::Intersects to organize related intersection seeking code.
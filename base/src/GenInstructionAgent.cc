@@ -18,6 +18,7 @@
 #include <memory>
 
 #include "AddressTagging.h"
+#include "Architectures.h"
 #include "BntHookManager.h"
 #include "BntNode.h"
 #include "BntNodeManager.h"
@@ -36,6 +37,7 @@
 #include "Log.h"
 #include "MemoryInitData.h"
 #include "MemoryManager.h"
+#include "NativeExecutor.h"
 #include "ObjectRegistry.h"
 #include "Operand.h"
 #include "ReExecutionManager.h"
@@ -43,6 +45,7 @@
 #include "Register.h"
 #include "ResourcePeState.h"
 #include "RestoreLoop.h"
+#include "SegmentJournal.h"
 #include "UtilityAlgorithms.h"
 #include "Variable.h"
 #include "VirtualMemoryInitializer.h"
@@ -58,8 +61,10 @@ using namespace std;
 
 namespace Force {
 
+  static const uint64 NATIVE_FETCH_PAGE_MASK = ~0xfffull; //!< Mask of the smallest page, the granularity the ISS checks instruction fetches with.
+
   GenInstructionAgent::GenInstructionAgent(const GenInstructionAgent& rOther)
-    : GenAgent(rOther), Receiver(rOther), mInstrSimulated(0), mpInstructionRequest(nullptr), mRegisterInitializations() { } //!< Copy constructor, do not copy the request pointer.
+    : GenAgent(rOther), Receiver(rOther), mInstrSimulated(0), mpInstructionRequest(nullptr), mRegisterInitializations(), mSimplePrototypes(), mpNativeExecutor(nullptr), mNativeExecutionCheck(false), mNativeInstructions(0), mNativeNextPC(0), mNativeRegisters(), mNativeFetchPage(MAX_UINT64), mpNativeFetchMapper(nullptr) { } //!< Copy constructor, do not copy the request pointer.
 
   GenInstructionAgent::~GenInstructionAgent()
   {
@@ -67,6 +72,12 @@ namespace Force {
       LOG(warn) << "{GenInstructionAgent::~GenInstructionAgent} register initialization vector not empty." << endl;
       //FAIL("register-initialization-vector-not-empty");
     }
+
+    for (auto& prototype_item : mSimplePrototypes) {
+      delete prototype_item.second;
+    }
+
+    delete mpNativeExecutor;
   }
 
   Object* GenInstructionAgent::Clone() const
@@ -88,13 +99,59 @@ namespace Force {
     mpInstructionRequest = nullptr; // object ownership passed to generator.
   }
 
+  /*!
+    An instruction is simple when it is of the base Instruction class and its operands are plain constant, immediate and register
+    operands with no differ or slave relationships, so it needs no preamble and no operand solving.  Detection is done once per
+    instruction; the prototype of a simple instruction is then cloned instead of being instantiated and initialized operand by operand.
+   */
+  const Instruction* GenInstructionAgent::SimpleInstructionPrototype(const InstructionStructure* pInstrStruct)
+  {
+    auto find_iter = mSimplePrototypes.find(pInstrStruct);
+    if (find_iter != mSimplePrototypes.end()) {
+      return find_iter->second;
+    }
+
+    Instruction* prototype = ObjectRegistry::Instance()->TypeInstance<Instruction>(pInstrStruct->mClass);
+    prototype->Initialize(pInstrStruct);
+
+    bool is_simple = (string(prototype->Type()) == "Instruction");
+    for (auto opr_ptr : prototype->GetOperands()) {
+      if (not is_simple) {
+        break;
+      }
+
+      string opr_type = opr_ptr->Type();
+      auto opr_struct = opr_ptr->GetOperandStructure();
+      is_simple = (opr_type == "Operand" or opr_type == "ImmediateOperand" or opr_type == "SignedImmediateOperand" or opr_type == "RegisterOperand")
+        and opr_struct->GetDiffers().empty() and (not opr_struct->IsSlave());
+    }
+
+    if (not is_simple) {
+      delete prototype;
+      prototype = nullptr;
+    }
+    else {
+      LOG(info) << "{GenInstructionAgent::SimpleInstructionPrototype} " << pInstrStruct->FullName() << " is a simple instruction." << endl;
+    }
+
+    mSimplePrototypes[pInstrStruct] = prototype;
+    return prototype;
+  }
+
   void  GenInstructionAgent::HandleRequest()
   {
     mpGenerator->MapPC();
 
     const InstructionStructure* instr_struct = mpGenerator->GetInstructionSet()->LookUpById(mpInstructionRequest->InstructionId());
-    Instruction* instr = ObjectRegistry::Instance()->TypeInstance<Instruction>(instr_struct->mClass);
-    instr->Initialize(instr_struct);
+    const Instruction* prototype = SimpleInstructionPrototype(instr_struct);
+    Instruction* instr = nullptr;
+    if (nullptr != prototype) {
+      instr = dynamic_cast<Instruction*>(prototype->Clone());
+    }
+    else {
+      instr = ObjectRegistry::Instance()->TypeInstance<Instruction>(instr_struct->mClass);
+      instr->Initialize(instr_struct);
+    }
     LOG(notice) << "Generating: " << instr->FullName() << endl;
     instr->Setup(*mpInstructionRequest, *mpGenerator);
     try {
@@ -116,7 +173,13 @@ namespace Force {
       SkipRequest(instr);
       return;
     }
-    mpGenerator->CommitInstruction(instr, mpInstructionRequest);
+
+    if (nullptr != prototype) {
+      mpGenerator->CommitInstructionFinal(instr, mpInstructionRequest); // simple instructions have no preamble or postamble requests.
+    }
+    else {
+      mpGenerator->CommitInstruction(instr, mpInstructionRequest);
+    }
     mpInstructionRequest = nullptr; // object ownership passed to generator.
   }
 
@@ -137,10 +200,15 @@ namespace Force {
     }
   }
 
-  void GenInstructionAgent::StepInstruction(const Instruction* pInstr)
+  void GenInstructionAgent::StepInstruction(const Instruction* pInstr, bool allowNative)
   {
     bool has_except = false;
     if (mpGenerator->SimulationEnabled()) {
+      if (allowNative and ExecuteNatively(pInstr)) {
+        UpdateUnpredictedConstraint(pInstr);
+        return;
+      }
+
       has_except = StepInstructionWithSimulation(pInstr);
       if (!has_except and pInstr->IsBranch() and pInstr->SpeculativeBnt()) {
         auto bnt_node = mpGenerator->GetBntNodeManager()->GetHotSpeculativeBntNode();
@@ -266,6 +334,7 @@ namespace Force {
 
     // write fully initialized physical registers.
     uint32 thread_id = mpGenerator->ThreadId();
+    auto segment_journal = mpGenerator->GetSegmentJournal();
     for (auto phys_reg_ptr : phys_reg_inits) {
       uint64 phys_reg_mask = phys_reg_ptr->Mask();
       if (phys_reg_ptr->HasAttribute(ERegAttrType::UpdatedFromISS)) {
@@ -276,6 +345,9 @@ namespace Force {
 
       LOG(info) << "{ GenInstructionAgent::SendInitsToISS} writing register " << phys_reg_ptr->Name() << " initial value 0x" << hex << phys_reg_ptr->InitialValue(phys_reg_mask) << endl;
       sim_ptr->WriteRegister(thread_id, phys_reg_ptr->Name().c_str(), phys_reg_ptr->InitialValue(phys_reg_mask), phys_reg_mask);
+      if (nullptr != segment_journal) {
+        segment_journal->RecordRegisterInit(phys_reg_ptr->Name(), phys_reg_ptr->InitialValue(phys_reg_mask), phys_reg_mask);
+      }
     }
 
     // memory inits include the instruction opcode and memory associated with a load/store...
@@ -290,6 +362,7 @@ namespace Force {
 
   bool GenInstructionAgent::StepInstructionWithSimulation(const Instruction* pInstr)
   {
+    SyncNativeExecution();
     SendInitsToISS();
 
     SimAPI *sim_ptr = mpGenerator->GetSimAPI(); // get handle to simulator...
@@ -301,13 +374,33 @@ namespace Force {
     vector<MmuEvent> mmu_events;    //
     vector<ExceptionUpdate> except_updates;        //
 
+    // compute the native result from the state before the step to check it against the ISS.
+    bool check_native = false;
+    string native_reg_name;
+    uint64 native_value = 0;
+    uint64 native_next_pc = 0;
+    uint64 fetch_pc = mpGenerator->PC();
+    if (mNativeExecutionCheck and (nullptr != pInstr) and NativeExecutionAllowed(pInstr)) {
+      check_native = mpNativeExecutor->Execute(*mpGenerator, *pInstr, native_reg_name, native_value);
+      native_next_pc = mpGenerator->PC() + pInstr->ByteSize();
+    }
+
     // step instruction on simulator...
 
     sim_ptr->Step(thread_id, reg_updates, mem_updates, mmu_events, except_updates);
+    RecordSegmentJournalUpdates(reg_updates, mem_updates);
 
     bool has_eret_event = false;
     bool has_except_event = HasExceptionEvent(except_updates, has_eret_event);
 
+    if (check_native and not has_except_event) {
+      CheckNativeExecution(pInstr, native_reg_name, native_value, native_next_pc, reg_updates);
+    }
+
+    if ((nullptr != mpNativeExecutor) and (nullptr != pInstr)) {
+      UpdateNativeFetchPage(fetch_pc, has_except_event, reg_updates);
+    }
+
     if (mpGenerator->InSpeculative()) {
       auto hot_bntNode = mpGenerator->GetBntNodeManager()->GetHotSpeculativeBntNode();
       if (hot_bntNode == nullptr) {
@@ -344,6 +437,18 @@ namespace Force {
     return has_except_event;
   }
 
+  void GenInstructionAgent::RecordSegmentJournalUpdates(const vector<RegUpdate>& rRegUpdates, const vector<MemUpdate>& rMemUpdates)
+  {
+    // speculative steps are undone, they don't change the state the segment leaves.
+    auto segment_journal = mpGenerator->GetSegmentJournal();
+    if ((nullptr == segment_journal) or mpGenerator->InSpeculative()) {
+      return;
+    }
+
+    segment_journal->RecordRegisterUpdates(rRegUpdates);
+    segment_journal->RecordMemoryUpdates(rMemUpdates);
+  }
+
   void GenInstructionAgent::UpdateAccurateBnt(const Instruction* pInstr, uint64 targetPC)
   {
     BntNode* bnt_node = pInstr->GetBntNode();
@@ -440,6 +545,30 @@ namespace Force {
     }
   }
 
+  void GenInstructionAgent::UpdateNativeFetchPage(cuint64 fetchPC, bool hasExceptEvent, const vector<RegUpdate>& rRegUpdates)
+  {
+    mNativeFetchPage = MAX_UINT64;
+    if (hasExceptEvent) {
+      return;
+    }
+
+    // a system register write can change the translation or the privilege level the next fetch is checked with.
+    auto reg_file = mpGenerator->GetRegisterFile();
+    for (auto const &update : rRegUpdates) {
+      if ((update.access_type != "write") or (update.regname == "PC")) {
+        continue;
+      }
+
+      ERegisterType reg_type = reg_file->PhysicalRegisterLookup(update.regname)->RegisterType();
+      if ((reg_type == ERegisterType::SysReg) or (reg_type == ERegisterType::Internal)) {
+        return;
+      }
+    }
+
+    mNativeFetchPage = fetchPC & NATIVE_FETCH_PAGE_MASK;
+    mpNativeFetchMapper = mpGenerator->GetVmManager()->CurrentVmMapper();
+  }
+
   void GenInstructionAgent::UpdateMemoryFromSimulation(const vector<MemUpdate>& memUpdates)
   {
     auto memoryManager = mpGenerator->GetMemoryManager();
@@ -648,6 +777,7 @@ namespace Force {
 
   void GenInstructionAgent::InitializeReadOnlyRegistersWithISS(const vector<ReadOnlyRegister* >& rRegs)
   {
+    SyncNativeExecution();
     uint32 thread_id = mpGenerator->ThreadId();
     auto reg_file = mpGenerator->GetRegisterFile();
     SimAPI *sim_ptr = mpGenerator->GetSimAPI(); // get handle to simulator
@@ -662,6 +792,7 @@ namespace Force {
 
   void GenInstructionAgent::ResetReadOnlyRegisterFieldsWithISS(const std::vector<ReadOnlyRegisterField* >& rRegFields)
   {
+    SyncNativeExecution();
     uint32 thread_id = mpGenerator->ThreadId();
     auto reg_file = mpGenerator->GetRegisterFile();
     SimAPI *sim_ptr = mpGenerator->GetSimAPI(); // get handle to simulator
@@ -682,6 +813,138 @@ namespace Force {
     }
   }
 
+  /*!
+    Native execution is enabled by the NativeExecution option.  The generator then computes the results of the instructions the
+    architecture's NativeExecutor models and updates its own register state, and the ISS is only brought up to date, by writing the
+    changed registers and the PC, before it is needed again.  The ISS doesn't step the natively executed instructions, so they
+    don't appear in its trace.  With the NativeExecutionCheck option the ISS is stepped as usual and every natively computed
+    result is checked against it instead.
+   */
+  void GenInstructionAgent::SetupNativeExecution()
+  {
+    auto config_ptr = Config::Instance();
+    bool native_valid = false;
+    uint64 native_execution = config_ptr->GetOptionValue("NativeExecution", native_valid);
+    bool check_valid = false;
+    uint64 native_check = config_ptr->GetOptionValue("NativeExecutionCheck", check_valid);
+    mNativeExecutionCheck = check_valid and (native_check != 0);
+
+    if (((native_valid and (native_execution != 0)) or mNativeExecutionCheck) and mpGenerator->SimulationEnabled()) {
+      mpNativeExecutor = mpGenerator->GetArchInfo()->InstantiateNativeExecutor();
+      if (nullptr == mpNativeExecutor) {
+        LOG(warn) << "{GenInstructionAgent::SetupNativeExecution} native execution is not supported by the architecture." << endl;
+        mNativeExecutionCheck = false;
+      }
+    }
+  }
+
+  bool GenInstructionAgent::NativeExecutionAllowed(const Instruction* pInstr) const
+  {
+    if ((nullptr == mpNativeExecutor) or (mRegisterInitializations.size() > 0) or pInstr->Unpredictable()) {
+      return false;
+    }
+
+    // a segment journal records the state changes from the ISS step updates.
+    if (nullptr != mpGenerator->GetSegmentJournal()) {
+      return false;
+    }
+
+    if (mpGenerator->InSpeculative() or mpGenerator->InLoop() or mpGenerator->ReExecution() or mpGenerator->InException()) {
+      return false;
+    }
+
+    // the instruction is fetched without the ISS, so it has to be in a page the ISS fetched from without a fault, with the same translation.
+    uint64 pc = mpGenerator->PC();
+    if (((pc & NATIVE_FETCH_PAGE_MASK) != mNativeFetchPage) or (((pc + pInstr->ByteSize() - 1) & NATIVE_FETCH_PAGE_MASK) != mNativeFetchPage)) {
+      return false;
+    }
+
+    return (mpGenerator->GetVmManager()->CurrentVmMapper() == mpNativeFetchMapper);
+  }
+
+  bool GenInstructionAgent::ExecuteNatively(const Instruction* pInstr)
+  {
+    if (mNativeExecutionCheck or (not NativeExecutionAllowed(pInstr))) {
+      return false;
+    }
+
+    string dest_reg_name;
+    uint64 dest_value = 0;
+    if (not mpNativeExecutor->Execute(*mpGenerator, *pInstr, dest_reg_name, dest_value)) {
+      return false;
+    }
+
+    // update the generator state the same way as with the updates of an ISS step.
+    uint32 thread_id = mpGenerator->ThreadId();
+    uint64 next_pc = mpGenerator->PC() + pInstr->ByteSize();
+    vector<RegUpdate> reg_updates;
+    if (not dest_reg_name.empty()) {
+      reg_updates.push_back(RegUpdate(thread_id, dest_reg_name.c_str(), dest_value, MAX_UINT64, "write"));
+      insert_sorted<string>(mNativeRegisters, dest_reg_name);
+    }
+    reg_updates.push_back(RegUpdate(thread_id, "PC", next_pc, MAX_UINT64, "write"));
+    uint64 real_pc = 0;
+    UpdateRegisterFromSimulation(reg_updates, false, real_pc);
+
+    mNativeNextPC = next_pc;
+    ++ mNativeInstructions;
+    UpdateInstructionCount();
+    return true;
+  }
+
+  void GenInstructionAgent::SyncNativeExecution()
+  {
+    if (mNativeInstructions == 0) {
+      return;
+    }
+
+    SendInitsToISS();
+
+    SimAPI *sim_ptr = mpGenerator->GetSimAPI(); // get handle to simulator
+    uint32 thread_id = mpGenerator->ThreadId();
+    auto reg_file = mpGenerator->GetRegisterFile();
+    for (const auto& reg_name : mNativeRegisters) {
+      auto phys_register = reg_file->PhysicalRegisterLookup(reg_name);
+      uint64 reg_mask = phys_register->Mask();
+      sim_ptr->WriteRegister(thread_id, reg_name.c_str(), phys_register->Value(reg_mask), reg_mask);
+    }
+    sim_ptr->WriteRegister(thread_id, "PC", mNativeNextPC, MAX_UINT64);
+
+    LOG(info) << "{GenInstructionAgent::SyncNativeExecution} synced " << dec << mNativeInstructions << " natively executed instructions writing "
+              << mNativeRegisters.size() << " registers to the ISS, PC 0x" << hex << mNativeNextPC << endl;
+    mNativeInstructions = 0;
+    mNativeRegisters.clear();
+  }
+
+  void GenInstructionAgent::CheckNativeExecution(const Instruction* pInstr, const string& rDestRegName, uint64 destValue, uint64 nextPC, const vector<RegUpdate>& rRegUpdates) const
+  {
+    bool dest_match = rDestRegName.empty();
+    bool pc_match = false;
+    for (auto const &update : rRegUpdates) {
+      if (update.access_type != "write") {
+        continue;
+      }
+
+      if (update.regname == "PC") {
+        pc_match = (update.rval == nextPC);
+      }
+      else if (update.regname == rDestRegName) {
+        dest_match = ((update.rval & update.mask) == (destValue & update.mask));
+      }
+    }
+
+    if (not (dest_match and pc_match)) {
+      LOG(fail) << "{GenInstructionAgent::CheckNativeExecution} native result of " << pInstr->FullName() << " at 0x" << hex << (nextPC - pInstr->ByteSize())
+                << " differs from the ISS: " << (rDestRegName.empty() ? "no register" : rDestRegName) << " value 0x" << destValue << ", next PC 0x" << nextPC << endl;
+      for (auto const &update : rRegUpdates) {
+        LOG(fail) << "{GenInstructionAgent::CheckNativeExecution} ISS update: " << update.access_type << " " << update.regname << " value 0x" << update.rval << " mask 0x" << update.mask << endl;
+      }
+      FAIL("native-execution-mismatch");
+    }
+
+    LOG(info) << "{GenInstructionAgent::CheckNativeExecution} native result of " << pInstr->FullName() << " matches the ISS." << endl;
+  }
+
   void GenInstructionAgent::RecoverExceptionBeforeUpdate(const vector<ExceptionUpdate>& exceptUpdates, const std::vector<RegUpdate>& regUpdates, SimAPI* pSimAPI)
   {
     const ExceptionUpdate& excep_event = exceptUpdates.front();
@@ -43,6 +43,11 @@ namespace Force {
     FAIL("unsupported-query-detail- value-type");
   }
 
+  void GenQuery::AddDetail(const std::string& attrName, const ConstraintSet& rConstrSet)
+  {
+    AddDetail(attrName, rConstrSet.ToSimpleString());
+  }
+
   string GenQuery::ToString() const
   {
     return EQueryType_to_string(QueryType()) + " : " + PrimaryString();
@@ -68,6 +68,12 @@ namespace Force {
     AddDetail(attrName, value);
   }
 
+  void GenRequest::AddDetail(const std::string& attrName, const ConstraintSet& rConstrSet)
+  {
+    // requests not taking constraint sets directly get the equivalent value string.
+    AddDetail(attrName, rConstrSet.ToSimpleString());
+  }
+
   void GenRequest::UnsupportedRequestDetailAttribute(const std::string& attrName) const
   {
     LOG(fail) << "Unsupported request detail attribute: " << attrName << " of request: " << RequestType() << endl;
@@ -149,6 +155,18 @@ namespace Force {
     }
   }
 
+  void GenInstructionRequest::AddOperandRequest(const std::string& oprName, const ConstraintSet& rConstrSet)
+  {
+    auto find_iter = mOperandRequests.find(oprName);
+    if (find_iter == mOperandRequests.end()) {
+      mOperandRequests[oprName] = new OperandRequest(oprName, rConstrSet);
+    }
+    else {
+      auto existing_req = find_iter->second;
+      existing_req->SetValueRequest(rConstrSet);
+    }
+  }
+
   void GenInstructionRequest::AddOperandDataRequest(const std::string& oprName, const std::string& valueStr) const
   {
     //<< "{GenInstructionRequest::AddOperandDataRequest oprName=" << oprName << " valstr=" << valueStr << endl;
@@ -299,6 +317,24 @@ namespace Force {
     }
   }
 
+  void GenInstructionRequest::AddDetail(const string& attrName, const ConstraintSet& rConstrSet)
+  {
+    bool convert_okay = false;
+    EInstrConstraintAttrType constr_attr = try_string_to_EInstrConstraintAttrType(attrName, convert_okay);
+    if (convert_okay) {
+      SetConstraintAttribute(constr_attr, rConstrSet.Clone());
+      return;
+    }
+
+    try_string_to_EInstrBoolAttrType(attrName, convert_okay);
+    if (convert_okay or (attrName.find(".Data") != string::npos) or (attrName.find("LSData") != string::npos) or (attrName.find("LSTargetList") != string::npos)) {
+      GenRequest::AddDetail(attrName, rConstrSet);
+    }
+    else {
+      AddOperandRequest(attrName, rConstrSet);
+    }
+  }
+
   const OperandRequest* GenInstructionRequest::FindOperandRequest(const string& opName) const
   {
     auto find_iter = mOperandRequests.find(opName);
@@ -1115,6 +1151,18 @@ namespace Force {
     }
   }
 
+  void GenVirtualMemoryRequest::AddDetail(const std::string& attrName, const ConstraintSet& rConstrSet)
+  {
+    if (attrName == "Range") {
+      LOG(info) << "{GenVirtualMemoryRequest::AddDetail} " << attrName << " : " << rConstrSet.ToSimpleString() << " : " << RequestType() << endl;
+      delete mpMemoryRangesConstraint;
+      mpMemoryRangesConstraint = rConstrSet.Clone();
+    }
+    else {
+      GenRequest::AddDetail(attrName, rConstrSet);
+    }
+  }
+
   void GenVirtualMemoryRequest::SetPrivilegeLevel(EPrivilegeLevelType priv)
   {
     mPrivilegeLevel = priv;
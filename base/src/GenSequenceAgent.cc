@@ -793,8 +793,8 @@ namespace Force {
     std::unique_ptr<ChoiceTree> recover_choice_tree(choices_raw);
     const Choice* recover_choice = recover_choice_tree->Choose();
     if (recover_choice->Value()) {
-     auto cloned_dep = mpGenerator->GetDependenceInstance()->Snapshot();
-     pBntNode->PushResourcePeState(new DependencePeState(cloned_dep));
+     auto dependence = mpGenerator->GetDependenceInstance();
+     pBntNode->PushResourcePeState(new DependencePeState(dependence, dependence->Snapshot()));
     }
 
     vector<GenRequest*> bnt_requests;
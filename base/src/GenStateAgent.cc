@@ -90,6 +90,7 @@ namespace Force {
     case EGenStateType::GenMode:
       {
         if (mpGenerator->HasISS() && IsRequestSpeculative() && not mpGenerator->InSpeculative()) {
+          mpGenerator->SyncNativeExecution();
           SimAPI *sim_api = mpGenerator->GetSimAPI(); // Get handle to simulator.
           sim_api->EnterSpeculativeMode(mpGenerator->ThreadId()); // enter speculative mode.
         }
@@ -317,6 +318,7 @@ namespace Force {
   void GenStateAgent::UpdatePcOnISS(uint64 pc)
   {
     if (mpGenerator->HasISS()) {
+      mpGenerator->SyncNativeExecution();
       SimAPI *sim_ptr = mpGenerator->GetSimAPI(); // get handle to simulator...
       sim_ptr->WriteRegister(mpGenerator->ThreadId(), "PC", pc, -1ull);
     }
@@ -485,6 +485,14 @@ namespace Force {
     fp_req->RegulateRequest();
     fp_req->mValid = fp_claimer.ClaimFreePages(*fp_req->mpRequestRanges, fp_req->mRequestPageSizes, fp_req->mStartAddr, *fp_req->mpResolvedRanges, fp_req->mResolvedPageSizes);
   }
+  void GenVirtualMemoryAgent::GenVmContext()
+  {
+    auto context_req = mpVirtualMemoryRequest->CastInstance<GenVmContextRequest>();
+    VmManager* vm_manager = mpGenerator->GetVmManager();
+    EVmRegimeType regime_type = vm_manager->CurrentVmRegime()->VmRegimeType();
+    context_req->mId = vm_manager->GenContextIdRequest(regime_type, context_req->GetInputArgs());
+  }
+
   void GenVirtualMemoryAgent::UpdateVm()
   {
     mpGenerator->SetupPageTableRegions();
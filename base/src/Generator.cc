@@ -53,6 +53,7 @@
 #include "RegisterReserver.h"
 #include "RegisteredSetModifier.h"
 #include "ResourceDependence.h"
+#include "SegmentJournal.h"
 #include "StateTransition.h"
 #include "Variable.h"
 #include "VirtualMemoryInitializer.h"
@@ -66,7 +67,7 @@ namespace Force {
   Generator::Generator()
     : Object(), mThreadId(0), mMaxInstructions(0), mMaxPhysicalVectorLen(0), mpArchInfo(nullptr), mpInstructionSet(nullptr), mpPagingInfo(nullptr), mpMemoryManager(nullptr), mpSimAPI(nullptr), mpVirtualMemoryInitializer(nullptr), mpRegisterFile(nullptr), mpVmManager(nullptr), mpRequestQueue(nullptr),
       mpThreadInstructionResults(nullptr), mpRecordArchive(nullptr), mpBootOrder(nullptr), mpGenMode(nullptr), mpGenPC(nullptr), mpReExecutionManager(nullptr), mpDependence(nullptr), mpRegisteredSetModifier(nullptr), mpExceptionRecordManager(nullptr), mpChoicesModerators(nullptr),
-      mpConditionSet(nullptr), mpPageRequestRegulator(nullptr), mpAddressFilteringRegulator(nullptr), mpBntHookManager(nullptr), mpBntNodeManager(nullptr), mpAddressTableManager(nullptr), mAgents(), mGenStateValues(), mGenStateStrings(), mPreAmbleRequests(), mPostAmbleRequests(),
+      mpConditionSet(nullptr), mpPageRequestRegulator(nullptr), mpAddressFilteringRegulator(nullptr), mpBntHookManager(nullptr), mpBntNodeManager(nullptr), mpAddressTableManager(nullptr), mpSegmentJournal(nullptr), mAgents(), mGenStateValues(), mGenStateStrings(), mPreAmbleRequests(), mPostAmbleRequests(),
       mPostInstrStepRequests(), mVariableModerators()
   {
     mpRequestQueue = new GenRequestQueue();
@@ -88,7 +89,7 @@ namespace Force {
   Generator::Generator(uint64 alignmentMask)
     : Object(), mThreadId(0), mMaxInstructions(0), mMaxPhysicalVectorLen(0), mpArchInfo(nullptr), mpInstructionSet(nullptr), mpPagingInfo(nullptr), mpMemoryManager(nullptr), mpSimAPI(nullptr), mpVirtualMemoryInitializer(nullptr), mpRegisterFile(nullptr), mpVmManager(nullptr), mpRequestQueue(nullptr),
       mpThreadInstructionResults(nullptr), mpRecordArchive(nullptr), mpBootOrder(nullptr), mpGenMode(nullptr), mpGenPC(nullptr), mpReExecutionManager(nullptr), mpDependence(nullptr), mpRegisteredSetModifier(nullptr), mpExceptionRecordManager(nullptr), mpChoicesModerators(nullptr),
-      mpConditionSet(nullptr), mpPageRequestRegulator(nullptr), mpAddressFilteringRegulator(nullptr), mpBntHookManager(nullptr), mpBntNodeManager(nullptr), mpAddressTableManager(nullptr), mAgents(), mGenStateValues(), mGenStateStrings(), mPreAmbleRequests(), mPostAmbleRequests(),
+      mpConditionSet(nullptr), mpPageRequestRegulator(nullptr), mpAddressFilteringRegulator(nullptr), mpBntHookManager(nullptr), mpBntNodeManager(nullptr), mpAddressTableManager(nullptr), mpSegmentJournal(nullptr), mAgents(), mGenStateValues(), mGenStateStrings(), mPreAmbleRequests(), mPostAmbleRequests(),
       mPostInstrStepRequests(), mVariableModerators()
   {
     mpRequestQueue = new GenRequestQueue();
@@ -110,7 +111,7 @@ namespace Force {
   Generator::Generator(const Generator& rOther)
     : Object(rOther), mThreadId(0), mMaxInstructions(rOther.mMaxInstructions), mMaxPhysicalVectorLen(rOther.mMaxPhysicalVectorLen), mpArchInfo(rOther.mpArchInfo), mpInstructionSet(rOther.mpInstructionSet), mpPagingInfo(rOther.mpPagingInfo), mpMemoryManager(rOther.mpMemoryManager), mpSimAPI(rOther.mpSimAPI),
       mpVirtualMemoryInitializer(nullptr), mpRegisterFile(nullptr), mpVmManager(nullptr), mpRequestQueue(nullptr), mpThreadInstructionResults(nullptr), mpRecordArchive(nullptr), mpBootOrder(nullptr), mpGenMode(nullptr), mpGenPC(nullptr), mpReExecutionManager(nullptr), mpDependence(nullptr),
-      mpRegisteredSetModifier(nullptr), mpExceptionRecordManager(nullptr), mpChoicesModerators(nullptr), mpConditionSet(nullptr), mpPageRequestRegulator(nullptr), mpAddressFilteringRegulator(nullptr), mpBntHookManager(nullptr), mpBntNodeManager(), mpAddressTableManager(nullptr),
+      mpRegisteredSetModifier(nullptr), mpExceptionRecordManager(nullptr), mpChoicesModerators(nullptr), mpConditionSet(nullptr), mpPageRequestRegulator(nullptr), mpAddressFilteringRegulator(nullptr), mpBntHookManager(nullptr), mpBntNodeManager(), mpAddressTableManager(nullptr), mpSegmentJournal(nullptr),
       mAgents(), mGenStateValues(), mGenStateStrings(), mPreAmbleRequests(), mPostAmbleRequests(), mPostInstrStepRequests(), mVariableModerators()
   {
     if (rOther.mpRequestQueue) {
@@ -236,6 +237,7 @@ namespace Force {
     delete mpBntHookManager;
     delete mpBntNodeManager;
     delete mpAddressTableManager;
+    delete mpSegmentJournal;
 
     for (auto agent_ptr : mAgents) {
       delete agent_ptr;
@@ -286,6 +288,7 @@ namespace Force {
     else {
       mpRegisterFile->InitializeReadOnlyRegistersNoISS();
     }
+    instr_agent->SetupNativeExecution();
     mpRegisterFile->SignUp(instr_agent);
 
     mpRegisterFile->GetConditionSet()->SignUp();
@@ -385,6 +388,7 @@ namespace Force {
 
   void Generator::GenSummary()
   {
+    SyncNativeExecution();
     mpThreadInstructionResults->GenSummary();
   }
 
@@ -457,7 +461,7 @@ namespace Force {
     if (not mpThreadInstructionResults->Commit(this, instr)) {
       if (SimulationEnabled()) {
         mpRequestQueue->PrependRequest(new GenCommitInstruction(instr, instrReq));
-        gen_instr_agent->StepInstruction(instr); // step to generate address fault
+        gen_instr_agent->StepInstruction(instr, false); // step on the ISS to generate address fault
       }
       else {
         LOG(notice) << "{Generator::CommitInstructionFinal} Skipped address-error instruction:" << instr->FullName() << "at 0x" << hex << GetGenPC()->Value() << endl;
@@ -899,6 +903,12 @@ namespace Force {
     instr_agent->ExceptionReturn();
   }
 
+  void Generator::SyncNativeExecution()
+  {
+    auto instr_agent = static_cast<GenInstructionAgent*>(mAgents[int(EGenAgentType::GenInstructionAgent)]);
+    instr_agent->SyncNativeExecution();
+  }
+
   void Generator::SleepOnLowPower()
   {
     if (!InLowPower()) {
@@ -1216,12 +1226,28 @@ namespace Force {
     FAIL("unimplemented-function");
   }
 
-  void Generator::SetDependenceInstance(ResourceDependence* pDependence)
+  void Generator::StartSegmentJournal()
+  {
+    if (nullptr != mpSegmentJournal) {
+      LOG(fail) << "{Generator::StartSegmentJournal} already recording a segment journal." << endl;
+      FAIL("segment-journal-already-started");
+    }
+
+    mpSegmentJournal = new SegmentJournal();
+    mpMemoryManager->SetSegmentJournal(mpSegmentJournal);
+  }
+
+  void Generator::FinishSegmentJournal(const string& rFilePath)
   {
-    if (mpDependence)
-      delete mpDependence;
+    if (nullptr == mpSegmentJournal) {
+      LOG(fail) << "{Generator::FinishSegmentJournal} not recording a segment journal." << endl;
+      FAIL("segment-journal-not-started");
+    }
 
-    mpDependence = pDependence;
+    mpSegmentJournal->Write(rFilePath, PC());
+    mpMemoryManager->SetSegmentJournal(nullptr);
+    delete mpSegmentJournal;
+    mpSegmentJournal = nullptr;
   }
 
 }
@@ -28,6 +28,7 @@
 #include "InstructionConstraint.h"
 #include "InstructionStructure.h"
 #include "Log.h"
+#include "MemoryAccounting.h"
 #include "ObjectRegistry.h"
 #include "Operand.h"
 #include "ResourceDependence.h"
@@ -323,6 +324,12 @@ namespace Force {
     return mpStructure->mGroup;
   }
 
+  void Instruction::AccountMemory(MemoryUsage& rUsage) const
+  {
+    // Instruction and operand sub classes mostly add a few scalar members, so use the base class sizes as the estimate.
+    rUsage.Add(sizeof(Instruction) + vector_memory_bytes(mOperands) + mOperands.size() * sizeof(Operand), 1 + mOperands.size());
+  }
+
   InstructionConstraint* BranchInstruction::InstantiateInstructionConstraint() const
   {
     return new BranchInstructionConstraint();
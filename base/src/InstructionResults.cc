@@ -25,6 +25,7 @@
 #include "Instruction.h"
 #include "Log.h"
 #include "Record.h"
+#include "SegmentJournal.h"
 #include "UtilityFunctions.h"
 
 using namespace std;
@@ -37,7 +38,7 @@ using namespace std;
 namespace Force {
 
   InstructionResultsBank::InstructionResultsBank(const InstructionResultsBank& rOther)
-    : Object(rOther), mBank(rOther.mBank), mResults()
+    : Object(rOther), mBank(rOther.mBank), mResults(), mImportedResults()
   {
     // do not copy mResults contents.
   }
@@ -69,9 +70,18 @@ namespace Force {
     mResults[pa] = instr;
   }
 
+  void InstructionResultsBank::ImportInstruction(uint64 pa, uint32 opcode, const string& rAsmText)
+  {
+    if ((mResults.find(pa) != mResults.end()) or (mImportedResults.find(pa) != mImportedResults.end())) {
+      LOG(fail) << "Importing Instruction \"" << rAsmText << "\" to bank " << mBank << " address 0x" << hex << pa << " that has been occupied by another instruction." << endl;
+      FAIL("duplicated-instruction-at-pa");
+    }
+    mImportedResults[pa] = make_pair(opcode, rAsmText);
+  }
+
   uint32 InstructionResultsBank::GetInstructionCount() const
   {
-    return mResults.size();
+    return mResults.size() + mImportedResults.size();
   }
 
   const Instruction* InstructionResultsBank::LookupInstruction(uint64 address) const
@@ -85,7 +95,7 @@ namespace Force {
   }
 
   ThreadInstructionResults::ThreadInstructionResults(uint32 numBanks)
-    : Object(), mBanks(), mCurBank(0), mCurAddr(0), mCurAddrValid(false), mRecordId()
+    : Object(), mBanks(), mCurBank(0), mCurAddr(0), mCurAddrValid(false), mRecordId(), mInstructionUsage()
   {
     for (uint32 i = 0; i < numBanks; ++ i) {
       mBanks.push_back(new InstructionResultsBank(i));
@@ -93,7 +103,7 @@ namespace Force {
   }
 
   ThreadInstructionResults::ThreadInstructionResults(const ThreadInstructionResults& rOther)
-    : Object(rOther), mBanks(), mCurBank(rOther.mCurBank), mCurAddr(rOther.mCurAddr), mCurAddrValid(rOther.mCurAddrValid), mRecordId(rOther.mRecordId)
+    : Object(rOther), mBanks(), mCurBank(rOther.mCurBank), mCurAddr(rOther.mCurAddr), mCurAddrValid(rOther.mCurAddrValid), mRecordId(rOther.mRecordId), mInstructionUsage()
   {
     transform(rOther.mBanks.cbegin(), rOther.mBanks.cend(), back_inserter(mBanks),
       [](const InstructionResultsBank* pResultBank) { return dynamic_cast<InstructionResultsBank*>(pResultBank->Clone()); });
@@ -120,6 +130,9 @@ namespace Force {
   void ThreadInstructionResults::AddInstruction(uint32 bank, uint64 pa, Instruction* instr)
   {
     mBanks[bank]->AddInstruction(pa, instr);
+    if (MemoryAccounting::Instance()->Enabled()) {
+      instr->AccountMemory(mInstructionUsage);
+    }
     // update current instruction bank and address
     mCurBank = bank;
     mCurAddr = pa;
@@ -146,10 +159,15 @@ namespace Force {
     }
     LOG(notice) << "Committing instruction \"" << instr_text << "\" at 0x" << hex << gen_pc->Value() << "=>["<< bank <<"]0x" << pa << " (0x" << instr->Opcode() <<") gen("<< gen->ThreadId() << ")" << endl;
     AddInstruction(bank, pa, instr);
+    auto segment_journal = gen->GetSegmentJournal();
+    if (nullptr != segment_journal) {
+      segment_journal->RecordInstruction(bank, pa, instr->Opcode(), instr->AssemblyText());
+    }
     uint32 instr_size = instr->ByteSize();
     MemoryInitRecord* mem_init_data = gen->GetRecordArchive()->GetMemoryInitRecord(gen->ThreadId(), instr_size, instr->ElementSize(), EMemDataType::Instruction);
     mem_init_data->SetData(pa, bank, instr->Opcode(), instr_size, gen->IsInstructionBigEndian());
     gen->InitializeMemory(mem_init_data);
+    MemoryAccounting::Instance()->InstructionCommitted();
     return true;
   }
 
@@ -184,6 +202,16 @@ namespace Force {
     return mBanks[bank]->GetInstructions();
   }
 
+  void ThreadInstructionResults::ImportInstruction(uint32 bank, uint64 pa, uint32 opcode, const string& rAsmText)
+  {
+    mBanks[bank]->ImportInstruction(pa, opcode, rAsmText);
+  }
+
+  const std::map<uint64, std::pair<uint32, std::string> >& ThreadInstructionResults::GetImportedInstructions(uint32 bank) const
+  {
+    return mBanks[bank]->GetImportedInstructions();
+  }
+
   uint32 ThreadInstructionResults::GetInstructionCount(cuint32 bank) const
   {
     return mBanks[bank]->GetInstructionCount();
@@ -207,6 +235,14 @@ namespace Force {
     rec_id = mRecordId;
   }
 
+  void ThreadInstructionResults::AccountMemory(MemoryUsage& rUsage) const
+  {
+    rUsage.Add(mInstructionUsage);
+    for (auto result_bank : mBanks) {
+      rUsage.Add(map_memory_bytes(result_bank->GetInstructions()), 0);
+    }
+  }
+
   void ThreadInstructionResults::InvalidCurrentBankAddress()
   {
     mCurAddrValid = false;
@@ -23,6 +23,7 @@
 
 #include "Config.h"
 #include "Log.h"
+#include "MemoryAccounting.h"
 #include "Random.h"
 #include "UtilityFunctions.h"
 
@@ -376,6 +377,11 @@ namespace Force {
       delete map_item.second;
   }
 
+  void Memory::AccountMemory(MemoryUsage& rUsage) const
+  {
+    rUsage.Add(map_memory_bytes(mContent) + mContent.size() * sizeof(MemoryBytes), mContent.size());
+  }
+
   /*!
     \class MetaAccess
     \brief class for aligned memory access.
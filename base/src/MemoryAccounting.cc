@@ -0,0 +1,144 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "MemoryAccounting.h"
+
+#include "BntNodeManager.h"
+#include "Config.h"
+#include "Generator.h"
+#include "InstructionResults.h"
+#include "Log.h"
+#include "Memory.h"
+#include "MemoryManager.h"
+#include "PageTableManager.h"
+#include "PhysicalPageManager.h"
+#include "Record.h"
+#include "Scheduler.h"
+
+using namespace std;
+
+namespace Force {
+
+  MemoryAccounting* MemoryAccounting::mspMemoryAccounting = nullptr;
+
+  void MemoryAccounting::Initialize()
+  {
+    if (mspMemoryAccounting == nullptr) {
+      mspMemoryAccounting = new MemoryAccounting();
+    }
+    else {
+      LOG(fail) << "MemoryAccounting instance has already been initialized.";
+      FAIL("reinitialize-memory-accounting");
+    }
+  }
+
+  void MemoryAccounting::Destroy()
+  {
+    if (mspMemoryAccounting != nullptr) {
+      delete mspMemoryAccounting;
+      mspMemoryAccounting = nullptr;
+    }
+    else {
+      LOG(fail) << "MemoryAccounting has already been destroyed or was never initialized.";
+      FAIL("redestroy-memory-accounting");
+    }
+  }
+
+  MemoryAccounting::MemoryAccounting()
+    : mEnabled(false), mInterval(0), mInstructionCount(0), mNextReport(0), mReportFile()
+  {
+    Config* config_ptr = Config::Instance();
+    mInterval = config_ptr->GetOptionValue("MemoryReportInterval", mEnabled);
+    if (not mEnabled) {
+      return;
+    }
+
+    bool file_valid = false;
+    string file_name = config_ptr->GetOptionString("MemoryReportFile", file_valid);
+    if (not file_valid) {
+      file_name = "memory_report.csv";
+    }
+
+    mReportFile.open(file_name, ofstream::out | ofstream::trunc);
+    if (not mReportFile.is_open()) {
+      LOG(fail) << "{MemoryAccounting::MemoryAccounting} unable to open memory report file \"" << file_name << "\"." << endl;
+      FAIL("memory-report-file-open-failure");
+    }
+
+    mReportFile << "Event, Instructions, Hart, Subsystem, Bytes, Objects" << endl;
+    mNextReport = mInterval;
+    LOG(notice) << "{MemoryAccounting::MemoryAccounting} writing memory report to \"" << file_name << "\" every " << dec << mInterval << " instructions." << endl;
+  }
+
+  MemoryAccounting::~MemoryAccounting()
+  {
+    if (mReportFile.is_open()) {
+      mReportFile.close();
+    }
+  }
+
+  void MemoryAccounting::ReportTestEnd()
+  {
+    if (mEnabled) {
+      Report("end");
+    }
+  }
+
+  void MemoryAccounting::Report(const string& rEvent)
+  {
+    for (auto gen_item : Scheduler::Instance()->GetGenerators()) {
+      const Generator* gen = gen_item.second;
+      string hart = to_string(gen_item.first);
+
+      MemoryUsage instr_usage;
+      gen->GetInstructionResults()->AccountMemory(instr_usage);
+      WriteRow(rEvent, hart, "instructions", instr_usage);
+
+      MemoryUsage record_usage;
+      gen->GetRecordArchive()->AccountMemory(record_usage);
+      WriteRow(rEvent, hart, "records", record_usage);
+
+      MemoryUsage bnt_usage;
+      gen->GetBntNodeManager()->AccountMemory(bnt_usage);
+      WriteRow(rEvent, hart, "bnt_nodes", bnt_usage);
+    }
+
+    // The memory banks are shared by all harts, so sum their subsystems over the banks.
+    MemoryUsage memory_usage;
+    MemoryUsage constraint_usage;
+    MemoryUsage physical_page_usage;
+    MemoryUsage page_table_usage;
+    MemoryManager* mem_manager = MemoryManager::Instance();
+    for (uint32 bank = 0; bank < mem_manager->NumberBanks(); ++ bank) {
+      MemoryBank* mem_bank = mem_manager->GetMemoryBank(bank);
+      mem_bank->MemoryInstance()->AccountMemory(memory_usage);
+      mem_bank->AccountConstraintMemory(constraint_usage);
+      mem_bank->GetPhysicalPageManager()->AccountMemory(physical_page_usage);
+      mem_bank->GetPageTableManager()->AccountMemory(page_table_usage);
+    }
+
+    WriteRow(rEvent, "shared", "memory_model", memory_usage);
+    WriteRow(rEvent, "shared", "memory_constraints", constraint_usage);
+    WriteRow(rEvent, "shared", "physical_pages", physical_page_usage);
+    WriteRow(rEvent, "shared", "page_tables", page_table_usage);
+    mReportFile.flush();
+  }
+
+  void MemoryAccounting::WriteRow(const string& rEvent, const string& rHart, const string& rSubsystem, const MemoryUsage& rUsage)
+  {
+    mReportFile << rEvent << ", " << dec << mInstructionCount << ", " << rHart << ", " << rSubsystem << ", " << rUsage.mBytes << ", " << rUsage.mObjects << '\n';
+  }
+
+}
@@ -15,26 +15,28 @@
 //
 #include "MemoryConstraint.h"
 
+#include <algorithm>
 #include <memory>
 
 #include "AddressReuseMode.h"
 #include "Constraint.h"
 #include "ConstraintUtils.h"
 #include "Log.h"
+#include "MemoryAccounting.h"
 
 using namespace std;
 
 namespace Force {
 
   MemoryConstraint::MemoryConstraint()
-    : mpUsable(nullptr), mpShared(nullptr), mInitialized(false)
+    : mpUsable(nullptr), mpShared(nullptr), mInitialized(false), mUsableWindowLower(0), mUsableWindowUpper(0), mUsableWindowValid(false)
   {
     mpUsable = new LargeConstraintSet();
     mpShared = new LargeConstraintSet();
   }
 
   MemoryConstraint::MemoryConstraint(const MemoryConstraint& rOther)
-    : mpUsable(nullptr), mpShared(nullptr), mInitialized(false)
+    : mpUsable(nullptr), mpShared(nullptr), mInitialized(false), mUsableWindowLower(0), mUsableWindowUpper(0), mUsableWindowValid(false)
   {
     mpUsable = rOther.mpUsable->Clone();
     mpShared = rOther.mpShared->Clone();
@@ -59,12 +61,14 @@ namespace Force {
     mpUsable->Clear();
     mpShared->Clear();
     mInitialized = false;
+    mUsableWindowValid = false;
   }
 
   void MemoryConstraint::MarkUsed(cuint64 startAddress, cuint64 endAddress)
   {
     // << "mem_constr markused start=0x" << hex << startAddress << " end=0x" << endAddress << endl;
     mpUsable->SubRange(startAddress, endAddress);
+    TrimUsableWindow(startAddress, endAddress);
   }
 
   void MemoryConstraint::MarkUsed(const ConstraintSet& constrSet)
@@ -72,11 +76,13 @@ namespace Force {
     //auto cset_s_constr = ConstraintSetSerializer(constrSet, FORCE_CSET_DEFAULT_PERLINE);
     // << "mem_constr markused constr=" << cset_s_constr.ToDebugString() << endl;
     mpUsable->SubConstraintSet(constrSet);
+    TrimUsableWindow(constrSet);
   }
 
   void MemoryConstraint::MarkUsedForType(cuint64 startAddress, cuint64 endAddress, const EMemDataType memDataType, const EMemAccessType memAccessType, cuint32 threadId)
   {
     mpUsable->SubRange(startAddress, endAddress);
+    TrimUsableWindow(startAddress, endAddress);
 
     if (memDataType == EMemDataType::Data) {
       MarkDataUsedForType(startAddress, endAddress, memAccessType, threadId);
@@ -88,6 +94,8 @@ namespace Force {
     // << "mem_constr markshared start=0x" << hex << startAddress << " end=0x" << endAddress << endl;
     mpShared->AddRange(startAddress, endAddress);
     mpUsable->SubRange(startAddress, endAddress);
+    TrimUsableWindow(startAddress, endAddress);
+    MarkDataShared(startAddress, endAddress);
   }
 
   void MemoryConstraint::MarkShared(const ConstraintSet& constrSet)
@@ -96,6 +104,11 @@ namespace Force {
     // << "mem_constr markshared constr=" << cset_s_constr.ToDebugString() << endl;
     mpShared->MergeConstraintSet(constrSet);
     mpUsable->SubConstraintSet(constrSet);
+    TrimUsableWindow(constrSet);
+
+    for (const Constraint* constr : constrSet.GetConstraints()) {
+      MarkDataShared(constr->LowerBound(), constr->UpperBound());
+    }
   }
 
   void MemoryConstraint::UnmarkUsed(cuint64 startAddress, cuint64 endAddress)
@@ -114,6 +127,59 @@ namespace Force {
   void MemoryConstraint::ReplaceUsableInRange(uint64 lower, uint64 upper, ConstraintSet& rReplaceConstr)
   {
     mpUsable->GetConstraintSet()->ReplaceInRange(lower, upper, rReplaceConstr);
+    if (mUsableWindowValid and (lower <= mUsableWindowUpper) and (upper >= mUsableWindowLower)) {
+      mUsableWindowValid = false;
+    }
+  }
+
+  // The usable window is always a part of a single usable range, so when it contains the whole address range, a
+  // single usable range does as well.  Otherwise, the usable range containing the address range becomes the window.
+  bool MemoryConstraint::UsableContainsRange(uint64 lower, uint64 upper) const
+  {
+    if (mUsableWindowValid and (lower >= mUsableWindowLower) and (upper <= mUsableWindowUpper)) {
+      return true;
+    }
+
+    const Constraint* usable_constr = mpUsable->GetConstraintSet()->ContainingConstraint(lower, upper);
+    if (nullptr == usable_constr) {
+      return false;
+    }
+
+    mUsableWindowLower = usable_constr->LowerBound();
+    mUsableWindowUpper = usable_constr->UpperBound();
+    mUsableWindowValid = true;
+    return true;
+  }
+
+  void MemoryConstraint::TrimUsableWindow(uint64 lower, uint64 upper)
+  {
+    if ((not mUsableWindowValid) or (lower > mUsableWindowUpper) or (upper < mUsableWindowLower)) {
+      return;
+    }
+
+    if ((lower <= mUsableWindowLower) and (upper < mUsableWindowUpper)) {
+      mUsableWindowLower = upper + 1;
+    }
+    else if ((upper >= mUsableWindowUpper) and (lower > mUsableWindowLower)) {
+      mUsableWindowUpper = lower - 1;
+    }
+    else {
+      mUsableWindowValid = false;
+    }
+  }
+
+  void MemoryConstraint::TrimUsableWindow(const ConstraintSet& rConstrSet)
+  {
+    for (const Constraint* constr : rConstrSet.GetConstraints()) {
+      TrimUsableWindow(constr->LowerBound(), constr->UpperBound());
+    }
+  }
+
+  void MemoryConstraint::AccountMemory(MemoryUsage& rUsage) const
+  {
+    rUsage.Add(sizeof(LargeConstraintSet) * 2, 2);
+    mpUsable->AccountMemory(rUsage);
+    mpShared->AccountMemory(rUsage);
   }
 
   void MemoryConstraint::ApplyToConstraintSet(const EMemDataType memDataType, const EMemAccessType memAccessType, cuint32 threadId, const AddressReuseMode& rAddrReuseMode, ConstraintSet* constrSet) const
@@ -128,37 +194,36 @@ namespace Force {
   }
 
   // This method finds the intersection of the specified constraint with the union of the usable,
-  // applicable used and shared constraints.
+  // applicable used and shared constraints. The shared and applicable used parts are found in a single
+  // pass over the thread's data access states.
   void MemoryConstraint::ApplyToDataConstraintSet(const EMemAccessType memAccessType, cuint32 threadId, const AddressReuseMode& rAddrReuseMode, ConstraintSet* constrSet) const
   {
     auto usable_constr = mpUsable->GetConstraintSet();
-    auto shared_constr = mpShared->GetConstraintSet();
-    if ((usable_constr->ContainsConstraintSet(*constrSet)) or (shared_constr->ContainsConstraintSet(*constrSet))) {
-      // If constrSet is fully usable or fully shared, there's nothing to do.
+    if (usable_constr->ContainsConstraintSet(*constrSet)) {
+      // If constrSet is fully usable, there's nothing to do.
       return;
     }
 
-    const ConstraintSet* read_used_constr = nullptr;
-    const ConstraintSet* write_used_constr = nullptr;
+    uint32 reuse_states = DataAccessStates::smShared;
     switch (memAccessType) {
     case EMemAccessType::Read:
       if (rAddrReuseMode.IsReuseTypeEnabled(EAddressReuseType::ReadAfterRead)) {
-        read_used_constr = DataReadUsed(threadId);
+        reuse_states |= DataAccessStates::smLastRead;
       }
 
       if (rAddrReuseMode.IsReuseTypeEnabled(EAddressReuseType::ReadAfterWrite)) {
-        write_used_constr = DataWriteUsed(threadId);
+        reuse_states |= DataAccessStates::smLastWritten;
       }
 
       break;
     case EMemAccessType::Write:
     case EMemAccessType::ReadWrite:
       if (rAddrReuseMode.IsReuseTypeEnabled(EAddressReuseType::WriteAfterRead)) {
-        read_used_constr = DataReadUsed(threadId);
+        reuse_states |= DataAccessStates::smLastRead;
       }
 
       if (rAddrReuseMode.IsReuseTypeEnabled(EAddressReuseType::WriteAfterWrite)) {
-        write_used_constr = DataWriteUsed(threadId);
+        reuse_states |= DataAccessStates::smLastWritten;
       }
 
       break;
@@ -169,42 +234,24 @@ namespace Force {
       FAIL("unsupported-mem-access-type");
     }
 
-    unique_ptr<ConstraintSet> read_used_clone;
-    if (read_used_constr != nullptr) {
-      // Reuse of read addresses is enabled.
-      if (read_used_constr->ContainsConstraintSet(*constrSet)) {
-        // If constrSet is fully contained in the previously used read address set, it's fully
-        // usable, so there's nothing to do.
-        return;
-      }
-      else if (not read_used_constr->IsEmpty()) {
-        // Otherwise, find the parts of constrSet that intersect with the previously used addresses.
-        read_used_clone.reset(constrSet->Clone());
-        read_used_clone->ApplyLargeConstraintSet(*read_used_constr);
-      }
+    // Find the parts of constrSet that are shared or that may be reused.
+    ConstraintSet reuse_constr;
+    const DataAccessStates* data_states = GetDataAccessStates(threadId);
+    if (data_states != nullptr) {
+      data_states->GetMatching(*constrSet, reuse_states, reuse_constr);
     }
-
-    unique_ptr<ConstraintSet> write_used_clone;
-    if (write_used_constr != nullptr) {
-      // Reuse of write addresses is enabled.
-      if (write_used_constr->ContainsConstraintSet(*constrSet)) {
-        // If constrSet is fully contained in the previously used write address set, it's fully
-        // usable, so there's nothing to do.
-        return;
-      }
-      else if (not write_used_constr->IsEmpty()) {
-        // Otherwise, find the parts of constrSet that intersect with the applicable previously used
-        // addresses.
-        write_used_clone.reset(constrSet->Clone());
-        write_used_clone->ApplyLargeConstraintSet(*write_used_constr);
-      }
+    else if (reuse_states != DataAccessStates::smShared) {
+      LOG(fail) << "{MemoryConstraint::ApplyToDataConstraintSet} data access states not found for Thread " << dec << threadId << endl;
+      FAIL("mem-constraint-not-found");
+    }
+    else if (not mpShared->GetConstraintSet()->IsEmpty()) {
+      reuse_constr.MergeConstraintSet(*constrSet);
+      reuse_constr.ApplyLargeConstraintSet(*(mpShared->GetConstraintSet()));
     }
 
-    // Find the parts of constrSet that intersect with the shared addresses.
-    unique_ptr<ConstraintSet> shared_clone;
-    if (not shared_constr->IsEmpty()) {
-      shared_clone.reset(constrSet->Clone());
-      shared_clone->ApplyLargeConstraintSet(*shared_constr);
+    if ((not reuse_constr.IsEmpty()) and (reuse_constr.Size() == constrSet->Size())) {
+      // If constrSet is fully shared or reusable, there's nothing to do.
+      return;
     }
 
     // Find the parts of constrSet that intersect with the usable addresses.
@@ -215,17 +262,22 @@ namespace Force {
       constrSet->Clear();
     }
 
-    // Merge all of the intersection results together to yield the final constraint.
-    if (read_used_clone != nullptr) {
-      constrSet->MergeConstraintSet(*read_used_clone);
-    }
-
-    if (write_used_clone != nullptr) {
-      constrSet->MergeConstraintSet(*write_used_clone);
-    }
+    // Merge the shared and reusable parts back in to yield the final constraint.
+    constrSet->MergeConstraintSet(reuse_constr);
+  }
 
-    if (shared_clone != nullptr) {
-      constrSet->MergeConstraintSet(*shared_clone);
+  void MemoryConstraint::UpdateDataAccessStates(cuint64 startAddress, cuint64 endAddress, const EMemAccessType memAccessType, DataAccessStates* pDataStates)
+  {
+    switch (memAccessType) {
+    case EMemAccessType::Read:
+      pDataStates->UpdateStates(startAddress, endAddress, DataAccessStates::smLastRead, DataAccessStates::smLastWritten);
+      break;
+    case EMemAccessType::Write:
+      pDataStates->UpdateStates(startAddress, endAddress, DataAccessStates::smLastWritten, DataAccessStates::smLastRead);
+      break;
+    default:
+      // Don't allow address reuse for other cases
+      break;
     }
   }
 
@@ -246,171 +298,114 @@ namespace Force {
   }
 
   SingleThreadMemoryConstraint::SingleThreadMemoryConstraint(cuint32 threadId)
-    : MemoryConstraint(), mThreadId(threadId), mpDataReadUsed(nullptr), mpDataWriteUsed(nullptr)
+    : MemoryConstraint(), mThreadId(threadId), mDataStates()
   {
-    mpDataReadUsed = new LargeConstraintSet();
-    mpDataWriteUsed = new LargeConstraintSet();
   }
 
   SingleThreadMemoryConstraint::SingleThreadMemoryConstraint(const SingleThreadMemoryConstraint& rOther)
-    : MemoryConstraint(rOther), mThreadId(rOther.mThreadId), mpDataReadUsed(nullptr), mpDataWriteUsed(nullptr)
+    : MemoryConstraint(rOther), mThreadId(rOther.mThreadId), mDataStates(rOther.mDataStates)
   {
-    mpDataReadUsed = rOther.mpDataReadUsed->Clone();
-    mpDataWriteUsed = rOther.mpDataWriteUsed->Clone();
   }
 
   SingleThreadMemoryConstraint::~SingleThreadMemoryConstraint()
   {
-    delete mpDataReadUsed;
-    delete mpDataWriteUsed;
   }
 
   void SingleThreadMemoryConstraint::Uninitialize()
   {
     MemoryConstraint::Uninitialize();
 
-    mpDataReadUsed->Clear();
-    mpDataWriteUsed->Clear();
+    mDataStates.Clear();
   }
 
   void SingleThreadMemoryConstraint::MarkDataUsedForType(cuint64 startAddress, cuint64 endAddress, const EMemAccessType memAccessType, cuint32 threadId)
   {
     if (threadId == mThreadId) {
-      switch (memAccessType) {
-      case EMemAccessType::Read:
-        mpDataReadUsed->AddRange(startAddress, endAddress);
-        mpDataWriteUsed->SubRange(startAddress, endAddress);
-        break;
-      case EMemAccessType::Write:
-        mpDataWriteUsed->AddRange(startAddress, endAddress);
-        mpDataReadUsed->SubRange(startAddress, endAddress);
-        break;
-      default:
-        // Don't allow address reuse for other cases
-        break;
-      }
+      UpdateDataAccessStates(startAddress, endAddress, memAccessType, &mDataStates);
     }
     // else ignore the update if the thread ID doesn't match
   }
 
-  const ConstraintSet* SingleThreadMemoryConstraint::DataReadUsed(cuint32 threadId) const
+  void SingleThreadMemoryConstraint::MarkDataShared(cuint64 startAddress, cuint64 endAddress)
   {
-    if (threadId != mThreadId) {
-      LOG(fail) << "{SingleThreadMemoryConstraint::DataReadUsed} read used memory constraint not found for Thread " << dec << threadId << endl;
-      FAIL("mem-constraint-not-found");
-    }
-
-    return mpDataReadUsed->GetConstraintSet();
+    mDataStates.UpdateStates(startAddress, endAddress, DataAccessStates::smShared, 0);
   }
 
-  const ConstraintSet* SingleThreadMemoryConstraint::DataWriteUsed(cuint32 threadId) const
+  const DataAccessStates* SingleThreadMemoryConstraint::GetDataAccessStates(cuint32 threadId) const
   {
     if (threadId != mThreadId) {
-      LOG(fail) << "{SingleThreadMemoryConstraint::DataWriteUsed} write used memory constraint not found for Thread " << dec << threadId << endl;
-      FAIL("mem-constraint-not-found");
+      return nullptr;
     }
 
-    return mpDataWriteUsed->GetConstraintSet();
+    return &mDataStates;
+  }
+
+  void SingleThreadMemoryConstraint::AccountMemory(MemoryUsage& rUsage) const
+  {
+    MemoryConstraint::AccountMemory(rUsage);
+    mDataStates.AccountMemory(rUsage);
   }
 
   MultiThreadMemoryConstraint::MultiThreadMemoryConstraint(cuint32 threadCount)
-    : MemoryConstraint(), mDataReadUsedByThread(), mDataWriteUsedByThread()
+    : MemoryConstraint(), mDataStatesByThread()
   {
     for (uint32 i = 0; i < threadCount; i++) {
-      mDataReadUsedByThread.emplace(i, new LargeConstraintSet());
-      mDataWriteUsedByThread.emplace(i, new LargeConstraintSet());
+      mDataStatesByThread.emplace(i, DataAccessStates());
     }
   }
 
   MultiThreadMemoryConstraint::MultiThreadMemoryConstraint(const MultiThreadMemoryConstraint& rOther)
-    : MemoryConstraint(rOther), mDataReadUsedByThread(), mDataWriteUsedByThread()
+    : MemoryConstraint(rOther), mDataStatesByThread(rOther.mDataStatesByThread)
   {
-    for (const auto& data_read_used_entry : rOther.mDataReadUsedByThread) {
-      auto data_read_used_clone = dynamic_cast<LargeConstraintSet*>(data_read_used_entry.second->Clone());
-      mDataReadUsedByThread.emplace(data_read_used_entry.first, data_read_used_clone);
-    }
-
-    for (const auto& data_write_used_entry : rOther.mDataWriteUsedByThread) {
-      auto data_write_used_clone = dynamic_cast<LargeConstraintSet*>(data_write_used_entry.second->Clone());
-      mDataWriteUsedByThread.emplace(data_write_used_entry.first, data_write_used_clone);
-    }
   }
 
   MultiThreadMemoryConstraint::~MultiThreadMemoryConstraint()
   {
-    for (const auto& data_read_used_entry : mDataReadUsedByThread) {
-      delete data_read_used_entry.second;
-    }
-
-    for (const auto& data_write_used_entry : mDataWriteUsedByThread) {
-      delete data_write_used_entry.second;
-    }
   }
 
   void MultiThreadMemoryConstraint::Uninitialize()
   {
     MemoryConstraint::Uninitialize();
 
-    for (const auto& data_read_used_entry : mDataReadUsedByThread) {
-      data_read_used_entry.second->Clear();
-    }
-
-    for (const auto& data_write_used_entry : mDataWriteUsedByThread) {
-      data_write_used_entry.second->Clear();
+    for (auto& data_states_entry : mDataStatesByThread) {
+      data_states_entry.second.Clear();
     }
   }
 
   void MultiThreadMemoryConstraint::MarkDataUsedForType(cuint64 startAddress, cuint64 endAddress, const EMemAccessType memAccessType, cuint32 threadId)
   {
-    auto read_itr = mDataReadUsedByThread.find(threadId);
-    if (read_itr == mDataReadUsedByThread.end()) {
+    auto itr = mDataStatesByThread.find(threadId);
+    if (itr == mDataStatesByThread.end()) {
       return;
     }
 
-    LargeConstraintSet* data_read_used = read_itr->second;
-
-    auto write_itr = mDataWriteUsedByThread.find(threadId);
-    if (write_itr == mDataWriteUsedByThread.end()) {
-      return;
-    }
-
-    LargeConstraintSet* data_write_used = write_itr->second;
+    UpdateDataAccessStates(startAddress, endAddress, memAccessType, &(itr->second));
+  }
 
-    switch (memAccessType) {
-    case EMemAccessType::Read:
-      data_read_used->AddRange(startAddress, endAddress);
-      data_write_used->SubRange(startAddress, endAddress);
-      break;
-    case EMemAccessType::Write:
-      data_write_used->AddRange(startAddress, endAddress);
-      data_read_used->SubRange(startAddress, endAddress);
-      break;
-    default:
-      // Don't allow address reuse for other cases
-      break;
+  void MultiThreadMemoryConstraint::MarkDataShared(cuint64 startAddress, cuint64 endAddress)
+  {
+    for (auto& data_states_entry : mDataStatesByThread) {
+      data_states_entry.second.UpdateStates(startAddress, endAddress, DataAccessStates::smShared, 0);
     }
   }
 
-  const ConstraintSet* MultiThreadMemoryConstraint::DataReadUsed(cuint32 threadId) const
+  const DataAccessStates* MultiThreadMemoryConstraint::GetDataAccessStates(cuint32 threadId) const
   {
-    auto itr = mDataReadUsedByThread.find(threadId);
-    if (itr == mDataReadUsedByThread.end()) {
-      LOG(fail) << "{MultiThreadMemoryConstraint::DataReadUsed} read used memory constraint not found for Thread " << dec << threadId << endl;
-      FAIL("mem-constraint-not-found");
+    auto itr = mDataStatesByThread.find(threadId);
+    if (itr == mDataStatesByThread.end()) {
+      return nullptr;
     }
 
-    return itr->second->GetConstraintSet();
+    return &(itr->second);
   }
 
-  const ConstraintSet* MultiThreadMemoryConstraint::DataWriteUsed(cuint32 threadId) const
+  void MultiThreadMemoryConstraint::AccountMemory(MemoryUsage& rUsage) const
   {
-    auto itr = mDataWriteUsedByThread.find(threadId);
-    if (itr == mDataWriteUsedByThread.end()) {
-      LOG(fail) << "{MultiThreadMemoryConstraint::DataWriteUsed} write used memory constraint not found for Thread " << dec << threadId << endl;
-      FAIL("mem-constraint-not-found");
+    MemoryConstraint::AccountMemory(rUsage);
+    rUsage.Add(map_memory_bytes(mDataStatesByThread), 0);
+    for (const auto& states_item : mDataStatesByThread) {
+      states_item.second.AccountMemory(rUsage);
     }
-
-    return itr->second->GetConstraintSet();
   }
 
   LargeConstraintSet::LargeConstraintSet()
@@ -522,4 +517,124 @@ namespace Force {
     SetSubCached();
   }
 
+  void LargeConstraintSet::AccountMemory(MemoryUsage& rUsage) const
+  {
+    mpConstraintSet->AccountMemory(rUsage);
+    mpCachedAdds->AccountMemory(rUsage);
+    mpCachedSubs->AccountMemory(rUsage);
+  }
+
+  void DataAccessStates::UpdateStates(uint64 lower, uint64 upper, uint32 setStates, uint32 clearStates)
+  {
+    if (upper < lower) {
+      swap(lower, upper);
+    }
+
+    SplitAt(lower);
+    if (upper != MAX_UINT64) {
+      SplitAt(upper + 1);
+    }
+
+    // After splitting, every state range overlapping [lower, upper] lies entirely within it.
+    uint64 gap_lower = lower;
+    auto range_itr = mStateRanges.lower_bound(lower);
+    while (true) {
+      if ((range_itr == mStateRanges.end()) or (range_itr->first > upper)) {
+        if (setStates != 0) {
+          mStateRanges.emplace_hint(range_itr, gap_lower, StateRange{upper, setStates});
+        }
+        break;
+      }
+
+      if ((setStates != 0) and (range_itr->first > gap_lower)) {
+        mStateRanges.emplace_hint(range_itr, gap_lower, StateRange{range_itr->first - 1, setStates});
+      }
+
+      uint64 range_upper = range_itr->second.mUpper;
+      uint32 new_states = (range_itr->second.mStates & ~clearStates) | setStates;
+      if (new_states == 0) {
+        range_itr = mStateRanges.erase(range_itr);
+      }
+      else {
+        range_itr->second.mStates = new_states;
+        ++range_itr;
+      }
+
+      if (range_upper == upper) {
+        break;
+      }
+      gap_lower = range_upper + 1;
+    }
+
+    Coalesce(lower, upper);
+  }
+
+  void DataAccessStates::AccountMemory(MemoryUsage& rUsage) const
+  {
+    rUsage.Add(map_memory_bytes(mStateRanges), mStateRanges.size());
+  }
+
+  void DataAccessStates::GetMatching(const ConstraintSet& rConstrSet, uint32 states, ConstraintSet& rMatchingConstr) const
+  {
+    if (mStateRanges.empty()) {
+      return;
+    }
+
+    for (const Constraint* constr : rConstrSet.GetConstraints()) {
+      uint64 lower = constr->LowerBound();
+      uint64 upper = constr->UpperBound();
+
+      auto range_itr = mStateRanges.upper_bound(lower);
+      if (range_itr != mStateRanges.begin()) {
+        auto prev_itr = std::prev(range_itr);
+        if (prev_itr->second.mUpper >= lower) {
+          range_itr = prev_itr;
+        }
+      }
+
+      for (; (range_itr != mStateRanges.end()) and (range_itr->first <= upper); ++range_itr) {
+        if ((range_itr->second.mStates & states) != 0) {
+          rMatchingConstr.AddRange(max(lower, range_itr->first), min(upper, range_itr->second.mUpper));
+        }
+      }
+    }
+  }
+
+  void DataAccessStates::SplitAt(uint64 address)
+  {
+    auto range_itr = mStateRanges.upper_bound(address);
+    if (range_itr == mStateRanges.begin()) {
+      return;
+    }
+
+    --range_itr;
+    if ((range_itr->first < address) and (range_itr->second.mUpper >= address)) {
+      mStateRanges.emplace_hint(std::next(range_itr), address, StateRange{range_itr->second.mUpper, range_itr->second.mStates});
+      range_itr->second.mUpper = address - 1;
+    }
+  }
+
+  void DataAccessStates::Coalesce(uint64 lower, uint64 upper)
+  {
+    auto range_itr = mStateRanges.lower_bound(lower);
+    if (range_itr != mStateRanges.begin()) {
+      --range_itr;
+    }
+
+    while ((range_itr != mStateRanges.end()) and (range_itr->first <= upper)) {
+      auto next_itr = std::next(range_itr);
+      if (next_itr == mStateRanges.end()) {
+        break;
+      }
+
+      if ((range_itr->second.mUpper + 1 == next_itr->first) and (range_itr->second.mStates == next_itr->second.mStates)) {
+        range_itr->second.mUpper = next_itr->second.mUpper;
+        mStateRanges.erase(next_itr);
+      }
+      else {
+        range_itr = next_itr;
+      }
+    }
+  }
+
 }
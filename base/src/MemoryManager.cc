@@ -25,6 +25,7 @@
 #include "ImageIO.h"
 #include "Log.h"
 #include "Memory.h"
+#include "MemoryAccounting.h"
 #include "MemoryConstraint.h"
 #include "MemoryConstraintUpdate.h"
 #include "MemoryReservation.h"
@@ -34,6 +35,7 @@
 #include "PathUtils.h"
 #include "PhysicalPageManager.h"
 #include "Record.h"
+#include "SegmentJournal.h"
 #include "SymbolManager.h"
 #include "TestIO.h"
 #include "VmUtils.h"
@@ -69,6 +71,13 @@ namespace Force {
     delete mpMemTraitsManager;
   }
 
+  void MemoryBank::AccountConstraintMemory(MemoryUsage& rUsage) const
+  {
+    mpBaseConstraint->AccountMemory(rUsage);
+    mpFree->AccountMemory(rUsage);
+    mpUsable->AccountMemory(rUsage);
+  }
+
   EMemBankType MemoryBank::MemoryBankType() const
   {
     return mpMemory->MemoryBankType();
@@ -164,6 +173,11 @@ namespace Force {
     return mpUsable->Usable();
   }
 
+  bool MemoryBank::UsableContainsRange(uint64 lower, uint64 upper) const
+  {
+    return mpUsable->UsableContainsRange(lower, upper);
+  }
+
   const ConstraintSet* MemoryBank::Shared() const
   {
     return mpUsable->Shared();
@@ -271,7 +285,7 @@ namespace Force {
   }
 
   MemoryManager::MemoryManager()
-    : mMemoryBanks(), mConstraintConfigured(false), mReservations(), mPhysicalRegions()
+    : mMemoryBanks(), mConstraintConfigured(false), mReservations(), mPhysicalRegions(), mpSegmentJournal(nullptr)
   {
 
   }
@@ -368,6 +382,9 @@ namespace Force {
     LOG(info) << "InitializeMemory: " << memInitRecord->ToString() << endl;
     MemoryBank* mem_bank = GetMemoryBank(memInitRecord->MemoryId());
     mem_bank->InitializeMemory(*memInitRecord);
+    if (nullptr != mpSegmentJournal) {
+      mpSegmentJournal->RecordMemoryInit(*memInitRecord);
+    }
   }
 
   void MemoryManager::ReadMemoryPartiallyInitialized(const PaTuple& rPaTuple, cuint32 size, uint8* memData) const
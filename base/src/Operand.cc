@@ -247,19 +247,16 @@ namespace Force {
       else {
         auto choices_filter_raw = GetChoicesFilter(constr_set);
         std::unique_ptr<ChoicesFilter> choices_filter(choices_filter_raw);
-        auto clone_raw = dynamic_cast<ChoiceTree*>(choices_tree->Clone());
-        std::unique_ptr<ChoiceTree> clone_choices_tree(clone_raw);
-        clone_choices_tree->ApplyFilter(*choices_filter);
-        SetChooseResultWithConstraint(gen, instr, clone_choices_tree.get());
+        SetChooseResultWithConstraint(gen, instr, choices_tree, choices_filter.get());
       }
     } else {
-      SetChooseResultWithConstraint(gen, instr, choices_tree);
+      SetChooseResultWithConstraint(gen, instr, choices_tree, nullptr);
     }
   }
 
-  void ChoicesOperand::SetChooseResultWithConstraint(Generator& gen, Instruction& instr, const Choice *pChoiceTree)
+  void ChoicesOperand::SetChooseResultWithConstraint(Generator& gen, Instruction& instr, const Choice *pChoiceTree, const ChoicesFilter* pChoicesFilter)
   {
-    auto choice = pChoiceTree->Choose();
+    auto choice = (nullptr != pChoicesFilter) ? pChoiceTree->ChooseFiltered(*pChoicesFilter) : pChoiceTree->Choose();
     SetChoiceResult(gen, instr, choice);
   }
 
@@ -328,7 +325,7 @@ namespace Force {
     return new RegisterOperandConstraint();
   }
 
-  void RegisterOperand::SetChooseResultWithConstraint(Generator& gen, Instruction& instr, const Choice *pChoicesTree)
+  void RegisterOperand::SetChooseResultWithConstraint(Generator& gen, Instruction& instr, const Choice *pChoicesTree, const ChoicesFilter* pChoicesFilter)
   {
     const ConstraintSet *dep_constr = nullptr;
     EResourceType res_type = EResourceType(0);
@@ -338,25 +335,29 @@ namespace Force {
 
     if (nullptr != dep_constr && not dep_constr->IsEmpty()) {
       LOG(info) << "Operand " << Name() << " Filtering dependency constraint : \"" << dep_constr->ToSimpleString() << "\"" << endl;
-      std::unique_ptr<ChoicesFilter> choices_filter(GetChoicesFilter(dep_constr));
-      std::unique_ptr<ChoiceTree> clone_choices_tree(dynamic_cast<ChoiceTree*>(pChoicesTree->Clone()));
-      clone_choices_tree->ApplyFilter(*choices_filter);
+      std::unique_ptr<ChoicesFilter> dep_filter(GetChoicesFilter(dep_constr));
       try {
-        auto choice = clone_choices_tree->Choose();
+        const Choice* choice = nullptr;
+        if (nullptr != pChoicesFilter) {
+          CombinedChoicesFilter combined_filter(pChoicesFilter, dep_filter.get());
+          choice = pChoicesTree->ChooseFiltered(combined_filter);
+        }
+        else {
+          choice = pChoicesTree->ChooseFiltered(*dep_filter);
+        }
         SetChoiceResult(gen, instr, choice);
+        return;
       }
       catch (const ChoicesError& choices_error) {
         LOG(info) <<  "Operand " << Name() << " Filtering dependency constraint, reverted" << endl;
-        auto choice = pChoicesTree->Choose();
-        SetChoiceResult(gen, instr, choice);
       }
     }
     else {
       LOG(info)  << "Operand " << Name() << " No Dependency constraint" << endl;
-      auto choice = pChoicesTree->Choose();
-      SetChoiceResult(gen, instr, choice);
     }
 
+    ChoicesOperand::SetChooseResultWithConstraint(gen, instr, pChoicesTree, pChoicesFilter);
+
   }
 
   void RegisterOperand::SaveResource(const Generator& gen, const Instruction& rInstr) const
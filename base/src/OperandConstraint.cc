@@ -184,7 +184,9 @@ namespace Force {
 
   ChoicesOperandConstraint::~ChoicesOperandConstraint()
   {
-    delete mpChoiceTree;
+    if (not mChoiceTreeShared) {
+      delete mpChoiceTree;
+    }
   }
 
   void ChoicesOperandConstraint::Setup(const Generator& rGen, const Instruction& rInstr, const OperandStructure& rOperandStruct)
@@ -197,7 +199,15 @@ namespace Force {
     }
 
     try {
-      mpChoiceTree = choices_mod->CloneChoiceTree(cast_struct->mChoices[0]);
+      // The choice tree is only read from, so the baseline tree can be used directly when no choices modification applies to it.
+      const string& tree_name = cast_struct->mChoices[0];
+      if (choices_mod->HasModifications(tree_name)) {
+        mpChoiceTree = choices_mod->CloneChoiceTree(tree_name);
+      }
+      else {
+        mpChoiceTree = choices_mod->GetChoicesSet()->FindChoiceTree(tree_name);
+        mChoiceTreeShared = true;
+      }
     }
     catch (const ChoicesError& rChoicesErr) {
       LOG(fail) << "{ChoicesOperandConstraint::Setup} instruction: " << rInstr.FullName() << " operand: " << rOperandStruct.mName << " " << rChoicesErr.what() << endl;
@@ -325,8 +335,9 @@ namespace Force {
 
     // Implied registers don't have associated choices, as there is only one option, so we need to
     // create a single-choice tree here to fully set up the ChoicesOperandConstraint
-    mpChoiceTree = new ChoiceTree("ImpliedRegister", 0, 10);
-    mpChoiceTree->AddChoice(new Choice(implied_reg->Name(), mRegisterIndex, 10));
+    auto implied_tree = new ChoiceTree("ImpliedRegister", 0, 10);
+    implied_tree->AddChoice(new Choice(implied_reg->Name(), mRegisterIndex, 10));
+    mpChoiceTree = implied_tree;
 
     if (mConstraintForced) {
       LOG(info) << "constraint already forced, ignore reservation check" << endl;
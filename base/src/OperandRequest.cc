@@ -36,6 +36,12 @@ namespace Force {
     SetValueRequest(valueStr);
   }
 
+  OperandRequest::OperandRequest(const string& name, const ConstraintSet& rConstrSet)
+    : Object(), mName(name), mpValueConstraint(nullptr), mApplied(false), mIgnored(false)
+  {
+    SetValueRequest(rConstrSet);
+  }
+
   OperandRequest::OperandRequest(const OperandRequest& rOther)
     : Object(rOther), mName(rOther.mName), mpValueConstraint(nullptr), mApplied(false), mIgnored(false)
   {
@@ -84,4 +90,13 @@ namespace Force {
     mpValueConstraint = new ConstraintSet(valueStr);
   }
 
+  void OperandRequest::SetValueRequest(const ConstraintSet& rConstrSet)
+  {
+    if (nullptr != mpValueConstraint) {
+      delete mpValueConstraint;
+    }
+
+    mpValueConstraint = rConstrSet.Clone();
+  }
+
 }
@@ -32,13 +32,13 @@ using namespace std;
 namespace Force {
 
   PageTableEntry::PageTableEntry()
-    : Object(), mpStructure(nullptr), mAttributes(), mGenAttributes(), mPhysicalLower(0), mPhysicalUpper(0)
+    : Object(), mpStructure(nullptr), mAttributes(), mGenAttributes(), mPhysicalLower(0), mPhysicalUpper(0), mReferences(1)
   {
 
   }
 
   PageTableEntry::PageTableEntry(const PageTableEntry& rOther)
-    : Object(rOther), mpStructure(rOther.mpStructure), mAttributes(), mGenAttributes(), mPhysicalLower(rOther.mPhysicalLower), mPhysicalUpper(rOther.mPhysicalUpper)
+    : Object(rOther), mpStructure(rOther.mpStructure), mAttributes(), mGenAttributes(rOther.mGenAttributes), mPhysicalLower(rOther.mPhysicalLower), mPhysicalUpper(rOther.mPhysicalUpper), mReferences(1)
   {
     transform(rOther.mAttributes.cbegin(), rOther.mAttributes.cend(), back_inserter(mAttributes),
       [](const PteAttribute* pAttr) { return dynamic_cast<PteAttribute*>(pAttr->Clone()); });
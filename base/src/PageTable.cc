@@ -17,7 +17,9 @@
 
 #include <sstream>
 
+#include "Constraint.h"
 #include "Log.h"
+#include "MemoryAccounting.h"
 #include "Page.h"
 #include "PageInfoRecord.h"
 #include "PteAttribute.h"
@@ -51,7 +53,9 @@ namespace Force {
   PageTable::~PageTable()
   {
     for (auto entry_iter : mEntries) {
-      delete entry_iter.second;
+      if (entry_iter.second->ReleaseReference()) {
+        delete entry_iter.second;
+      }
     }
     // << "page table deleted." << endl;
   }
@@ -174,21 +178,132 @@ namespace Force {
 
   void PageTable::CommitPageTableEntry(uint64 pageStart, PageTableEntry* pPte, VmAddressSpace* pVmas)
   {
-    uint32 pte_index = GetPteIndex(pageStart);
-    auto pte_finder = mEntries.find(pte_index);
+    // a shared table is only shared when fully mapped by common pages, nothing private to one address space can be added to it.
+    const TablePte* table_pte = dynamic_cast<const TablePte* >(this);
+    if ((nullptr != table_pte) and table_pte->Shared()) {
+      LOG(fail) << "{PageTable::CommitPageTableEntry} inserting PTE into a table shared by several address spaces, " << PageTableInfo() << " descriptor: " << pPte->DescriptorDetails() << endl;
+      FAIL("pte-in-shared-table");
+    }
+
+    CommitPageTableEntryAt(GetPteIndex(pageStart), pPte, pVmas);
+  }
+
+  void PageTable::CommitPageTableEntryAt(uint32 pteIndex, PageTableEntry* pPte, VmAddressSpace* pVmas)
+  {
+    auto pte_finder = mEntries.find(pteIndex);
     if (pte_finder != mEntries.end()) {
-      LOG(fail) << "{PageTable::CommitPageTableEntry} inserting PTE where there is an existing PTE at index 0x" << hex << pte_index << " in " << this->PageTableInfo() << " descriptor: " << pPte->DescriptorDetails() << " existing descriptor: " << pte_finder->second->DescriptorDetails() << endl;
+      LOG(fail) << "{PageTable::CommitPageTableEntryAt} inserting PTE where there is an existing PTE at index 0x" << hex << pteIndex << " in " << this->PageTableInfo() << " descriptor: " << pPte->DescriptorDetails() << " existing descriptor: " << pte_finder->second->DescriptorDetails() << endl;
       FAIL("duplicated-pte-in-table");
     }
-    mEntries[pte_index] = pPte;
+    mEntries[pteIndex] = pPte;
+
+    WriteEntryDescriptor(pteIndex, pPte, pVmas);
+  }
 
-    // write descriptor to memory.
-    uint64 descr_addr = TableBase() + (pte_index << pVmas->GetControlBlock()->PteShift());
+  void PageTable::WriteEntryDescriptor(uint32 pteIndex, const PageTableEntry* pPte, VmAddressSpace* pVmas) const
+  {
+    uint64 descr_addr = TableBase() + (pteIndex << pVmas->GetControlBlock()->PteShift());
     uint64 descr_value = pPte->Descriptor();
     LOG(notice) << "Writing descriptor 0x" << hex << descr_value << " to address [" << uint32(mMemoryBank) << "]0x" << descr_addr << " size " << dec << pPte->DescriptorSize() << " " << pPte->DescriptorDetails() << endl;
     pVmas->WriteDescriptor(descr_addr, mMemoryBank, descr_value, pPte->DescriptorSize() / 8);
   }
 
+  void PageTable::ShareEntries(const PageTable& rSharingTable, const ConstraintSet& rVaRanges, VmAddressSpace* pVmas, const GenPageRequest& rPageReq)
+  {
+    uint64 entry_size = 1ull << mLowestLookUpBit;
+    for (auto entry_item : rSharingTable.mEntries) {
+      TablePte* sharing_table = dynamic_cast<TablePte* >(entry_item.second);
+      uint64 entry_va = 0;
+      uint64 mapped_size = 0;
+      if (nullptr != sharing_table) {
+        mapped_size = sharing_table->MappedSize(entry_va);
+        entry_va &= ~(entry_size - 1);
+      }
+      else {
+        const Page* sharing_page = dynamic_cast<const Page* >(entry_item.second);
+        entry_va = sharing_page->Lower();
+        mapped_size = sharing_page->PageSize();
+      }
+
+      ConstraintSet entry_ranges(entry_va, entry_va + entry_size - 1);
+      entry_ranges.ApplyConstraintSet(rVaRanges);
+      if ((0 == mapped_size) or entry_ranges.IsEmpty()) {
+        continue;
+      }
+
+      auto pte_finder = mEntries.find(entry_item.first);
+      if (pte_finder == mEntries.end()) {
+        if ((mapped_size == entry_size) and (entry_ranges.Size() == entry_size)) {
+          // the whole entry maps common pages, nothing private to either address space can be added below it.
+          entry_item.second->AddReference();
+          CommitPageTableEntryAt(entry_item.first, entry_item.second, pVmas);
+          if (nullptr != sharing_table) {
+            pVmas->CommitSharedTable(entry_va, this, sharing_table);
+            sharing_table->CommitSharedEntries(pVmas);
+          }
+          else {
+            pVmas->CommitSharedPage(dynamic_cast<const Page* >(entry_item.second));
+          }
+          continue;
+        }
+
+        if (nullptr == sharing_table) {
+          continue; // a page also mapping private addresses, the address space maps the common part on its own.
+        }
+
+        // the table also covers addresses private to the other address space, create an own table to share its entries.
+        TablePte* next_level_table = pVmas->CreateNextLevelTable(entry_ranges.LowerBound(), this, rPageReq);
+        CommitPageTableEntryAt(entry_item.first, next_level_table, pVmas);
+        next_level_table->ShareEntries(*sharing_table, rVaRanges, pVmas, rPageReq);
+        continue;
+      }
+
+      TablePte* next_level_table = dynamic_cast<TablePte* >(pte_finder->second);
+      if ((nullptr != sharing_table) and (nullptr != next_level_table) and (not next_level_table->Shared())) {
+        next_level_table->ShareEntries(*sharing_table, rVaRanges, pVmas, rPageReq);
+      }
+    }
+  }
+
+  void PageTable::CommitSharedEntries(VmAddressSpace* pVmas) const
+  {
+    for (auto entry_item : mEntries) {
+      const TablePte* table_pte = dynamic_cast<const TablePte* >(entry_item.second);
+      if (nullptr != table_pte) {
+        uint64 table_va = 0;
+        table_pte->MappedSize(table_va);
+        pVmas->CommitSharedTable(table_va, this, table_pte);
+        table_pte->CommitSharedEntries(pVmas);
+      }
+      else {
+        pVmas->CommitSharedPage(dynamic_cast<const Page* >(entry_item.second));
+      }
+    }
+  }
+
+  uint64 PageTable::MappedSize(uint64& rFirstVa) const
+  {
+    uint64 mapped_size = 0;
+    for (auto entry_item : mEntries) {
+      uint64 entry_va = 0;
+      const TablePte* table_pte = dynamic_cast<const TablePte* >(entry_item.second);
+      if (nullptr != table_pte) {
+        mapped_size += table_pte->MappedSize(entry_va);
+      }
+      else {
+        const Page* page_obj = dynamic_cast<const Page* >(entry_item.second);
+        entry_va = page_obj->Lower();
+        mapped_size += page_obj->PageSize();
+      }
+
+      if (entry_item.first == mEntries.begin()->first) {
+        rFirstVa = entry_va;
+      }
+    }
+
+    return mapped_size;
+  }
+
   const string PageTable::PageTableInfo() const
   {
     stringstream out_str;
@@ -198,6 +313,25 @@ namespace Force {
     return out_str.str();
   }
 
+  void PageTable::AccountMemory(MemoryUsage& rUsage, set<const PageTableEntry* >& rAccountedEntries) const
+  {
+    rUsage.Add(map_memory_bytes(mEntries), 0);
+    for (auto entry_iter : mEntries) {
+      if (not rAccountedEntries.insert(entry_iter.second).second) {
+        continue; // shared with a table accounted before.
+      }
+
+      const TablePte* table_pte = dynamic_cast<const TablePte* >(entry_iter.second);
+      if (nullptr != table_pte) {
+        rUsage.Add(sizeof(TablePte), 1);
+        table_pte->AccountMemory(rUsage, rAccountedEntries);
+      }
+      else {
+        rUsage.Add(sizeof(Page), 1);
+      }
+    }
+  }
+
   RootPageTable::RootPageTable()
     : PageTable(), mHighestLookUpBit(0), mTableStep(0), mPteShift(0), mMaxTableLevel(0), mpBaseAddressSpace(nullptr), mTableIdentifier(""), mAddressSpaces()
   {
@@ -17,10 +17,12 @@
 
 #include <algorithm>
 #include <memory>
+#include <set>
 
 #include "Constraint.h"
 #include "Defines.h"
 #include "Log.h"
+#include "MemoryAccounting.h"
 #include "Page.h"
 #include "PageTable.h"
 #include "PageTableAllocator.h"
@@ -29,6 +31,7 @@
 #include "VmAddressSpace.h"
 #include "VmConstraint.h"
 #include "VmUtils.h"
+#include "VmasControlBlock.h"
 
 using namespace std;
 
@@ -115,6 +118,42 @@ namespace Force
     UpdateVmConstraints(pRootTable);
   }
 
+  bool PageTableManager::HasRootPageTable(uint64 tableBase) const
+  {
+    return any_of(mRootPageTables.cbegin(), mRootPageTables.cend(),
+      [tableBase](const RootPageTable* pRootTable) { return (pRootTable->TableBase() == tableBase); });
+  }
+
+  const VmAddressSpace* PageTableManager::PageTableSharingAddressSpace(const VmAddressSpace* pVmas) const
+  {
+    for (auto root_table : mRootPageTables)
+    {
+      auto base_vmas = root_table->GetBaseVmas();
+      if ((nullptr == base_vmas) or (root_table == pVmas->GetControlBlock()->GetRootPageTable()))
+      {
+        continue;
+      }
+
+      if (base_vmas->IsInitialized() and base_vmas->GetControlBlock()->CompatiblePageTableContext(pVmas->GetControlBlock()))
+      {
+        return base_vmas;
+      }
+    }
+
+    return nullptr;
+  }
+
+  void PageTableManager::AccountMemory(MemoryUsage& rUsage) const
+  {
+    rUsage.Add(vector_memory_bytes(mRootPageTables), 0);
+    set<const PageTableEntry* > accounted_entries; // tables and pages shared by root tables are accounted once.
+    for (auto rpt : mRootPageTables)
+    {
+      rUsage.Add(sizeof(RootPageTable), 1);
+      rpt->AccountMemory(rUsage, accounted_entries);
+    }
+  }
+
   bool PageTableManager::AllocatePageTable(VmAddressSpace* pVmas)
   {
     //need to collect the current context/page table representation of the current context
@@ -69,6 +69,13 @@ namespace Force {
     return chosen_ptr->Value();
   }
 
+  bool PagingChoicesAdapter::PlainPagingChoiceEnabled(const string& rChoiceName, uint32 value) const
+  {
+    std::unique_ptr<ChoiceTree> choices_tree(mpPagingChoices->CloneChoiceTree(rChoiceName));
+    const ChoiceTree* const_tree = choices_tree.get();
+    return const_tree->FindChoiceByValue(value)->HasChoice();
+  }
+
   uint64 PagingChoicesAdapter::GetPagingChoice(const string& rChoiceName) const
   {
     string full_name = PagingChoicesName(rChoiceName);
@@ -21,6 +21,7 @@
 #include "Constraint.h"
 #include "GenRequest.h"
 #include "Log.h"
+#include "MemoryAccounting.h"
 #include "MemoryConstraintUpdate.h"
 #include "MemoryTraits.h"
 #include "Page.h"
@@ -433,6 +434,25 @@ namespace Force
     }
   }
 
+  void PhysicalPageManager::AccountMemory(MemoryUsage& rUsage) const
+  {
+    for (auto constr_set : {mpBoundary, mpFreeRanges, mpAllocatedRanges, mpAliasExcludeRanges})
+    {
+      if (constr_set != nullptr)
+      {
+        constr_set->AccountMemory(rUsage);
+      }
+    }
+
+    rUsage.Add(map_memory_bytes(mUsablePageAligned), 0);
+    for (const auto& aligned_item : mUsablePageAligned)
+    {
+      aligned_item.second->AccountMemory(rUsage);
+    }
+
+    rUsage.Add(vector_memory_bytes(mPhysicalPages) + mPhysicalPages.size() * sizeof(PhysicalPage), mPhysicalPages.size());
+  }
+
   const Page* PhysicalPageManager::GetVirtualPage(uint64 PA, const VmAddressSpace* pVmas) const
   {
     PhysicalPage* phys_page = FindPhysicalPage(PA, PA);
@@ -20,6 +20,7 @@
 #include "pybind11/eval.h"
 #include "pybind11/stl.h"
 
+#include "ApiCallRecord.h"
 #include "Config.h"
 #include "Constraint.h"
 #include "Constraint.h"
@@ -37,6 +38,12 @@ using namespace std;
 
 namespace Force {
 
+  PyInterface::~PyInterface()
+  {
+    delete mpApiRecorder;
+    delete mpApiReplayer;
+  }
+
   py::object PyInterface::LoadTestTemplate(const std::string& templatePath, py::object& globals)
   {
     string module_name = get_file_stem(templatePath);
@@ -99,7 +106,7 @@ namespace Force {
       modfile_module = GetLibModuleName(cfg_ptr->LookUpFile(mod_file));
 
     py::object env_class_obj = templateObj.attr("EnvClass");
-    mEnvObject = env_class_obj(*this);
+    mEnvObject = env_class_obj(py::cast(this, py::return_value_policy::reference)); // the front-end shares this interface, including its API call recorder and replayer
     mTemplateObject = templateObj;
     mEnvObject.attr("defaultGenClass") = templateObj.attr("GenThreadClass");
     mEnvObject.attr("defaultSeqClass") = templateObj.attr("MainSequenceClass");
@@ -116,7 +123,13 @@ namespace Force {
       mEnvObject.attr("genThreadInitFunc") = gen_thread_init;
     }
     mEnvObject.attr("configureMemory")(memfile_module);
-    mpScheduler->ConfigureMemoryBanks();
+    if (nullptr != mpApiRecorder) {
+      ApiCallScope call_scope(mpApiRecorder, "configureMemoryBanks", py::tuple());
+      mpScheduler->ConfigureMemoryBanks();
+    }
+    else {
+      mpScheduler->ConfigureMemoryBanks();
+    }
     mEnvObject.attr("setup")();
 
     if (modfile_module != "")
@@ -128,15 +141,57 @@ namespace Force {
     mEnvObject = py::none();
   }
 
+  /*!
+    Set up recording the API calls made by the test template, or replaying recorded calls, if specified on the command line.
+  */
+  void PyInterface::SetupApiCallRecord()
+  {
+    Config* cfg_ptr = Config::Instance();
+    if (cfg_ptr->ApiRecordFile().empty() and cfg_ptr->ApiReplayFile().empty()) {
+      return;
+    }
+
+    if (not (cfg_ptr->ApiRecordFile().empty() or cfg_ptr->ApiReplayFile().empty())) {
+      LOG(fail) << "{PyInterface::SetupApiCallRecord} can't record and replay template API calls at the same time." << endl;
+      FAIL("api-record-and-replay");
+    }
+
+    // the calls of the generator threads interleave according to the thread scheduling in the front end, which is not replayed.
+    if (cfg_ptr->NumChips() * cfg_ptr->NumCores() * cfg_ptr->NumThreads() > 1) {
+      LOG(fail) << "{PyInterface::SetupApiCallRecord} recording and replaying template API calls is only supported with one generator thread." << endl;
+      FAIL("api-record-multiple-threads");
+    }
+
+    if (not cfg_ptr->ApiRecordFile().empty()) {
+      mpApiRecorder = new ApiCallRecorder(cfg_ptr->ApiRecordFile());
+    }
+    else {
+      mpApiReplayer = new ApiCallReplayer(cfg_ptr->ApiReplayFile());
+      ApiCallReplayer::RegisterApi("configureMemoryBanks", [this](PyInterface& rInterface, const py::tuple& rArgs) { mpScheduler->ConfigureMemoryBanks(); });
+    }
+  }
+
   void PyInterface::RunTest()
   {
+    SetupApiCallRecord();
     try {
+      if (nullptr != mpApiReplayer) {
+        mpApiReplayer->Run(*this);
+        return;
+      }
+
       std::string template_path = Config::Instance()->TestTemplate();
       SetupModulePaths(template_path);
+      if (nullptr != mpApiRecorder) {
+        mpApiRecorder->Start();
+      }
       py::module main = py::module::import("__main__");
       py::object globals = main.attr("__dict__");
       py::object template_obj = LoadTestTemplate(template_path, globals);
       GenerateTemplate(template_obj);
+      if (nullptr != mpApiRecorder) {
+        mpApiRecorder->Finish();
+      }
     }
     catch (const py::error_already_set& pye) {
       LOG(fail) << "Error running template: " << pye.what() << endl;
@@ -147,6 +202,15 @@ namespace Force {
   uint32 PyInterface::CallBackTemplate(uint32 threadId, ECallBackTemplateType callBackType, const std::string& primaryValue, const std::map<std::string, uint64>& callBackValues)
   {
     LOG(notice) << "Call back entering [" << ECallBackTemplateType_to_string(callBackType) << "] gen(" << hex << threadId << ")." << endl;
+    if (nullptr != mpApiReplayer) {
+      mpApiReplayer->ReplayCallBack(ECallBackTemplateType_to_string(callBackType));
+      LOG(notice) << "Call back exiting [" << ECallBackTemplateType_to_string(callBackType) << "] gen(" << hex << threadId << ")." << endl;
+      return 0;
+    }
+
+    if (nullptr != mpApiRecorder) {
+      mpApiRecorder->EnterCallBack(ECallBackTemplateType_to_string(callBackType));
+    }
     switch (callBackType) {
     case ECallBackTemplateType::SetBntSeq:
       {
@@ -190,6 +254,9 @@ namespace Force {
       LOG(fail) << "Unknown call back template type" << ECallBackTemplateType_to_string(callBackType) << endl;
         FAIL("unknown call back tempate type");
     }
+    if (nullptr != mpApiRecorder) {
+      mpApiRecorder->ExitCallBack(0);
+    }
     LOG(notice) << "Call back exiting [" << ECallBackTemplateType_to_string(callBackType) << "] gen(" << hex << threadId << ")." << endl;
     return 0;
   }
@@ -231,6 +298,25 @@ namespace Force {
     return cast_value;
   }
 
+  /*!
+    Convert a Python list of values and (lower bound, upper bound) ranges to a ConstraintSet.
+  */
+  static void cast_py_range_list(const std::string& rKey, const py::handle& rListObj, ConstraintSet& rConstrSet)
+  {
+    for (const auto& item : rListObj) {
+      if (py::isinstance<py::int_>(item)) {
+        rConstrSet.AddValue(cast_py_int(item));
+      }
+      else if ((py::isinstance<py::tuple>(item) or py::isinstance<py::list>(item)) and (py::len(item) == 2)) {
+        rConstrSet.AddRange(cast_py_int(item[py::int_(0)]), cast_py_int(item[py::int_(1)]));
+      }
+      else {
+        LOG(fail) << "not handled range list item " << item << " of key " << rKey << endl;
+        FAIL("not-handled-range-list-item");
+      }
+    }
+  }
+
   /*!
     Template function to process Transaction details, primarily for GenRequest and GenQuery based objects.
   */
@@ -247,6 +333,13 @@ namespace Force {
         //uint64 value = value_obj.cast<uint64>();
         uint64 value = cast_py_int(value_obj);
         trans->AddDetail(key, value);
+      } else if (py::isinstance<ConstraintSet>(value_obj)) {
+        // passed without converting to and parsing the range list string.
+        trans->AddDetail(key, value_obj.cast<const ConstraintSet&>());
+      } else if (py::isinstance<py::list>(value_obj)) {
+        ConstraintSet constr_set;
+        cast_py_range_list(key, value_obj, constr_set);
+        trans->AddDetail(key, constr_set);
       } else {
         LOG(fail) << "not handled key " << key << " value " << value_obj << endl;
         FAIL("not-handled key");
@@ -900,6 +993,51 @@ namespace Force {
     return ret_tuple;
   }
 
+  bool PyInterface::PrepareSegmentFork(uint32 threadId)
+  {
+    return mpScheduler->PrepareSegmentFork(threadId);
+  }
+
+  void PyInterface::BeginSegment(uint32 threadId, uint64 seed, const std::string& simTraceFile)
+  {
+    RejectRecordedSegmentApi("beginSegment");
+    mpScheduler->BeginSegment(threadId, seed, simTraceFile);
+  }
+
+  void PyInterface::EndSegment(uint32 threadId, const std::string& journalFile)
+  {
+    RejectRecordedSegmentApi("endSegment");
+    mpScheduler->EndSegment(threadId, journalFile);
+  }
+
+  py::object PyInterface::ImportSegment(uint32 threadId, const std::string& journalFile)
+  {
+    RejectRecordedSegmentApi("importSegment");
+    vector<SegmentJournal::JournalRegisterValue> live_in_registers;
+    mpScheduler->ImportSegment(threadId, journalFile, live_in_registers);
+
+    py::list live_in_list;
+    for (const auto& live_in : live_in_registers) {
+      live_in_list.append(py::make_tuple(live_in.mName, live_in.mValue, live_in.mMask));
+    }
+    return live_in_list;
+  }
+
+  void PyInterface::ImportSegmentState(uint32 threadId, const std::string& journalFile)
+  {
+    RejectRecordedSegmentApi("importSegmentState");
+    mpScheduler->ImportSegmentState(threadId, journalFile);
+  }
+
+  void PyInterface::RejectRecordedSegmentApi(const std::string& rName) const
+  {
+    // segments are generated in sequence when recording, see Scheduler::PrepareSegmentFork, so these calls are never expected.
+    if (nullptr != mpApiRecorder) {
+      LOG(fail) << "{PyInterface::RejectRecordedSegmentApi} \"" << rName << "\" can't be called when API calls are recorded, call prepareSegmentFork first." << endl;
+      FAIL("segment-api-recorded");
+    }
+  }
+
   py::object PyInterface::GenFreePagesRange(uint32 threadId, const py::dict& parms) const
   {
     GenFreePageRequest free_page_req;
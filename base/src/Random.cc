@@ -16,6 +16,7 @@
 #include "Random.h"
 
 #include <random>
+#include <unordered_set>
 
 #include "Log.h"
 
@@ -28,14 +29,36 @@ using namespace std;
 
 namespace Force {
 
+  /*!
+    \class CountingEngine
+    \brief Random number engine adaptor counting the values drawn from the underlying engine.
+   */
+  template <class Engine>
+  class CountingEngine {
+  public:
+    typedef typename Engine::result_type result_type; //!< Type define required by STL
+
+    static constexpr result_type min() { return Engine::min(); }
+    static constexpr result_type max() { return Engine::max(); }
+
+    CountingEngine() : mEngine(), mDraws(0) { } //!< Constructor.
+    result_type operator () () { ++ mDraws; return mEngine(); } //!< Draw the next value.
+    void seed(result_type value) { mEngine.seed(value); } //!< Seed the underlying engine.
+    void discard(uint64 draws) { mEngine.discard(draws); mDraws += draws; } //!< Skip values.
+    uint64 Draws() const { return mDraws; } //!< Return the number of values drawn so far.
+  private:
+    Engine mEngine; //!< Underlying random number engine.
+    uint64 mDraws; //!< Number of values drawn from the underlying engine.
+  };
+
   /*!
     \struct RandomEngine
     \brief internal struct pointing to 32-bit and 64-bit random number engine in use
    */
   struct RandomEngine {
     RandomEngine() : mEngine32(), mEngine64() { }
-    std::mt19937 mEngine32;    //!< Instance of 32-bit random number engine in use
-    std::mt19937_64 mEngine64; //!< Instance of 64-bit random number engine in use
+    CountingEngine<std::mt19937> mEngine32;    //!< Instance of 32-bit random number engine in use
+    CountingEngine<std::mt19937_64> mEngine64; //!< Instance of 64-bit random number engine in use
   };
 
   Random* Random::mspRandom = nullptr;
@@ -92,10 +115,62 @@ namespace Force {
     return dist64(mpRandomEngine->mEngine64);
   }
 
+  void Random::Random64Values(uint64 min, uint64 max, uint64 count, bool unique, vector<uint64>& rValues) const
+  {
+    rValues.clear();
+    rValues.reserve(count);
+    if (not unique) {
+      // same values as count Random64 calls.
+      std::uniform_int_distribution<uint64> dist64(min, max);
+      for (uint64 i = 0; i < count; ++ i) {
+        rValues.push_back(dist64(mpRandomEngine->mEngine64));
+      }
+      return;
+    }
+
+    if (0 == count) {
+      return;
+    }
+    if (count - 1 > max - min) {
+      LOG(fail) << "{Random::Random64Values} unable to obtain " << dec << count << " different values in the range [0x" << hex << min << ", 0x" << max << "]." << endl;
+      FAIL("too-many-unique-random-values");
+    }
+
+    // Floyd's sampling algorithm draws exactly count values, shuffle them afterwards since it doesn't pick them in a random order.
+    unordered_set<uint64> picked;
+    for (uint64 j = max - (count - 1); ; ++ j) {
+      uint64 value = Random64(min, j);
+      if (not picked.insert(value).second) {
+        value = j;
+        picked.insert(value);
+      }
+      rValues.push_back(value);
+      if (j == max) {
+        break;
+      }
+    }
+
+    for (uint64 i = rValues.size() - 1; i > 0; -- i) {
+      swap(rValues[i], rValues[Random64(0, i)]);
+    }
+  }
+
   double Random::RandomReal(double min, double max) const
   {
     std::uniform_real_distribution<double> dist(min, max);
     return dist(mpRandomEngine->mEngine64);
   }
 
+  void Random::GetDrawCounts(uint64& rDraws32, uint64& rDraws64) const
+  {
+    rDraws32 = mpRandomEngine->mEngine32.Draws();
+    rDraws64 = mpRandomEngine->mEngine64.Draws();
+  }
+
+  void Random::Discard(uint64 draws32, uint64 draws64)
+  {
+    mpRandomEngine->mEngine32.discard(draws32);
+    mpRandomEngine->mEngine64.discard(draws64);
+  }
+
 }
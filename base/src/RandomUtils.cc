@@ -32,6 +32,26 @@ namespace Force {
     return Random::Instance()->Random64(min, max);
   }
 
+  void random_values64(uint64 min, uint64 max, uint64 count, uint64 align, bool unique, vector<uint64>& rValues)
+  {
+    if (0 == align) {
+      LOG(fail) << "{random_values64} zero alignment." << endl;
+      FAIL("zero-random-value-alignment");
+    }
+
+    uint64 first_value = min + (align - min % align) % align;
+    if ((first_value < min) or (first_value > max)) {
+      LOG(fail) << "{random_values64} no value aligned to 0x" << hex << align << " in range [0x" << min << ", 0x" << max << "]." << endl;
+      FAIL("no-aligned-random-value");
+    }
+
+    uint64 max_index = (max - first_value) / align;
+    Random::Instance()->Random64Values(0, max_index, count, unique, rValues);
+    for (auto& value : rValues) {
+      value = first_value + value * align;
+    }
+  }
+
   double random_real(double min, double max)
   {
     return Random::Instance()->RandomReal(min, max);
@@ -21,6 +21,7 @@
 #include <sstream>
 
 #include "Log.h"
+#include "MemoryAccounting.h"
 #include "UtilityFunctions.h"
 
 using namespace std;
@@ -226,4 +227,13 @@ namespace Force {
   {
     rSwapVec.swap(mRecords);
   }
+
+  void RecordArchive::AccountMemory(MemoryUsage& rUsage) const
+  {
+    rUsage.Add(vector_memory_bytes(mRecords), 0);
+    for (auto rec_item : mRecords) {
+      // the data and attribute buffers are each Size() bytes long.
+      rUsage.Add(sizeof(MemoryInitRecord) + 2 * rec_item->Size(), 1);
+    }
+  }
 }
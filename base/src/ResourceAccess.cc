@@ -417,42 +417,43 @@ namespace Force {
     return out_str.str();
   }
 
-  ResourceAccessQueue::ResourceAccessQueue()
-    : Object(), mAge(0), mHistoryLimit(0), mIndex(0), mLookUpFar(), mLookUpNear(), mpReturnConstraint(nullptr), mQueue(), mTypeAges(), mTypeEntropies()
-  {
-
-  }
-
-  ResourceAccessQueue::ResourceAccessQueue(const ResourceAccessQueue& rOther)
-    : Object(rOther), mAge(0), mHistoryLimit(0), mIndex(0), mLookUpFar(), mLookUpNear(), mpReturnConstraint(nullptr), mQueue(), mTypeAges(), mTypeEntropies()
+  ResourceAccessCheckpoint::ResourceAccessCheckpoint(uint32 age, uint32 index, const vector<ResourceTypeEntropy* >& rTypeEntropies)
+    : mAge(age), mIndex(index), mTypeEntropies(), mSavedStages(), mSavedAges()
   {
-    // << "copy constructor const version" << endl;
+    for (auto entropy : rTypeEntropies) {
+      mTypeEntropies.push_back(dynamic_cast<ResourceTypeEntropy* >(entropy->Clone()));
+    }
   }
 
-  ResourceAccessQueue::ResourceAccessQueue(ResourceAccessQueue& rOther)
-    : Object(rOther), mAge(rOther.mAge), mHistoryLimit(rOther.mHistoryLimit), mIndex(rOther.mIndex), mLookUpFar(rOther.mLookUpFar), mLookUpNear(rOther.mLookUpNear), mpReturnConstraint(nullptr), mQueue(), mTypeAges(), mTypeEntropies()
+  ResourceAccessCheckpoint::~ResourceAccessCheckpoint()
   {
-    // << "copy constructor non-const version" << endl;
-    mpReturnConstraint = dynamic_cast<ConstraintSet* >(rOther.mpReturnConstraint->Clone());
-    for (auto other_stage : rOther.mQueue) {
-      auto stage = dynamic_cast<ResourceAccessStage* >(other_stage->Clone());
-      mQueue.push_back(stage);
+    for (auto entropy_item : mTypeEntropies) {
+      delete entropy_item;
     }
 
-    for (auto other_age : rOther.mTypeAges) {
-      auto age = dynamic_cast<ResourceTypeAges* >(other_age->Clone());
-      mTypeAges.push_back(age);
+    for (auto & saved_item : mSavedStages) {
+      delete saved_item.second;
     }
+  }
 
-    for (auto other_entropy : rOther.mTypeEntropies) {
-      auto entropy = dynamic_cast<ResourceTypeEntropy* >(other_entropy->Clone());
-      mTypeEntropies.push_back(entropy);
-    }
+  ResourceAccessQueue::ResourceAccessQueue()
+    : Object(), mAge(0), mHistoryLimit(0), mIndex(0), mLookUpFar(), mLookUpNear(), mpReturnConstraint(nullptr), mQueue(), mTypeAges(), mTypeEntropies(), mCheckpoints()
+  {
 
   }
 
+  ResourceAccessQueue::ResourceAccessQueue(const ResourceAccessQueue& rOther)
+    : Object(rOther), mAge(0), mHistoryLimit(0), mIndex(0), mLookUpFar(), mLookUpNear(), mpReturnConstraint(nullptr), mQueue(), mTypeAges(), mTypeEntropies(), mCheckpoints()
+  {
+    // << "copy constructor const version" << endl;
+  }
+
   ResourceAccessQueue::~ResourceAccessQueue()
   {
+    for (auto checkpoint : mCheckpoints) {
+      delete checkpoint;
+    }
+
     delete mpReturnConstraint;
 
     for (auto acc_entry : mQueue) {
@@ -503,9 +504,61 @@ namespace Force {
     auto retired_stage = mQueue[mIndex];
     retired_stage->Retire(mIndex, mTypeEntropies);
     mQueue[mIndex] = nullptr;
+
+    // keep the stage if the latest checkpoint needs it to restore the slot.
+    if (not mCheckpoints.empty()) {
+      auto insert_result = mCheckpoints.back()->mSavedStages.emplace(mIndex, retired_stage);
+      if (insert_result.second) {
+        return;
+      }
+    }
     delete retired_stage;
   }
 
+  ResourceAccessStage* ResourceAccessQueue::ModifiableAccessStage(uint32 dist)
+  {
+    uint32 queue_index = GetQueueIndex(dist);
+    if (not mCheckpoints.empty()) {
+      auto insert_result = mCheckpoints.back()->mSavedStages.emplace(queue_index, mQueue[queue_index]);
+      if (insert_result.second) {
+        mQueue[queue_index] = dynamic_cast<ResourceAccessStage* >(mQueue[queue_index]->Clone());
+      }
+    }
+    return mQueue[queue_index];
+  }
+
+  ResourceAccessCheckpoint* ResourceAccessQueue::TakeCheckpoint()
+  {
+    auto checkpoint = new ResourceAccessCheckpoint(mAge, mIndex, mTypeEntropies);
+    mCheckpoints.push_back(checkpoint);
+    return checkpoint;
+  }
+
+  void ResourceAccessQueue::RestoreCheckpoint(ResourceAccessCheckpoint* pCheckpoint)
+  {
+    if (mCheckpoints.empty() or (mCheckpoints.back() != pCheckpoint)) {
+      LOG(fail) << "{ResourceAccessQueue::RestoreCheckpoint} checkpoints are expected to be restored in the reverse order they are taken." << endl;
+      FAIL("restore-checkpoint-out-of-order");
+    }
+    mCheckpoints.pop_back();
+
+    for (auto & saved_item : pCheckpoint->mSavedStages) {
+      delete mQueue[saved_item.first];
+      mQueue[saved_item.first] = saved_item.second;
+    }
+    pCheckpoint->mSavedStages.clear();
+
+    // restore the ages in the reverse order they were changed, the earliest saved value of an entry is the one to keep.
+    for (auto age_iter = pCheckpoint->mSavedAges.crbegin(); age_iter != pCheckpoint->mSavedAges.crend(); ++ age_iter) {
+      mTypeAges[EResourceTypeBaseType(age_iter->ResourceType())]->RestoreAccessAge(*age_iter);
+    }
+
+    mTypeEntropies.swap(pCheckpoint->mTypeEntropies);
+    mAge = pCheckpoint->mAge;
+    mIndex = pCheckpoint->mIndex;
+    delete pCheckpoint;
+  }
+
   void ResourceAccessQueue::Commit(ResourceAccessStage* pHotResource)
   {
     RetireReuseStage();
@@ -601,6 +654,7 @@ namespace Force {
 
     for (EResourceTypeBaseType i = 0; i < EResourceTypeSize; ++ i) {
       auto age_container = mTypeAges[i];
+      vector<AccessAge>* saved_ages = mCheckpoints.empty() ? nullptr : &(mCheckpoints.back()->mSavedAges);
 
       // Update source register ages.
       auto src_constr = src_accesses[i];
@@ -608,6 +662,9 @@ namespace Force {
         vector<uint64> regs;
         src_constr->GetValues(regs);
         for (auto reg : regs) {
+          if (nullptr != saved_ages) {
+            saved_ages->push_back(age_container->GetAccessAge(reg));
+          }
           age_container->UpdateAge(reg, stage_age, EAccessAgeType::Read, this);
         }
       }
@@ -618,6 +675,9 @@ namespace Force {
         vector<uint64> regs;
         dest_constr->GetValues(regs);
         for (auto reg : regs) {
+          if (nullptr != saved_ages) {
+            saved_ages->push_back(age_container->GetAccessAge(reg));
+          }
           age_container->UpdateAge(reg, stage_age, EAccessAgeType::Write, this);
         }
       }
@@ -653,6 +713,7 @@ namespace Force {
     auto access_stage = GetAccessStage(stage_dist);
     // << "access stage: " << access_stage->ToSimpleString() << endl;
     if (access_stage->HasSourceAccess(index, resType)) {
+      access_stage = ModifiableAccessStage(stage_dist);
       access_stage->RemoveSourceAccess(index, resType);
       auto type_entropy = mTypeEntropies[EResourceTypeBaseType(resType)];
       type_entropy->SourceEntropy().Decrease();
@@ -675,6 +736,7 @@ namespace Force {
     auto access_stage = GetAccessStage(stage_dist);
     // << "access stage: " << access_stage->ToSimpleString() << endl;
     if (access_stage->HasDestAccess(index, resType)) {
+      access_stage = ModifiableAccessStage(stage_dist);
       access_stage->RemoveDestAccess(index, resType);
       auto type_entropy = mTypeEntropies[EResourceTypeBaseType(resType)];
       type_entropy->DestEntropy().Decrease();
@@ -49,22 +49,6 @@ namespace Force {
     // << "copy constructor const version" << endl;
   }
 
-  ResourceDependence::ResourceDependence(ResourceDependence& rOther)
-    : ResourceAccessQueue((ResourceAccessQueue&) rOther), mpDependenceTree(nullptr), mpSourceTree(nullptr), mpTargetTree(nullptr), mpPriorityTree(nullptr),
-      mpOptimalDirectionTree(nullptr), mpWindowVariable(nullptr), mpSourceEntropyWindow(nullptr), mpTargetEntropyWindow(nullptr), mpGenerator(rOther.mpGenerator)
-
-  {
-    // << "copy constructor non-const version" << endl;
-    mpDependenceTree = dynamic_cast<ChoiceTree* >(rOther.mpDependenceTree->Clone());
-    mpSourceTree = dynamic_cast<ChoiceTree* >(rOther.mpSourceTree->Clone());
-    mpTargetTree = dynamic_cast<ChoiceTree* >(rOther.mpTargetTree->Clone());
-    mpPriorityTree = dynamic_cast<ChoiceTree* >(rOther.mpPriorityTree->Clone());
-    mpOptimalDirectionTree = dynamic_cast<ChoiceTree* >(rOther.mpOptimalDirectionTree->Clone());
-    mpWindowVariable = dynamic_cast<ChoiceVariable* >(rOther.mpWindowVariable->Clone());
-    mpSourceEntropyWindow = dynamic_cast<Variable* >(rOther.mpSourceEntropyWindow->Clone());
-    mpTargetEntropyWindow = dynamic_cast<Variable* >(rOther.mpTargetEntropyWindow->Clone());
-  }
-
   ResourceDependence::~ResourceDependence()
   {
     delete mpDependenceTree;
@@ -83,11 +67,6 @@ namespace Force {
     return new ResourceDependence((const ResourceDependence&) *this);
   }
 
-  const ResourceDependence* ResourceDependence::Snapshot() const
-  {
-    return new ResourceDependence((ResourceDependence&) *this);
-  }
-
   const std::string ResourceDependence::ToString() const
   {
     return ResourceAccessQueue::ToString();
@@ -284,8 +284,8 @@ namespace Force {
   bool DependencePeState::DoStateRecovery(Generator* pGen, SimAPI* pSim) const
   {
     // << "{DependencePeState::DoStateRecovery}" << ToString() << endl;
-    pGen->SetDependenceInstance(const_cast<ResourceDependence* >(mpDependence));
-    mpDependence = nullptr;
+    mpDependence->RestoreCheckpoint(mpCheckpoint);
+    mpCheckpoint = nullptr;
 
     return false;
   }
@@ -16,6 +16,7 @@
 #include "Scheduler.h"
 
 #include <algorithm>
+#include <iostream>
 
 #include "Architectures.h"
 #include "ChoicesModerator.h"
@@ -26,14 +27,20 @@
 #include "Generator.h"
 #include "ImageIO.h"
 #include "Log.h"
+#include "MemoryAccounting.h"
 #include "MemoryManager.h"
 #include "PyInterface.h"
+#include "Random.h"
 #include "RegisteredSetModifier.h"
 #include "SchedulingStrategy.h"
+#include "SegmentJournal.h"
 #include "SemaphoreManager.h"
+#include "SimAPI.h"
 #include "SynchronizeBarrier.h"
 #include "ThreadGroup.h"
 #include "UtilityAlgorithms.h"
+#include "VmManager.h"
+#include "VmMapper.h"
 
 using namespace std;
 
@@ -71,7 +78,17 @@ namespace Force {
     mCoresLimit = config_ptr->LimitValue(ELimitType::CoresLimit);
     mThreadsLimit = config_ptr->LimitValue(ELimitType::ThreadsLimit);
 
-    mpSchedulingStrategy = new ShuffledRoundRobinSchedulingStrategy();
+    bool quantum_valid = false;
+    uint64 quantum = config_ptr->GetOptionValue("SchedulingQuantum", quantum_valid);
+    if (not quantum_valid) {
+      quantum = 1;
+    }
+    else if (quantum > MAX_UINT32) {
+      LOG(fail) << "{Scheduler::Scheduler} SchedulingQuantum option value 0x" << hex << quantum << " exceeds the maximum of 0x" << MAX_UINT32 << endl;
+      FAIL("invalid-scheduling-quantum");
+    }
+
+    mpSchedulingStrategy = new ShuffledRoundRobinSchedulingStrategy(quantum);
     mpGroupModerator = new ThreadGroupModerator(mNumChips, mNumCores, mNumThreads);
     mpSemaManager = new SemaphoreManager();
     mpSyncBarrierManager = new SynchronizeBarrierManager();
@@ -99,6 +116,7 @@ namespace Force {
   void Scheduler::Run()
   {
     mpPyInterface->RunTest();
+    MemoryAccounting::Instance()->ReportTestEnd();
     OutputTest();
   }
 
@@ -572,4 +590,67 @@ namespace Force {
       FAIL("invalid-barriers-state");
     }
   }
+
+  bool Scheduler::PrepareSegmentFork(uint32 threadId)
+  {
+    auto gen_instance = LookUpGenerator(threadId);
+    string reason;
+    if (mGenerators.size() != 1) {
+      reason = "more than one generator thread";
+    }
+    else if (not gen_instance->SimulationEnabled()) {
+      reason = "simulation not enabled";
+    }
+    else if (gen_instance->InLoop() or gen_instance->InSpeculative() or gen_instance->InException()) {
+      reason = "in loop, speculative or exception mode";
+    }
+    else if (gen_instance->GetVmManager()->CurrentVmRegime()->PagingEnabled()) {
+      reason = "paging enabled";
+    }
+    else if (nullptr != mpPyInterface->GetApiCallRecorder()) {
+      reason = "recording API calls";
+    }
+
+    if (not reason.empty()) {
+      LOG(notice) << "{Scheduler::PrepareSegmentFork} independent segments generated in sequence: " << reason << "." << endl;
+      return false;
+    }
+
+    // forked processes inherit the buffers, write them out once.
+    cout.flush();
+    cerr.flush();
+    gen_instance->GetSimAPI()->FlushTraceFiles();
+    return true;
+  }
+
+  void Scheduler::BeginSegment(uint32 threadId, uint64 seed, const string& rSimTraceFile)
+  {
+    auto gen_instance = LookUpGenerator(threadId);
+    gen_instance->GetSimAPI()->RedirectTraceFiles(rSimTraceFile);
+    gen_instance->GetSimAPI()->SetRegisterReadUpdates(true); // the journal records the registers read before being written.
+    Random::Instance()->Seed(seed);
+    gen_instance->StartSegmentJournal();
+    LOG(notice) << "{Scheduler::BeginSegment} generating independent segment with seed 0x" << hex << seed << "." << endl;
+  }
+
+  void Scheduler::EndSegment(uint32 threadId, const string& rJournalFile)
+  {
+    auto gen_instance = LookUpGenerator(threadId);
+    gen_instance->FinishSegmentJournal(rJournalFile);
+    cout.flush();
+    cerr.flush();
+  }
+
+  void Scheduler::ImportSegment(uint32 threadId, const string& rJournalFile, vector<SegmentJournal::JournalRegisterValue>& rLiveInRegisters)
+  {
+    auto gen_instance = LookUpGenerator(threadId);
+    SegmentJournal::Import(*gen_instance, rJournalFile, rLiveInRegisters);
+  }
+
+  void Scheduler::ImportSegmentState(uint32 threadId, const string& rJournalFile)
+  {
+    auto gen_instance = LookUpGenerator(threadId);
+    SegmentJournal::ImportState(*gen_instance, rJournalFile);
+  }
+
 }
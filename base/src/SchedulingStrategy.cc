@@ -30,10 +30,13 @@ using namespace std;
 
 namespace Force {
 
-  ShuffledRoundRobinSchedulingStrategy::ShuffledRoundRobinSchedulingStrategy()
-    : SchedulingStrategy(), mState(ESchedulingState::Random), mCurrentThreadId(-1), mNextIndex(0), mLockingState(ESchedulingState::Random), mLockingLevel(0), mLockingThreadId(-1), mThreadIds(), mActiveThreadIds()
+  ShuffledRoundRobinSchedulingStrategy::ShuffledRoundRobinSchedulingStrategy(uint32 quantum)
+    : SchedulingStrategy(), mState(ESchedulingState::Random), mCurrentThreadId(-1), mNextIndex(0), mLockingState(ESchedulingState::Random), mLockingLevel(0), mLockingThreadId(-1), mQuantum(quantum), mQuantumCount(0), mThreadIds(), mActiveThreadIds()
   {
-
+    if (mQuantum == 0) {
+      LOG(fail) << "{ShuffledRoundRobinSchedulingStrategy::ShuffledRoundRobinSchedulingStrategy} scheduling quantum should be at least 1" << endl;
+      FAIL("invalid-scheduling-quantum");
+    }
   }
 
   void ShuffledRoundRobinSchedulingStrategy::AddThreadId(uint32 threadId)
@@ -68,6 +71,10 @@ namespace Force {
       }
       // else fall through
     case ESchedulingState::Random:
+      if (ContinueQuantum()) {
+        break;
+      }
+
       if (mNextIndex >= thread_list_size) {
         RefreshSchedule();
         return;
@@ -83,6 +90,21 @@ namespace Force {
     }
   }
 
+  bool ShuffledRoundRobinSchedulingStrategy::ContinueQuantum()
+  {
+    if (mQuantumCount + 1 >= mQuantum) {
+      return false;
+    }
+
+    // A thread that has reached a barrier or finished is no longer active and has to give up its quantum.
+    if (find(mActiveThreadIds.begin(), mActiveThreadIds.end(), mCurrentThreadId) == mActiveThreadIds.end()) {
+      return false;
+    }
+
+    ++ mQuantumCount;
+    return true;
+  }
+
   void ShuffledRoundRobinSchedulingStrategy::RefreshSchedule()
   {
     //LOG(notice) << "[ShuffledRoundRobinSchedulingStrategy::RefreshSchedule] shuffling happend." << endl;
@@ -0,0 +1,381 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "SegmentJournal.h"
+
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include "Generator.h"
+#include "InstructionResults.h"
+#include "Log.h"
+#include "Memory.h"
+#include "MemoryManager.h"
+#include "Record.h"
+#include "Register.h"
+#include "ResourcePeState.h"
+#include "SimAPI.h"
+
+using namespace std;
+
+/*!
+  \file SegmentJournal.cc
+  \brief Code recording what a generator adds to the test for an independent code segment and importing it into another generator.
+
+  The journal is a text file starting with a header line, followed by one record per line:
+    P <end PC>                                                        the PC the segment ended at
+    M <bank> <address> <data type> <access type> <data> <attributes>  a memory initialization
+    R <physical register> <value> <mask>                              a physical register initial value
+    I <bank> <address> <opcode> <assembly text>                       a committed instruction
+    L <physical register> <value> <mask>                              register bits read before being written
+    F <physical register> <value> <mask>                              the final value of written register bits
+    W <bank> <address> <data>                                         the final value of written memory bytes
+    X                                                                 the end of the journal
+  Numbers are in hexadecimal, the data and attribute bytes are written as hexadecimal strings of two characters per byte.
+*/
+
+namespace Force {
+
+  static const string sSegmentJournalHeader = "ForceSegmentJournal 1";
+  static const uint8 sMemoryInitializedAttribute = 0x1; //!< Memory byte attribute of an initialized byte, see MemoryBytes.
+
+  static void write_bytes(ofstream& rFile, const vector<uint8>& rBytes)
+  {
+    rFile << " ";
+    for (auto byte_value : rBytes) {
+      rFile << setw(2) << setfill('0') << uint32(byte_value);
+    }
+  }
+
+  static void read_bytes(ifstream& rFile, vector<uint8>& rBytes)
+  {
+    string hex_text;
+    rFile >> hex_text;
+    for (size_t i = 0; i + 1 < hex_text.size(); i += 2) {
+      rBytes.push_back(uint8(stoul(hex_text.substr(i, 2), nullptr, 16)));
+    }
+  }
+
+  void SegmentJournal::RecordMemoryInit(const MemoryInitRecord& rMemInitRecord)
+  {
+    JournalMemoryInit mem_init;
+    mem_init.mBank = rMemInitRecord.MemoryId();
+    mem_init.mAddress = rMemInitRecord.Address();
+    mem_init.mType = rMemInitRecord.InitType();
+    mem_init.mAccessType = rMemInitRecord.AccessType();
+    mem_init.mData.assign(rMemInitRecord.InitData(), rMemInitRecord.InitData() + rMemInitRecord.Size());
+    mem_init.mAttributes.assign(rMemInitRecord.InitAttributes(), rMemInitRecord.InitAttributes() + rMemInitRecord.Size());
+    mMemoryInits.push_back(mem_init);
+  }
+
+  void SegmentJournal::RecordInstruction(uint32 bank, uint64 pa, uint32 opcode, const string& rAsmText)
+  {
+    mInstructions.push_back(JournalInstruction{bank, pa, opcode, rAsmText});
+  }
+
+  void SegmentJournal::RecordRegisterInit(const string& rPhysRegName, uint64 value, uint64 mask)
+  {
+    mRegisterInits.push_back(JournalRegisterValue{rPhysRegName, value, mask});
+  }
+
+  void SegmentJournal::RecordRegisterUpdates(const vector<RegUpdate>& rRegUpdates)
+  {
+    // the updates are in the order of the accesses, so a read ahead of any write to the same bits gets the value from before the segment.
+    for (auto const &update : rRegUpdates) {
+      if (update.regname == "PC") {
+        continue;
+      }
+
+      uint64& accessed_mask = mAccessedRegisters[update.regname];
+      if (update.access_type == "read") {
+        uint64 live_in_mask = update.mask & ~accessed_mask;
+        if (live_in_mask) {
+          auto& live_in = mLiveInRegisters.emplace(update.regname, JournalRegisterValue{update.regname, 0, 0}).first->second;
+          live_in.mValue |= update.rval & live_in_mask;
+          live_in.mMask |= live_in_mask;
+        }
+      }
+      else if (update.access_type == "write") {
+        auto& final_reg = mFinalRegisters.emplace(update.regname, JournalRegisterValue{update.regname, 0, 0}).first->second;
+        final_reg.mValue = (final_reg.mValue & ~update.mask) | (update.rval & update.mask);
+        final_reg.mMask |= update.mask;
+      }
+      accessed_mask |= update.mask;
+    }
+  }
+
+  void SegmentJournal::RecordMemoryUpdates(const vector<MemUpdate>& rMemUpdates)
+  {
+    for (auto const &update : rMemUpdates) {
+      if (update.access_type != "write") {
+        continue;
+      }
+
+      auto& bank_memory = mFinalMemory[update.mem_bank];
+      for (uint32 i = 0; i < update.size; ++ i) {
+        bank_memory[update.physical_address + i] = update.bytes[i];
+      }
+    }
+  }
+
+  void SegmentJournal::Write(const string& rFilePath, uint64 endPC) const
+  {
+    ofstream journal_file(rFilePath, ofstream::out | ofstream::trunc);
+    if (not journal_file.is_open()) {
+      LOG(fail) << "{SegmentJournal::Write} unable to open segment journal file \"" << rFilePath << "\"." << endl;
+      FAIL("segment-journal-file-open-failure");
+    }
+
+    journal_file << sSegmentJournalHeader << "\n" << hex;
+    journal_file << "P " << endPC << "\n";
+    for (const auto& mem_init : mMemoryInits) {
+      journal_file << "M " << mem_init.mBank << " " << mem_init.mAddress << " " << EMemDataType_to_string(mem_init.mType) << " " << EMemAccessType_to_string(mem_init.mAccessType);
+      write_bytes(journal_file, mem_init.mData);
+      write_bytes(journal_file, mem_init.mAttributes);
+      journal_file << "\n";
+    }
+    for (const auto& reg_init : mRegisterInits) {
+      journal_file << "R " << reg_init.mName << " " << reg_init.mValue << " " << reg_init.mMask << "\n";
+    }
+    for (const auto& instr : mInstructions) {
+      journal_file << "I " << instr.mBank << " " << instr.mAddress << " " << instr.mOpcode << " " << instr.mAsmText << "\n";
+    }
+    for (const auto& live_in_item : mLiveInRegisters) {
+      const JournalRegisterValue& live_in = live_in_item.second;
+      journal_file << "L " << live_in.mName << " " << live_in.mValue << " " << live_in.mMask << "\n";
+    }
+    for (const auto& final_reg_item : mFinalRegisters) {
+      const JournalRegisterValue& final_reg = final_reg_item.second;
+      journal_file << "F " << final_reg.mName << " " << final_reg.mValue << " " << final_reg.mMask << "\n";
+    }
+
+    // write the final memory values as runs of consecutive bytes.
+    for (const auto& bank_item : mFinalMemory) {
+      auto byte_iter = bank_item.second.cbegin();
+      while (byte_iter != bank_item.second.cend()) {
+        uint64 run_address = byte_iter->first;
+        vector<uint8> run_data;
+        for (; (byte_iter != bank_item.second.cend()) and (byte_iter->first == run_address + run_data.size()); ++ byte_iter) {
+          run_data.push_back(byte_iter->second);
+        }
+        journal_file << "W " << bank_item.first << " " << run_address;
+        write_bytes(journal_file, run_data);
+        journal_file << "\n";
+      }
+    }
+    journal_file << "X\n";
+    journal_file.close();
+
+    LOG(notice) << "{SegmentJournal::Write} wrote " << dec << mMemoryInits.size() << " memory initializations, " << mRegisterInits.size() << " register initializations, "
+                << mInstructions.size() << " instructions, " << mLiveInRegisters.size() << " live-in registers and " << mFinalRegisters.size() << " written registers to \""
+                << rFilePath << "\", end PC 0x" << hex << endPC << "." << endl;
+  }
+
+  void SegmentJournal::Read(const string& rFilePath)
+  {
+    ifstream journal_file(rFilePath);
+    if (not journal_file.is_open()) {
+      LOG(fail) << "{SegmentJournal::Read} unable to open segment journal file \"" << rFilePath << "\"." << endl;
+      FAIL("segment-journal-file-open-failure");
+    }
+
+    string header;
+    getline(journal_file, header);
+    if (header != sSegmentJournalHeader) {
+      LOG(fail) << "{SegmentJournal::Read} \"" << rFilePath << "\" is not a segment journal, header \"" << header << "\"." << endl;
+      FAIL("segment-journal-file-format-error");
+    }
+
+    journal_file >> hex;
+    char tag = 0;
+    while (journal_file >> tag) {
+      switch (tag) {
+      case 'P':
+        journal_file >> mEndPC;
+        break;
+      case 'M':
+        {
+          JournalMemoryInit mem_init;
+          string type_text, access_text;
+          journal_file >> mem_init.mBank >> mem_init.mAddress >> type_text >> access_text;
+          mem_init.mType = string_to_EMemDataType(type_text);
+          mem_init.mAccessType = string_to_EMemAccessType(access_text);
+          read_bytes(journal_file, mem_init.mData);
+          read_bytes(journal_file, mem_init.mAttributes);
+          mMemoryInits.push_back(mem_init);
+        }
+        break;
+      case 'R':
+      case 'L':
+      case 'F':
+        {
+          JournalRegisterValue reg_value;
+          journal_file >> reg_value.mName >> reg_value.mValue >> reg_value.mMask;
+          if (tag == 'R') {
+            mRegisterInits.push_back(reg_value);
+          }
+          else {
+            auto& reg_values = (tag == 'L') ? mLiveInRegisters : mFinalRegisters;
+            reg_values[reg_value.mName] = reg_value;
+          }
+        }
+        break;
+      case 'I':
+        {
+          JournalInstruction instr;
+          journal_file >> instr.mBank >> instr.mAddress >> instr.mOpcode;
+          journal_file.get(); // the space separating the assembly text.
+          getline(journal_file, instr.mAsmText);
+          mInstructions.push_back(instr);
+        }
+        break;
+      case 'W':
+        {
+          uint32 bank = 0;
+          uint64 address = 0;
+          vector<uint8> data;
+          journal_file >> bank >> address;
+          read_bytes(journal_file, data);
+          auto& bank_memory = mFinalMemory[bank];
+          for (size_t i = 0; i < data.size(); ++ i) {
+            bank_memory[address + i] = data[i];
+          }
+        }
+        break;
+      case 'X':
+        return;
+      default:
+        LOG(fail) << "{SegmentJournal::Read} unexpected \'" << tag << "\' record in \"" << rFilePath << "\"." << endl;
+        FAIL("segment-journal-file-format-error");
+      }
+    }
+
+    LOG(fail) << "{SegmentJournal::Read} unexpected end of segment journal file \"" << rFilePath << "\"." << endl;
+    FAIL("segment-journal-file-format-error");
+  }
+
+  void SegmentJournal::Import(Generator& rGenerator, const string& rFilePath, vector<JournalRegisterValue>& rLiveInRegisters)
+  {
+    SegmentJournal journal;
+    journal.Read(rFilePath);
+
+    for (const auto& mem_init : journal.mMemoryInits) {
+      ImportMemoryInit(rGenerator, mem_init);
+    }
+    for (const auto& reg_init : journal.mRegisterInits) {
+      ImportRegisterInit(rGenerator, reg_init);
+    }
+    for (const auto& instr : journal.mInstructions) {
+      rGenerator.GetInstructionResults()->ImportInstruction(instr.mBank, instr.mAddress, instr.mOpcode, instr.mAsmText);
+    }
+    for (const auto& live_in_item : journal.mLiveInRegisters) {
+      rLiveInRegisters.push_back(live_in_item.second);
+    }
+
+    LOG(notice) << "{SegmentJournal::Import} imported " << dec << journal.mInstructions.size() << " instructions from \"" << rFilePath << "\", "
+                << journal.mLiveInRegisters.size() << " live-in registers." << endl;
+  }
+
+  void SegmentJournal::ImportState(Generator& rGenerator, const string& rFilePath)
+  {
+    SegmentJournal journal;
+    journal.Read(rFilePath);
+
+    SimAPI* sim_ptr = rGenerator.GetSimAPI();
+    bool sys_reg_changed = false;
+    for (const auto& final_reg_item : journal.mFinalRegisters) {
+      sys_reg_changed |= ImportFinalRegister(rGenerator, final_reg_item.second);
+    }
+
+    uint64 byte_count = 0;
+    for (const auto& bank_item : journal.mFinalMemory) {
+      for (const auto& byte_item : bank_item.second) {
+        ByteMemoryPeState(bank_item.first, byte_item.first, 0, byte_item.second).DoStateRecovery(&rGenerator, sim_ptr);
+      }
+      byte_count += bank_item.second.size();
+    }
+
+    PCPeState(journal.mEndPC).DoStateRecovery(&rGenerator, sim_ptr);
+    if (sys_reg_changed) {
+      rGenerator.UpdateVm();
+    }
+
+    LOG(notice) << "{SegmentJournal::ImportState} set " << dec << journal.mFinalRegisters.size() << " registers and " << byte_count << " memory bytes from \"" << rFilePath
+                << "\", end PC 0x" << hex << journal.mEndPC << "." << endl;
+  }
+
+  void SegmentJournal::ImportMemoryInit(Generator& rGenerator, const JournalMemoryInit& rMemInit)
+  {
+    const Memory* memory = rGenerator.GetMemoryManager()->GetMemoryBank(rMemInit.mBank)->MemoryInstance();
+    uint32 size = rMemInit.mData.size();
+
+    // initialize the runs of bytes not yet initialized, the other bytes have to hold the same values.  Bytes with the initialized attribute
+    // were initialized before the record, at the fork or by an earlier record, and are left alone.
+    uint32 run_start = 0;
+    for (uint32 i = 0; i <= size; ++ i) {
+      bool skipped = (i < size) and (rMemInit.mAttributes[i] & sMemoryInitializedAttribute);
+      bool initialized = (i < size) and (not skipped) and memory->IsInitialized(rMemInit.mAddress + i, 1);
+      if ((i < size) and (not skipped) and (not initialized)) {
+        continue;
+      }
+
+      if (i > run_start) {
+        uint32 run_size = i - run_start;
+        MemoryInitRecord* mem_init_data = rGenerator.GetRecordArchive()->GetMemoryInitRecord(rGenerator.ThreadId(), run_size, 1, rMemInit.mType, rMemInit.mAccessType);
+        uint8* data = new uint8[run_size];
+        uint8* attrs = new uint8[run_size];
+        copy(rMemInit.mData.begin() + run_start, rMemInit.mData.begin() + i, data);
+        copy(rMemInit.mAttributes.begin() + run_start, rMemInit.mAttributes.begin() + i, attrs);
+        mem_init_data->SetDataWithAttributes(rMemInit.mAddress + run_start, rMemInit.mBank, data, attrs, run_size);
+        rGenerator.InitializeMemory(mem_init_data);
+      }
+
+      if (initialized and (memory->ReadInitialValue(rMemInit.mAddress + i, 1) != rMemInit.mData[i])) {
+        LOG(fail) << "{SegmentJournal::ImportMemoryInit} memory [" << dec << rMemInit.mBank << "]0x" << hex << (rMemInit.mAddress + i) << " already initialized to 0x"
+                  << memory->ReadInitialValue(rMemInit.mAddress + i, 1) << ", segment initializes it to 0x" << uint32(rMemInit.mData[i]) << "." << endl;
+        FAIL("segment-journal-memory-conflict");
+      }
+      run_start = i + 1;
+    }
+  }
+
+  void SegmentJournal::ImportRegisterInit(Generator& rGenerator, const JournalRegisterValue& rRegInit)
+  {
+    PhysicalRegister* phys_reg = rGenerator.GetRegisterFile()->PhysicalRegisterLookup(rRegInit.mName);
+    uint64 new_mask = rRegInit.mMask & ~phys_reg->InitMask();
+    phys_reg->Initialize(rRegInit.mValue, rRegInit.mMask); // fails on bits already initialized to a different value.
+
+    if (new_mask) {
+      rGenerator.GetSimAPI()->WriteRegister(rGenerator.ThreadId(), rRegInit.mName.c_str(), rRegInit.mValue & new_mask, new_mask);
+    }
+  }
+
+  bool SegmentJournal::ImportFinalRegister(Generator& rGenerator, const JournalRegisterValue& rFinalReg)
+  {
+    auto reg_file = rGenerator.GetRegisterFile();
+    PhysicalRegister* phys_reg = reg_file->PhysicalRegisterLookup(rFinalReg.mName);
+    uint64 mask = rFinalReg.mMask & phys_reg->Mask();
+
+    // the segment wrote bits not initialized before it, take them as initialized to zero as the segment did.
+    uint64 uninit_mask = mask & ~phys_reg->InitMask();
+    if (uninit_mask) {
+      reg_file->SetPhysicalRegisterValueAndInit(phys_reg, rFinalReg.mValue, uninit_mask, 0, false);
+    }
+    phys_reg->SetAttribute(ERegAttrType::UpdatedFromISS);
+    return RegisterPeState(phys_reg, mask, rFinalReg.mValue).DoStateRecovery(&rGenerator, rGenerator.GetSimAPI());
+  }
+
+}
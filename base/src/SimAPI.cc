@@ -63,6 +63,26 @@ namespace Force {
     }
   }
 
+  void SimAPI::FlushTraceFiles()
+  {
+    if (mOfsApiTrace.is_open()) {
+      mOfsApiTrace.flush();
+    }
+    if (mOfsSimTrace.is_open()) {
+      mOfsSimTrace.flush();
+    }
+  }
+
+  void SimAPI::RedirectTraceFiles(const std::string& rSimTraceFile)
+  {
+    // the buffers were flushed before the fork, closing writes nothing to the parent's files.
+    mOfsApiTrace.close();
+    if (mOfsSimTrace.is_open()) {
+      mOfsSimTrace.close();
+      OpenOfs(rSimTraceFile, mOfsSimTrace);
+    }
+  }
+
   void SimAPI::ApiTraceCheckRcode(const std::string& function)
   {
       mOfsApiTrace << "  if (rcode) { printf(\"!!! non-zero return code from call to '"
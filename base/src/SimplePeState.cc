@@ -16,6 +16,7 @@
 #include "SimplePeState.h"
 
 #include "Log.h"
+#include "MemoryAccounting.h"
 #include "Register.h"
 
 using namespace std;
@@ -56,4 +57,9 @@ namespace Force {
     return state_changed;
   }
 
+  void SimplePeState::AccountMemory(MemoryUsage& rUsage) const
+  {
+    rUsage.Add(sizeof(SimplePeState) + vector_memory_bytes(mRegisterStates), 1);
+  }
+
 }
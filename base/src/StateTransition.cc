@@ -19,6 +19,7 @@
 
 #include "pybind11/stl.h"
 
+#include "ApiCallRecord.h"
 #include "Constraint.h"
 #include "Generator.h"
 #include "Log.h"
@@ -397,29 +398,33 @@ namespace Force {
 
   void StateTransitionManager::ProcessStateElement(const StateTransitionAssignmentSet& rStateTransAssignSet, const StateElement& rStateElem) const
   {
-    bool element_processed = false;
-    auto handler_itr = rStateTransAssignSet.find(rStateElem.GetStateElementType());
-    if (handler_itr != rStateTransAssignSet.end()) {
-      py::object state_trans_handler = handler_itr->second;
+    bool element_processed = call_back_front_end("ProcessStateElement", [this, &rStateTransAssignSet, &rStateElem]() -> uint64 {
+        bool processed = false;
+        auto handler_itr = rStateTransAssignSet.find(rStateElem.GetStateElementType());
+        if (handler_itr != rStateTransAssignSet.end()) {
+          py::object state_trans_handler = handler_itr->second;
 
-      // Need to pass rStateElem as a pointer; otherwise, pybind will attempt to copy the object.
-      py::object success = state_trans_handler.attr("processStateElement")(&rStateElem);
+          // Need to pass rStateElem as a pointer; otherwise, pybind will attempt to copy the object.
+          py::object success = state_trans_handler.attr("processStateElement")(&rStateElem);
 
-      element_processed = success.cast<bool>();
-    }
+          processed = success.cast<bool>();
+        }
 
-    if (!element_processed) {
-      auto default_handler_itr = mDefaultStateTransAssignments.find(rStateElem.GetStateElementType());
+        if (!processed) {
+          auto default_handler_itr = mDefaultStateTransAssignments.find(rStateElem.GetStateElementType());
 
-      if (default_handler_itr != mDefaultStateTransAssignments.end()) {
-        py::object default_state_trans_handler = default_handler_itr->second;
+          if (default_handler_itr != mDefaultStateTransAssignments.end()) {
+            py::object default_state_trans_handler = default_handler_itr->second;
 
-        // Need to pass rStateElem as a pointer; otherwise, pybind will attempt to copy the object.
-        py::object success = default_state_trans_handler.attr("processStateElement")(&rStateElem);
+            // Need to pass rStateElem as a pointer; otherwise, pybind will attempt to copy the object.
+            py::object success = default_state_trans_handler.attr("processStateElement")(&rStateElem);
 
-        element_processed = success.cast<bool>();
-      }
-    }
+            processed = success.cast<bool>();
+          }
+        }
+
+        return processed;
+      });
 
     if (!element_processed) {
       LOG(fail) << "{StateTransitionManager::ProcessStateElement} unable to process StateElement " << rStateElem.ToString() << endl;
@@ -429,23 +434,23 @@ namespace Force {
 
   void StateTransitionManager::ProcessStateElementsOfType(const StateTransitionAssignmentSet& rStateTransAssignSet, const EStateElementType stateElemType, const vector<StateElement*>& rStateElems) const
   {
-    bool elements_processed = false;
-    auto handler_itr = rStateTransAssignSet.find(stateElemType);
-    if (handler_itr != rStateTransAssignSet.end()) {
-      py::object state_trans_handler = handler_itr->second;
-      state_trans_handler.attr("processStateElements")(rStateElems);
-      elements_processed = true;
-    }
+    bool elements_processed = call_back_front_end("ProcessStateElementsOfType", [this, &rStateTransAssignSet, stateElemType, &rStateElems]() -> uint64 {
+        auto handler_itr = rStateTransAssignSet.find(stateElemType);
+        if (handler_itr != rStateTransAssignSet.end()) {
+          py::object state_trans_handler = handler_itr->second;
+          state_trans_handler.attr("processStateElements")(rStateElems);
+          return true;
+        }
 
-    if (!elements_processed) {
-      auto default_handler_itr = mDefaultStateTransAssignments.find(stateElemType);
+        auto default_handler_itr = mDefaultStateTransAssignments.find(stateElemType);
+        if (default_handler_itr != mDefaultStateTransAssignments.end()) {
+          py::object default_state_trans_handler = default_handler_itr->second;
+          default_state_trans_handler.attr("processStateElements")(rStateElems);
+          return true;
+        }
 
-      if (default_handler_itr != mDefaultStateTransAssignments.end()) {
-        py::object default_state_trans_handler = default_handler_itr->second;
-        default_state_trans_handler.attr("processStateElements")(rStateElems);
-        elements_processed = true;
-      }
-    }
+        return false;
+      });
 
     if (!elements_processed) {
       LOG(fail) << "{StateTransitionManager::ProcessStateElementsOfType} unable to process " << EStateElementType_to_string(stateElemType) << " StateElements" << endl;
@@ -220,9 +220,17 @@ namespace Force {
     {
       const ThreadInstructionResults* inst_results = generator->GetInstructionResults();
       const std::map<uint64, Instruction* >& instructions = inst_results->GetInstructions(memBank);
-
-      for (auto inst : instructions)
-	  asmFile << fmtx0(inst.first, 16) << ":" << fmtx0(inst.second->Opcode(), 8) << " " << inst.second->AssemblyText() << endl;
+      const std::map<uint64, std::pair<uint32, std::string> >& imported_instructions = inst_results->GetImportedInstructions(memBank);
+
+      // merge the instructions imported from independently generated segments in address order.
+      auto imported_iter = imported_instructions.cbegin();
+      for (auto inst : instructions) {
+        for (; (imported_iter != imported_instructions.cend()) and (imported_iter->first < inst.first); ++ imported_iter)
+          asmFile << fmtx0(imported_iter->first, 16) << ":" << fmtx0(imported_iter->second.first, 8) << " " << imported_iter->second.second << endl;
+	asmFile << fmtx0(inst.first, 16) << ":" << fmtx0(inst.second->Opcode(), 8) << " " << inst.second->AssemblyText() << endl;
+      }
+      for (; imported_iter != imported_instructions.cend(); ++ imported_iter)
+        asmFile << fmtx0(imported_iter->first, 16) << ":" << fmtx0(imported_iter->second.first, 8) << " " << imported_iter->second.second << endl;
     }
 #endif
     /*!
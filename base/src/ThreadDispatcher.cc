@@ -61,8 +61,10 @@ namespace Force {
 
   ThreadDispatcher* ThreadDispatcher::mspDispatcher = nullptr;
 
+  thread_local uint32 MultiThreadDispatcher::msThreadId = MAX_UINT32;
+
   MultiThreadDispatcher::MultiThreadDispatcher(Scheduler* pScheduler)
-    : ThreadDispatcher(), mpScheduler(pScheduler), mDispatchMutex(), mCondVar(), mThreadIds()
+    : ThreadDispatcher(), mpScheduler(pScheduler), mDispatchMutex(), mCondVars()
   {
   }
 
@@ -90,7 +92,7 @@ namespace Force {
 
     uint32 thread_id = GetThreadId();
 
-    mCondVar.wait(lock,
+    GetCondVar(thread_id).wait(lock,
       [thread_id, this]() { return (thread_id == this->mpScheduler->CurrentThreadId()); });
 
     // Hold the mutex lock until Finish() is called
@@ -130,26 +132,20 @@ namespace Force {
 
   uint32 MultiThreadDispatcher::GetThreadId()
   {
-    unique_lock<CountingMutex> lock(mDispatchMutex);
-
-    uint32 threadId = MAX_UINT32;
-    auto itr = mThreadIds.find(this_thread::get_id());
-    if (itr != mThreadIds.end()) {
-      threadId = itr->second;
-    }
-    else {
+    if (msThreadId == MAX_UINT32) {
       LOG(fail) << "{MultiThreadDispatcher::GetThreadId} the calling execution thread could not be identified. It has either not been registered with a call to RegisterExecutionThread() or has terminated with a call to ReportThreadDone()." << endl;
       FAIL("thread-dispatch-failure");
     }
 
-    return threadId;
+    return msThreadId;
   }
 
   void MultiThreadDispatcher::RegisterExecutionThread(cuint32 threadId)
   {
     unique_lock<CountingMutex> lock(mDispatchMutex);
 
-    mThreadIds[this_thread::get_id()] = threadId;
+    msThreadId = threadId;
+    GetCondVar(threadId);
   }
 
   void MultiThreadDispatcher::ReportThreadDone()
@@ -164,11 +160,11 @@ namespace Force {
     }
 
     mpScheduler->RemoveThreadId(thread_id);
-    mThreadIds.erase(this_thread::get_id());
+    msThreadId = MAX_UINT32;
 
     // We avoid calling Finish() directly here because Finish() attempts to get the thread ID for
-    // debug logging purposes. This thread's thread ID has just been removed from the map, so
-    // attempting to retrieve it will fail. UnlockMutex() does all of the work of Finish() without
+    // debug logging purposes. This thread's thread ID has just been cleared, so attempting to
+    // retrieve it will fail. UnlockMutex() does all of the work of Finish() without
     // the logging.
     UnlockMutex();
   }
@@ -178,8 +174,17 @@ namespace Force {
     if (mDispatchMutex.get_lock_count() == 1) {
       mpScheduler->NextThread();
 
+      // Only the thread whose turn it is can progress, so only wake that thread. The condition
+      // variable is looked up while the mutex is still held and notified after releasing it.
+      condition_variable_any* next_cond_var = nullptr;
+      if (mpScheduler->ActiveThreadCount() != 0) {
+        next_cond_var = &GetCondVar(mpScheduler->CurrentThreadId());
+      }
+
       mDispatchMutex.unlock();
-      mCondVar.notify_all();
+      if (next_cond_var != nullptr) {
+        next_cond_var->notify_one();
+      }
     } else {
       // This will decrement the lock count, but not release the lock, as it is a nested call
       mDispatchMutex.unlock();
@@ -191,6 +196,11 @@ namespace Force {
     mDispatchMutex.unlock();
   }
 
+  condition_variable_any& MultiThreadDispatcher::GetCondVar(cuint32 threadId)
+  {
+    return mCondVars[threadId];
+  }
+
   SingleThreadDispatcher::SingleThreadDispatcher()
     : mThreadId(MAX_UINT32)
   {
@@ -32,6 +32,7 @@
 #include "FrontEndCall.h"
 #include "InstructionResults.h"
 #include "Log.h"
+#include "MemoryAccounting.h"
 #include "MemoryManager.h"
 #include "ObjectRegistry.h"
 #include "PcSpacing.h"
@@ -81,7 +82,7 @@ namespace Force {
     }
   };
 
-  enum OptionIndex { UNKNOWN, CFG, HELP, LOGLEVEL, DUMP, NOASM, IMG, OPTIONS, SEED, TEST, NOISS, MAXINSTR, NUMCHIPS, NUMCORES, NUMTHREADS, OUTPUTWITHSEED, FAILOVERRIDE, GLOBALMODIFIER, ISSTRACEFILE };
+  enum OptionIndex { UNKNOWN, CFG, HELP, LOGLEVEL, DUMP, NOASM, IMG, OPTIONS, SEED, TEST, NOISS, MAXINSTR, NUMCHIPS, NUMCORES, NUMTHREADS, OUTPUTWITHSEED, FAILOVERRIDE, GLOBALMODIFIER, ISSTRACEFILE, RECORDAPI, REPLAYAPI };
   const option::Descriptor usage[] =
     {
       {UNKNOWN,      0, "",   "",         Arg::None,     "USAGE: force [options]\n\n" "Options:" },
@@ -102,6 +103,8 @@ namespace Force {
       {OUTPUTWITHSEED, 0, "w",  "outputwithseed",  Arg::None, "  --outputwithseed, -w \tIndicate to generate outputs with seed number."},
       {FAILOVERRIDE, 0, "f",  "failOverride",  Arg::None, "  --failOverride, -f \tFORCE will fail when operand override is invalid."},
       {GLOBALMODIFIER, 0, "g",  "global-modifier",  Arg::NonEmpty, "  --global-modifier, -g \tGlobal modification file path."},
+      {RECORDAPI,    0, "",  "record-api",  Arg::NonEmpty, "  --record-api, \tRecord the API calls made by the test template to the given file."},
+      {REPLAYAPI,    0, "",  "replay-api",  Arg::NonEmpty, "  --replay-api, \tReplay the API calls recorded in the given file instead of running the test template; use the seed and options of the recording."},
 
 //      {ISSTRACEFILE, 0, "",  "apitrace",  Arg::NonEmpty, "  --apitrace, \tPath to simulator API trace file."},
       {UNKNOWN,      0, "",  "",          Arg::None,     "\nExamples:\n"
@@ -232,6 +235,20 @@ namespace Force {
       Config::Instance()->SetIssApiTraceFile(apitrace_file);
     }
 
+    if (options[RECORDAPI]) {
+      option::Option* record_opt = options[RECORDAPI].last();
+      string record_file = record_opt->arg;
+      LOG(notice) << "Recording template API calls to \"" << record_file << "\"..." << endl;
+      Config::Instance()->SetApiRecordFile(record_file);
+    }
+
+    if (options[REPLAYAPI]) {
+      option::Option* replay_opt = options[REPLAYAPI].last();
+      string replay_file = replay_opt->arg;
+      LOG(notice) << "Replaying template API calls from \"" << replay_file << "\"..." << endl;
+      Config::Instance()->SetApiReplayFile(replay_file);
+    }
+
     if (options[OUTPUTWITHSEED]) {
       LOG(notice) << "Generate outputs with seed number." << endl;
       Config::Instance()->SetOutputWithSeed(true, test_seed);
@@ -303,6 +320,7 @@ namespace Force {
 
     PcSpacing::Initialize();
     InstructionResults::Initialize();
+    MemoryAccounting::Initialize();
     RestoreLoopManagerRepository::Initialize();
 
     PyEnvironment::initialize_python();
@@ -322,6 +340,7 @@ namespace Force {
     PyEnvironment::finalize_python();
 
     RestoreLoopManagerRepository::Destroy();
+    MemoryAccounting::Destroy();
     InstructionResults::Destroy();
     PcSpacing::Destroy();
     ThreadPartitionerFactory::Destroy();
@@ -64,18 +64,18 @@ namespace Force {
 
 
   VmAddressSpace::VmAddressSpace(const VmFactory* pFactory, VmasControlBlock* pVmasCtlrBlock)
-    : VmMapper(pFactory), Object(), mpControlBlock(pVmasCtlrBlock), mpLookUpPage(nullptr), mpDefaultPageRequest(nullptr),  mpVirtualUsable(nullptr), mPages(), mPhysicalRegions(), mNoTablePages(), mVmConstraints(), mPageTableConstraints(), mFlatMapped(false)
+    : VmMapper(pFactory), Object(), mpControlBlock(pVmasCtlrBlock), mpLookUpPage(nullptr), mpDefaultPageRequest(nullptr),  mpVirtualUsable(nullptr), mPages(), mPhysicalRegions(), mNoTablePages(), mSharedPages(), mVmConstraints(), mPageTableConstraints(), mFlatMapped(false)
   {
 
   }
 
   VmAddressSpace::VmAddressSpace()
-    : VmMapper(), Object(), mpControlBlock(nullptr), mpLookUpPage(nullptr), mpDefaultPageRequest(nullptr),  mpVirtualUsable(nullptr), mPages(), mPhysicalRegions(), mNoTablePages(), mVmConstraints(), mPageTableConstraints(), mFlatMapped(false)
+    : VmMapper(), Object(), mpControlBlock(nullptr), mpLookUpPage(nullptr), mpDefaultPageRequest(nullptr),  mpVirtualUsable(nullptr), mPages(), mPhysicalRegions(), mNoTablePages(), mSharedPages(), mVmConstraints(), mPageTableConstraints(), mFlatMapped(false)
   {
   }
 
   VmAddressSpace::VmAddressSpace(const VmAddressSpace& rOther)
-    : VmMapper(rOther), Object(rOther), mpControlBlock(nullptr), mpLookUpPage(nullptr), mpDefaultPageRequest(nullptr),  mpVirtualUsable(nullptr), mPages(), mPhysicalRegions(), mNoTablePages(), mVmConstraints(), mPageTableConstraints(), mFlatMapped(false)
+    : VmMapper(rOther), Object(rOther), mpControlBlock(nullptr), mpLookUpPage(nullptr), mpDefaultPageRequest(nullptr),  mpVirtualUsable(nullptr), mPages(), mPhysicalRegions(), mNoTablePages(), mSharedPages(), mVmConstraints(), mPageTableConstraints(), mFlatMapped(false)
   {
     if (nullptr != rOther.mpControlBlock) {
       mpControlBlock = dynamic_cast<VmasControlBlock* > (rOther.mpControlBlock->Clone());
@@ -100,6 +100,10 @@ namespace Force {
       delete no_table_page;
     }
 
+    for (auto shared_page : mSharedPages) {
+      delete shared_page;
+    }
+
     for (auto vm_constr : mVmConstraints) {
       delete vm_constr;
     }
@@ -330,6 +334,17 @@ namespace Force {
     return mpVirtualUsable->Usable();
   }
 
+  bool VmAddressSpace::VirtualUsableContainsRange(uint64 lower, uint64 upper, bool isInstr) const
+  {
+    if (!mpVirtualUsable->IsInitialized())
+    {
+      LOG(fail) << "{VmAddressSpace::VirtualUsableContainsRange} virtual memory constraint uninitialized" << endl;
+      FAIL("vir-mem-constr-uninit");
+    }
+
+    return mpVirtualUsable->UsableContainsRange(lower, upper);
+  }
+
   ConstraintSet* VmAddressSpace::VirtualUsableConstraintSetClone(bool isInstr)
   {
     // << " virtual usable clone called " << mpControlBlock->Type() << " EL: " <<  EPrivilegeLevelType_to_string(mpControlBlock->ExceptionLevel()) << " : flat map? " << mFlatMapped << endl;
@@ -369,6 +384,14 @@ namespace Force {
     auto mem_manager = mpGenerator->GetMemoryManager();
     auto region_vec = mpControlBlock->FilterEssentialPhysicalRegions(mem_manager->GetPhysicalRegions());
 
+    if (mpControlBlock->GetChoicesAdapter()->PlainPagingChoiceEnabled("Page Table Sharing", 1)) {
+      const VmAddressSpace* sharing_vmas = mem_manager->GetPageTableManager(DefaultMemoryBank())->PageTableSharingAddressSpace(this);
+      if (nullptr != sharing_vmas) {
+        SharePageTables(*sharing_vmas, region_vec);
+      }
+    }
+
+    // regions, or parts of them, not covered by the shared page tables are mapped here.
     for (auto phys_region : region_vec)
     {
       bool region_compatible = MapPhysicalRegion(phys_region);
@@ -379,6 +402,29 @@ namespace Force {
     }
   }
 
+  void VmAddressSpace::SharePageTables(const VmAddressSpace& rSharingVmas, const vector<const PhysicalRegion* >& rPhysRegions)
+  {
+    // essential physical regions are flat mapped, their VA ranges are their PA ranges.
+    ConstraintSet common_ranges;
+    for (auto phys_region : rPhysRegions) {
+      common_ranges.AddRange(phys_region->Lower(), phys_region->Upper());
+    }
+    if (common_ranges.IsEmpty()) {
+      return;
+    }
+
+    // tables created to share down stream tables are generated like the ones mapping the regions.
+    bool region_compatible = false;
+    unique_ptr<GenPageRequest> page_req_storage(mpControlBlock->PhysicalRegionPageRequest(rPhysRegions.front(), region_compatible));
+    mpGenerator->GetPageRequestRegulator()->RegulatePageRequest(this, page_req_storage.get());
+
+    RootPageTable* root_table = mpControlBlock->GetRootPageTable();
+    root_table->ShareEntries(*(rSharingVmas.GetControlBlock()->GetRootPageTable()), common_ranges, this, *page_req_storage);
+
+    LOG(notice) << "{VmAddressSpace::SharePageTables} sharing page tables of " << dec << rPhysRegions.size() << " common physical regions with address space: " << rSharingVmas.ControlBlockInfo() << ", "
+                << mSharedPages.size() << " pages shared." << endl;
+  }
+
   void VmAddressSpace::Activate()
   {
     if (!IsInitialized())
@@ -744,6 +790,13 @@ namespace Force {
 
     psize_info.UpdateMaxPhysical(mpControlBlock->MaxPhysicalAddress());
 
+    if (not isSysPage) {
+      ret_page = SetupSuperpageMapping(VA, size, pPageReq, choices_tree);
+      if (nullptr != ret_page) {
+        return ret_page;
+      }
+    }
+
     try
     {
       while (true)
@@ -773,6 +826,47 @@ namespace Force {
     return ret_page;
   }
 
+  const Page* VmAddressSpace::SetupSuperpageMapping(uint64 VA, uint64 size, GenPageRequest* pPageReq, const ChoiceTree* pPageSizeTree)
+  {
+    if (not mpControlBlock->GetChoicesAdapter()->PlainPagingChoiceEnabled("Superpage Mapping", 1)) {
+      return nullptr;
+    }
+
+    // keep the superpage sizes that start at the VA and fit in the range, with their page size choice weights.
+    unique_ptr<ChoiceTree> superpage_tree(dynamic_cast<ChoiceTree*>(pPageSizeTree->Clone()));
+    uint64 smallest_page_size = MAX_UINT64;
+    for (auto size_choice : superpage_tree->GetChoices()) {
+      PageSizeInfo psize_info;
+      PageSizeInfo::StringToPageSizeInfo(size_choice->Name(), psize_info);
+      smallest_page_size = min(smallest_page_size, psize_info.Size());
+    }
+
+    for (auto size_choice : superpage_tree->GetChoicesMutable()) {
+      PageSizeInfo psize_info;
+      PageSizeInfo::StringToPageSizeInfo(size_choice->Name(), psize_info);
+      if ((psize_info.Size() == smallest_page_size) or ((VA & psize_info.mPageMask) != 0) or (psize_info.Size() > size)) {
+        size_choice->SetWeight(0);
+      }
+    }
+
+    while (superpage_tree->HasChoice()) {
+      auto chosen_ptr = superpage_tree->ChooseMutable();
+      PageSizeInfo psize_info;
+      PageSizeInfo::StringToPageSizeInfo(chosen_ptr->Name(), psize_info);
+      psize_info.UpdateMaxPhysical(mpControlBlock->MaxPhysicalAddress());
+
+      string err_msg;
+      const Page* ret_page = CreatePage(VA, size, pPageReq, psize_info, err_msg);
+      if (nullptr != ret_page) {
+        return ret_page;
+      }
+      LOG(info) << "{VmAddressSpace::SetupSuperpageMapping} failed to create superpage for VA=0x" << hex << VA << " size=" << dec << size << ", due to: " << err_msg << endl;
+      chosen_ptr->SetWeight(0);
+    }
+
+    return nullptr;
+  }
+
   const Page* VmAddressSpace::SetupPageMappingForPA(uint64 PA, EMemBankType bank, uint64 size, bool isInstr, GenPageRequest* pPageReq)
   {
     VmPaMapper * pa_mapper = mpVmFactory->VmPaMapperInstance(this);
@@ -945,6 +1039,19 @@ namespace Force {
     return table_obj;
   }
 
+  void VmAddressSpace::CommitSharedTable(uint64 VA, const PageTable* parentTable, const TablePte* pTablePte)
+  {
+    mpControlBlock->CommitPageTable(VA, parentTable, pTablePte, mVmConstraints);
+  }
+
+  void VmAddressSpace::CommitSharedPage(const Page* pSharedPage)
+  {
+    Page* page_copy = dynamic_cast<Page* >(pSharedPage->Clone());
+    page_copy->SetRootPageTable(mpControlBlock->GetRootPageTable(page_copy->Lower()));
+    mSharedPages.push_back(page_copy);
+    CommitPage(page_copy, page_copy->PageSize());
+  }
+
   void VmAddressSpace::WriteDescriptor(uint64 descrAddr, EMemBankType memBankType, uint64 descrValue, uint32 descrSize)
   {
     // write to memory with parametes: --   address    memory-bank          bytes      value       data   endian --//
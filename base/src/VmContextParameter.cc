@@ -104,11 +104,9 @@ namespace Force
   {
     VerifyCompatibility(rOther);
 
-    if (mInitialized < rOther.mInitialized) return true;
+    if (mInitialized != rOther.mInitialized) return (mInitialized < rOther.mInitialized);
 
-    if (mValue < rOther.mValue) return true;
-
-    return false;
+    return (mValue < rOther.mValue);
   }
 
   bool VmContextParameter::GetDelta(uint64& rValue, const Generator* pGen) const
@@ -239,6 +237,7 @@ namespace Force
       if (NullParameterPair(my_param, other_param)) continue;
 
       if (my_param->LessThan(*other_param)) return true;
+      if (other_param->LessThan(*my_param)) return false;
     }
 
     return false;
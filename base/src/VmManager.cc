@@ -15,6 +15,7 @@
 //
 #include "VmManager.h"
 
+#include <algorithm>
 #include <fstream>
 #include <memory>
 
@@ -22,6 +23,8 @@
 #include "Log.h"
 #include "MemoryManager.h"
 #include "MemoryTraits.h"
+#include "Register.h"
+#include "UtilityAlgorithms.h"
 #include "VmContextParameter.h"
 #include "VmFactory.h"
 #include "VmInfo.h"
@@ -63,7 +66,7 @@ namespace Force {
 
 
   VmManager::VmManager(const VmManager& rOther)
-    : Object(rOther), mpCurrentRegime(nullptr), mpCurrentMapper(nullptr), mpGenerator(nullptr), mpVmInfo(nullptr), mVmRegimes(), mVmContextInfoCache(), mVmFactories()
+    : Object(rOther), mpCurrentRegime(nullptr), mpCurrentMapper(nullptr), mpGenerator(nullptr), mpVmInfo(nullptr), mVmRegimes(), mVmContextInfoCache(), mContextRegisters(), mContextFingerprint(), mVmFactories()
   {
     for (auto const mapper_ptr : rOther.mVmRegimes) {
       if (nullptr != mapper_ptr) {
@@ -144,10 +147,50 @@ namespace Force {
     mpCurrentMapper = mpCurrentRegime->CurrentVmMapper();
     mpGenerator = gen;
     mpVmInfo = VmInfoInstance();
+
+    // collect every register any regime could depend on, so the lookup is done once instead of on each update.
+    auto reg_file = gen->GetRegisterFile();
+    for (auto regime_ptr : mVmRegimes) {
+      if (nullptr == regime_ptr) continue;
+
+      std::vector<string> reg_names;
+      regime_ptr->GetVmFactory()->GetRegisterContext(reg_names, true);
+      regime_ptr->GetVmFactory()->GetDelayedRegisterContext(reg_names);
+      for (auto const& reg_name : reg_names) {
+        insert_sorted<Register* >(mContextRegisters, reg_file->RegisterLookup(reg_name));
+      }
+    }
+  }
+
+  bool VmManager::IsContextRegister(const Register* pReg) const
+  {
+    return binary_search(mContextRegisters.begin(), mContextRegisters.end(), pReg);
+  }
+
+  bool VmManager::GetContextFingerprint(std::vector<uint64>& rFingerprint) const
+  {
+    rFingerprint.clear();
+    rFingerprint.reserve(mContextRegisters.size());
+
+    for (auto reg_ptr : mContextRegisters) {
+      if (not reg_ptr->IsInitialized()) {
+        rFingerprint.clear();
+        return false;
+      }
+      rFingerprint.push_back(reg_ptr->Value());
+    }
+
+    return true;
   }
 
   void VmManager::Update()
   {
+    // nothing the regimes depend on has changed since the last activation, the current regime, mapper and address space still apply.
+    std::vector<uint64> fingerprint;
+    if (GetContextFingerprint(fingerprint) and (fingerprint == mContextFingerprint)) {
+      return;
+    }
+
     mpVmInfo->Clear();
     mpVmInfo->GetCurrentStates(*mpGenerator);
     EVmRegimeType curr_regime_type = mpVmInfo->RegimeType();
@@ -172,6 +215,9 @@ namespace Force {
     LOG(notice) << "VM states: " << mpVmInfo->ToString() << " Current Regime: " << mpCurrentRegime->ToString() << " Regime Type:" << EVmRegimeType_to_string(curr_regime_type) << endl;
     mpCurrentRegime->Activate();
     mpCurrentMapper = mpCurrentRegime->CurrentVmMapper();
+
+    // activation can initialize context registers, so take the fingerprint of the state the regime settled in.
+    GetContextFingerprint(mContextFingerprint);
   }
 
   VmMapper* VmManager::GetVmMapper(const VmInfo& rVmInfo) const
@@ -274,6 +320,7 @@ namespace Force {
 
       VmRegime* target_regime = GetVmRegime(regimeType);
       vm_mapper = target_regime->CreateVmMapper(tmp_context);
+      vm_mapper->Initialize(); // map the common physical regions, so that the context is ready to switch to.
     }
 
     uint32 context_id = UpdateVmMapperCache(regimeType, vm_mapper);
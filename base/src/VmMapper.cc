@@ -83,10 +83,16 @@ namespace Force {
       FAIL("unexpected-size-0-request");
     }
 
-    auto virtual_constr = VirtualUsableConstraintSet(isInstr);
     const AddressTagging* addr_tagging = GetAddressTagging();
     uint64 untagged_va = addr_tagging->UntagAddress(va, isInstr);
     uint64 va_end = untagged_va + (size - 1);
+
+    // consecutive instructions mostly fall in the usable window cached around the previous PC.
+    if ((va_end >= untagged_va) and VirtualUsableContainsRange(untagged_va, va_end, isInstr)) {
+      return VerifyStreamingPageCrossing(untagged_va, va_end);
+    }
+
+    auto virtual_constr = VirtualUsableConstraintSet(isInstr);
     // << "{ VmMapper::VerifyStreamingVa }" << va << " : " << untagged_va << " : " << virtual_constr->ToString() << endl;
     ConstraintSet verify_ranges;
     if (va_end < untagged_va) {
@@ -101,12 +107,14 @@ namespace Force {
     if (not virtual_constr->ContainsConstraintSet(verify_ranges)) {
       do {
         auto addr_err_constr = GetVmConstraint(EVmConstraintType::AddressError);
-        const VariableModerator* var_mod = mpGenerator->GetVariableModerator(EVariableType::Value);
-        auto addr_err_var = dynamic_cast<const ValueVariable*>(var_mod->GetVariableSet()->FindVariable("Streaming address error"));
-        if (nullptr != addr_err_constr && addr_err_var->Value()) {
-          verify_ranges.SubConstraintSet(*addr_err_constr);
-          if (virtual_constr->ContainsConstraintSet(verify_ranges)) {
-            break;
+        if (nullptr != addr_err_constr) {
+          const VariableModerator* var_mod = mpGenerator->GetVariableModerator(EVariableType::Value);
+          auto addr_err_var = dynamic_cast<const ValueVariable*>(var_mod->GetVariableSet()->FindVariable("Streaming address error"));
+          if (addr_err_var->Value()) {
+            verify_ranges.SubConstraintSet(*addr_err_constr);
+            if (virtual_constr->ContainsConstraintSet(verify_ranges)) {
+              break;
+            }
           }
         }
         return false;
@@ -225,6 +233,14 @@ namespace Force {
     return usable_constr;
   }
 
+  bool VmDirectMapper::VirtualUsableContainsRange(uint64 lower, uint64 upper, bool isInstr) const
+  {
+    auto mem_manager = mpGenerator->GetMemoryManager();
+    auto mem_bank = mem_manager->GetMemoryBank(uint32(mMemoryBankType));
+
+    return mem_bank->UsableContainsRange(lower, upper);
+  }
+
   ConstraintSet* VmDirectMapper::VirtualUsableConstraintSetClone(bool isInstr)
   {
     auto mem_manager = mpGenerator->GetMemoryManager();
@@ -406,6 +422,11 @@ namespace Force {
     return mpCurrentAddressSpace->VirtualUsableConstraintSet(isInstr);
   }
 
+  bool VmPagingMapper::VirtualUsableContainsRange(uint64 lower, uint64 upper, bool isInstr) const
+  {
+    return mpCurrentAddressSpace->VirtualUsableContainsRange(lower, upper, isInstr);
+  }
+
   ConstraintSet* VmPagingMapper::VirtualUsableConstraintSetClone(bool isInstr)
   {
     return mpCurrentAddressSpace->VirtualUsableConstraintSetClone(isInstr);
@@ -519,15 +540,11 @@ namespace Force {
     const VmContext* as_context = pAddressSpace->GetControlBlock();
     auto find_iter = lower_bound(mAddressSpaces.begin(), mAddressSpaces.end(), as_context, compare_address_space_with_context);
 
-    if (find_iter == mAddressSpaces.end()) { // no match found.
-      mAddressSpaces.insert(mAddressSpaces.end(), pAddressSpace);
-    }
-    else {
-      if ((*find_iter)->GetControlBlock()->Matches(*as_context)) {
-        LOG(fail) << "{VmPagingMapper::AddAddressSpace} adding address space context with ID: " << dec << as_context->GenContextId() << " matches existing context with ID: " << (*find_iter)->GetControlBlock()->GenContextId() << endl;
-        FAIL("adding-duplicated-address-space-context");
-      }
+    if ((find_iter != mAddressSpaces.end()) and (*find_iter)->GetControlBlock()->Matches(*as_context)) {
+      LOG(fail) << "{VmPagingMapper::AddAddressSpace} adding address space context with ID: " << dec << as_context->GenContextId() << " matches existing context with ID: " << (*find_iter)->GetControlBlock()->GenContextId() << endl;
+      FAIL("adding-duplicated-address-space-context");
     }
+    mAddressSpaces.insert(find_iter, pAddressSpace);
     LOG(notice) << "{VmPagingMapper::AddAddressSpace} Created address space context ID: " << dec << as_context->GenContextId() << endl;
   }
 
@@ -135,6 +135,14 @@ namespace Force {
     return true;
   }
 
+  bool VmasControlBlock::CompatiblePageTableContext(const VmasControlBlock* pOtherControlBlock) const
+  {
+    // the page tables are walked the same way and the region pages are generated the same way.
+    return (PrivilegeLevel() == pOtherControlBlock->PrivilegeLevel()) and (Stage() == pOtherControlBlock->Stage()) and (DefaultMemoryBank() == pOtherControlBlock->DefaultMemoryBank())
+      and (IsBigEndian() == pOtherControlBlock->IsBigEndian()) and (MaxPhysicalAddress() == pOtherControlBlock->MaxPhysicalAddress()) and (mGranuleType == pOtherControlBlock->mGranuleType)
+      and (mPteIdentifierSuffix == pOtherControlBlock->mPteIdentifierSuffix) and (PteShift() == pOtherControlBlock->PteShift()) and (MaxTableLevel() == pOtherControlBlock->MaxTableLevel());
+  }
+
   bool VmasControlBlock::Validate(std::string& rErrMsg) const
   {
     bool valid_context = true;
@@ -0,0 +1,90 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "WeightedPicker.h"
+
+#include <algorithm>
+
+#include "Log.h"
+#include "RandomUtils.h"
+
+using namespace std;
+
+namespace Force {
+
+  uint32 WeightedPicker::AddNode()
+  {
+    mNodes.emplace_back();
+    return mNodes.size() - 1;
+  }
+
+  void WeightedPicker::AddLeaf(uint32 nodeIndex, uint64 weight, uint32 leafIndex)
+  {
+    AddEntry(nodeIndex, weight, leafIndex, true);
+  }
+
+  void WeightedPicker::AddBranch(uint32 nodeIndex, uint64 weight, uint32 childIndex)
+  {
+    // child nodes are added after their parents, which keeps the tree free of cycles.
+    if ((childIndex <= nodeIndex) or (childIndex >= mNodes.size())) {
+      LOG(fail) << "{WeightedPicker::AddBranch} invalid child node index " << dec << childIndex << " for node " << nodeIndex << "." << endl;
+      FAIL("invalid-child-node-index");
+    }
+
+    AddEntry(nodeIndex, weight, childIndex, false);
+  }
+
+  void WeightedPicker::AddEntry(uint32 nodeIndex, uint64 weight, uint32 index, bool isLeaf)
+  {
+    if (nodeIndex >= mNodes.size()) {
+      LOG(fail) << "{WeightedPicker::AddEntry} node index " << dec << nodeIndex << " out of range." << endl;
+      FAIL("node-index-out-of-range");
+    }
+
+    if (weight == 0) {
+      return; // never picked.
+    }
+
+    vector<WeightedEntry>& node_entries = mNodes[nodeIndex];
+    uint64 weight_bound = node_entries.empty() ? weight : (node_entries.back().mWeightBound + weight);
+    node_entries.push_back({weight_bound, index, isLeaf});
+  }
+
+  uint32 WeightedPicker::Pick() const
+  {
+    uint32 node_index = 0;
+    while (node_index < mNodes.size()) {
+      const vector<WeightedEntry>& node_entries = mNodes[node_index];
+      if (node_entries.empty()) {
+        break;
+      }
+
+      uint64 picked_value = random_value64(0, node_entries.back().mWeightBound - 1);
+      auto entry_iter = upper_bound(node_entries.cbegin(), node_entries.cend(), picked_value,
+        [](cuint64 value, const WeightedEntry& rEntry) { return value < rEntry.mWeightBound; });
+
+      if (entry_iter->mIsLeaf) {
+        return entry_iter->mIndex;
+      }
+
+      node_index = entry_iter->mIndex;
+    }
+
+    LOG(fail) << "{WeightedPicker::Pick} node " << dec << node_index << " has no weighted entries." << endl;
+    FAIL("no-weighted-entries");
+    return 0;
+  }
+
+}
@@ -53,6 +53,8 @@ namespace Force {
 
     void Signal(SimThreadEvent &pData);  //!< event 'payload' data is required...
 
+    bool NeedsRegisterReads() const;  //!< true if any plugin instance wants register read updates
+
   private:
     std::vector<SimPlugin *> mPlugins;  //!< plugin instances for a particular sim-thread
     //std::map<std::string, Force::plugin_node> * mpPluginNodesMap; //!< pointer to map by plugin name that can provide options strings that were specified in the config file.
@@ -50,6 +50,8 @@ namespace Force {
 
     virtual void parsePluginsOptions(std::map<std::string, std::string> &aRPluginsOptions) = 0; //!< sub-class must supply this method
 
+    virtual bool NeedsRegisterReads() const { return false; } //!< return true to also receive register read updates; only writes are reported otherwise
+
     //<! handle sim event notification...
 
     void HandleNotification(const Sender<ESimThreadEventType>* sender, ESimThreadEventType eventType, Object* pPayload); 
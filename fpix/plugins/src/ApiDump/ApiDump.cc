@@ -69,6 +69,8 @@ class ApiDump: public Force::SimPlugin
             return is_supported;
         };
   
+        bool NeedsRegisterReads() const { return true; } // dump every register access, reads included
+  
         void parsePluginsClargs(vector<string> & plugins_cl_args) 
         {
             cout << MethodName("parsePluginsClargs") << endl;
@@ -0,0 +1,154 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "CoverageCounts.h"
+#include "Log.h"
+#include "ParseGuide.h"
+#include "SimAPI.h"
+#include "SimEvent.h"
+#include "SimPlugin.h"
+
+using namespace std;
+using namespace Force;
+
+//***********************************************************************************************
+// CoverageCounters - count opcode classes, mnemonics, registers written, CSRs touched, exception
+//      causes and privilege transitions in memory, then write a single summary file at test end.
+//***********************************************************************************************
+
+namespace Force
+{
+class CoverageCounters : public Force::SimPlugin
+{
+    public:
+        CoverageCounters() :
+          _mCounts(),
+          _mSummaryFile("coverage_counters.csv"),
+          _mOpcode(0),
+          _mDisassembly()
+        {}
+
+        const string Name() { return "CoverageCounters"; }
+
+        bool IsSupported(ESimThreadEventType eventType) const
+        {
+            bool is_supported = false;
+
+            switch(eventType)
+            {
+                case ESimThreadEventType::PRE_STEP:
+                case ESimThreadEventType::POST_STEP:
+                case ESimThreadEventType::END_TEST:
+                is_supported = true;
+                break;
+
+                default: break;
+            }
+
+            return is_supported;
+        };
+
+        bool NeedsRegisterReads() const { return false; } // CSR reads are decoded from the instruction word
+
+        void parsePluginsClargs(vector<string> &plugins_cl_args) {  }
+
+        void parsePluginsOptions(std::map<std::string, std::string> & arPluginsOptions)
+        {
+            Force::ParseGuide guide(std::string("summary_file"), &_mSummaryFile);
+            guide.parse(arPluginsOptions);
+
+            LOG(notice) << "In CoverageCounters, options initialized: " << endl;
+            LOG(notice) << "\tsummary_file: " << _mSummaryFile << endl;
+        }
+
+        // fetch the instruction word about to be stepped...
+        void onPreStep()
+        {
+            uint64 rval = 0;
+            uint64 rmask = 0;
+            SimPtr()->ReadRegister(CpuID(), "PC", &rval, &rmask);
+            uint64_t pc = rval;
+
+            string opcode;
+            _mDisassembly.clear();
+            SimPtr()->GetDisassembly(CpuID(), &pc, opcode, _mDisassembly);
+            _mOpcode = opcode.empty() ? 0 : uint32_t(stoull(opcode, nullptr, 16));
+        }
+
+        // count the instruction and its updates...
+        void onStep(vector<RegUpdate> *apRegUpdates, vector<MemUpdate> *apMemUpdates, vector<MmuEvent> *apMMUUpdates, vector<ExceptionUpdate> *apExceptions)
+        {
+            _mCounts.RecordInstruction(CpuID(), _mOpcode, _mDisassembly);
+
+            for (const auto& reg_update : *apRegUpdates)
+            {
+                if (reg_update.access_type != "write")
+                    continue;
+
+                if (reg_update.regname == "privilege")
+                    _mCounts.RecordPrivilege(CpuID(), uint32_t(reg_update.rval & reg_update.mask));
+                else
+                    _mCounts.RecordRegisterWrite(CpuID(), reg_update.regname);
+            }
+
+            for (const auto& exception_update : *apExceptions)
+            {
+                _mCounts.RecordException(CpuID(), exception_update.mExceptionID, exception_update.mComments);
+            }
+        }
+
+        // the counters cover every thread, so rewrite the whole summary as each thread ends...
+        void atTestEnd()
+        {
+            std::ofstream stream(_mSummaryFile, std::ofstream::out | std::ofstream::trunc);
+            if (not stream.is_open())
+            {
+                LOG(warn) << "CoverageCounters: unable to open summary file " << _mSummaryFile << endl;
+                return;
+            }
+
+            _mCounts.WriteSummary(stream);
+        }
+
+    private:
+        CoverageCounts _mCounts; //!< counters for all threads
+        std::string _mSummaryFile; //!< summary file written at test end
+        uint32_t _mOpcode; //!< instruction word of the current step
+        std::string _mDisassembly; //!< disassembly of the current step
+};
+}
+
+// plugin + 'extern C' methods to be compiled into shared library:
+
+extern "C" Force::SimPlugin* create()
+{
+    return new Force::CoverageCounters();
+}
+
+extern "C" void destroy(Force::SimPlugin* t1)
+{
+    delete t1;
+}
+
+extern "C" int is_shared()
+{
+    return 1;  //!< a single instance collects the counters of every thread
+}
@@ -0,0 +1,192 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "CoverageCounts.h"
+
+#include <iomanip>
+#include <sstream>
+
+using namespace std;
+
+namespace Force
+{
+
+    const char* ECoverageCategory_to_string(ECoverageCategory category)
+    {
+        switch (category)
+        {
+            case ECoverageCategory::Steps: return "steps";
+            case ECoverageCategory::OpcodeClass: return "opcode_class";
+            case ECoverageCategory::Mnemonic: return "mnemonic";
+            case ECoverageCategory::RegisterWrite: return "register_write";
+            case ECoverageCategory::CsrRead: return "csr_read";
+            case ECoverageCategory::CsrWrite: return "csr_write";
+            case ECoverageCategory::Exception: return "exception";
+            case ECoverageCategory::Privilege: return "privilege";
+            default: break;
+        }
+
+        return "unknown";
+    }
+
+    const char* CoverageCounts::OpcodeClass(uint32_t opcode)
+    {
+        // an all-zero word is defined to be illegal; the simulator also reports it when the fetch faulted
+        if (opcode == 0)
+            return "UNKNOWN";
+
+        switch (opcode & 0x3)
+        {
+            case 0: return "C0";
+            case 1: return "C1";
+            case 2: return "C2";
+            default: break;
+        }
+
+        switch (opcode & 0x7f)
+        {
+            case 0x03: return "LOAD";
+            case 0x07: return "LOAD-FP";
+            case 0x0f: return "MISC-MEM";
+            case 0x13: return "OP-IMM";
+            case 0x17: return "AUIPC";
+            case 0x1b: return "OP-IMM-32";
+            case 0x23: return "STORE";
+            case 0x27: return "STORE-FP";
+            case 0x2f: return "AMO";
+            case 0x33: return "OP";
+            case 0x37: return "LUI";
+            case 0x3b: return "OP-32";
+            case 0x43: return "MADD";
+            case 0x47: return "MSUB";
+            case 0x4b: return "NMSUB";
+            case 0x4f: return "NMADD";
+            case 0x53: return "OP-FP";
+            case 0x57: return "OP-V";
+            case 0x63: return "BRANCH";
+            case 0x67: return "JALR";
+            case 0x6f: return "JAL";
+            case 0x73: return "SYSTEM";
+            default: break;
+        }
+
+        return "UNKNOWN";
+    }
+
+    const char* CoverageCounts::PrivilegeName(uint32_t privilege)
+    {
+        switch (privilege)
+        {
+            case 0: return "U";
+            case 1: return "S";
+            case 2: return "H";
+            case 3: return "M";
+            default: break;
+        }
+
+        return "?";
+    }
+
+    void CoverageCounts::RecordInstruction(uint32_t cpuId, uint32_t opcode, const string& rDisassembly)
+    {
+        Increment(cpuId, ECoverageCategory::Steps, "total");
+        Increment(cpuId, ECoverageCategory::OpcodeClass, OpcodeClass(opcode));
+
+        auto mnemonic_end = rDisassembly.find_first_of(" \t");
+        Increment(cpuId, ECoverageCategory::Mnemonic, rDisassembly.substr(0, mnemonic_end));
+
+        if ((opcode & 0x7f) == 0x73)
+            RecordCsrAccess(cpuId, opcode);
+    }
+
+    void CoverageCounts::RecordCsrAccess(uint32_t cpuId, uint32_t opcode)
+    {
+        uint32_t funct3 = (opcode >> 12) & 0x7;
+        if ((funct3 & 0x3) == 0)
+            return; // ecall, ebreak, xRET, wfi, sfence.vma and friends do not name a CSR
+
+        uint32_t rd = (opcode >> 7) & 0x1f;
+        uint32_t rs1 = (opcode >> 15) & 0x1f; // source register or zero-extended immediate
+        bool is_read = true;
+        bool is_write = true;
+
+        if ((funct3 & 0x3) == 1)
+            is_read = (rd != 0); // csrrw(i) with rd x0 does not read the CSR
+        else
+            is_write = (rs1 != 0); // csrrs(i)/csrrc(i) with rs1 x0 or a zero immediate do not write the CSR
+
+        stringstream csr_stream;
+        csr_stream << "0x" << hex << setw(3) << setfill('0') << (opcode >> 20);
+        string csr_name = csr_stream.str();
+
+        if (is_read)
+            Increment(cpuId, ECoverageCategory::CsrRead, csr_name);
+        if (is_write)
+            Increment(cpuId, ECoverageCategory::CsrWrite, csr_name);
+    }
+
+    void CoverageCounts::RecordRegisterWrite(uint32_t cpuId, const string& rRegName)
+    {
+        Increment(cpuId, ECoverageCategory::RegisterWrite, rRegName);
+    }
+
+    void CoverageCounts::RecordException(uint32_t cpuId, uint32_t exceptionId, const string& rComments)
+    {
+        Increment(cpuId, ECoverageCategory::Exception, rComments + ":" + to_string(exceptionId));
+    }
+
+    void CoverageCounts::RecordPrivilege(uint32_t cpuId, uint32_t privilege)
+    {
+        CpuCounts& cpu_counts = mCpuCounts[cpuId];
+
+        if (cpu_counts.mPrivilege != privilege)
+            Increment(cpuId, ECoverageCategory::Privilege, string(PrivilegeName(cpu_counts.mPrivilege)) + "->" + PrivilegeName(privilege));
+
+        cpu_counts.mPrivilege = privilege;
+    }
+
+    uint64_t CoverageCounts::Count(ECoverageCategory category, uint32_t cpuId, const string& rName) const
+    {
+        auto cpu_iter = mCpuCounts.find(cpuId);
+        if (cpu_iter == mCpuCounts.end())
+            return 0;
+
+        const auto& counts = cpu_iter->second.mCounts[uint32_t(category)];
+        auto count_iter = counts.find(rName);
+        return (count_iter == counts.end()) ? 0 : count_iter->second;
+    }
+
+    void CoverageCounts::WriteSummary(ostream& rOut) const
+    {
+        rOut << "Category, CpuID, Name, Count" << endl;
+
+        for (const auto& cpu_item : mCpuCounts)
+        {
+            for (uint32_t category = 0; category < uint32_t(ECoverageCategory::Count); ++category)
+            {
+                // the counters are hashed while collecting; sort them by name for a stable summary
+                const auto& counts = cpu_item.second.mCounts[category];
+                map<string, uint64_t> sorted_counts(counts.begin(), counts.end());
+
+                for (const auto& count_item : sorted_counts)
+                {
+                    rOut << ECoverageCategory_to_string(ECoverageCategory(category)) << ", " << dec << cpu_item.first << ", "
+                         << count_item.first << ", " << count_item.second << endl;
+                }
+            }
+        }
+    }
+
+}
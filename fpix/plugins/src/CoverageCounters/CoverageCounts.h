@@ -0,0 +1,87 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef Force_CoverageCounts_H
+#define Force_CoverageCounts_H
+
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+
+namespace Force
+{
+
+    //!< coverage counter categories, in the order they are written to the summary
+    enum class ECoverageCategory : uint32_t
+    {
+        Steps,
+        OpcodeClass,
+        Mnemonic,
+        RegisterWrite,
+        CsrRead,
+        CsrWrite,
+        Exception,
+        Privilege,
+        Count
+    };
+
+    const char* ECoverageCategory_to_string(ECoverageCategory category); //!< category name used in the summary
+
+    /*!
+      \class CoverageCounts
+      \brief In-memory coverage counters, kept per cpu and category and keyed by name.
+
+      Instruction words are decoded as RISC-V encodings: the major opcode gives the opcode class and SYSTEM
+      instructions with a non-zero funct3 give the CSR read/write accesses, so register read updates are not needed.
+    */
+    class CoverageCounts
+    {
+    public:
+        CoverageCounts() : mCpuCounts() { }
+
+        void RecordInstruction(uint32_t cpuId, uint32_t opcode, const std::string& rDisassembly); //!< count one executed instruction
+        void RecordRegisterWrite(uint32_t cpuId, const std::string& rRegName); //!< count a register write update
+        void RecordException(uint32_t cpuId, uint32_t exceptionId, const std::string& rComments); //!< count an exception event
+        void RecordPrivilege(uint32_t cpuId, uint32_t privilege); //!< note the current privilege level, counting it as a transition if it changed
+
+        uint64_t Count(ECoverageCategory category, uint32_t cpuId, const std::string& rName) const; //!< return a single counter value, 0 if never counted
+        void WriteSummary(std::ostream& rOut) const; //!< write all counters, one "category, cpu, name, count" line each
+
+        static const char* OpcodeClass(uint32_t opcode); //!< return the opcode class name of an instruction word
+        static const char* PrivilegeName(uint32_t privilege); //!< return the single-letter name of a privilege level
+    private:
+        struct CpuCounts
+        {
+            CpuCounts() : mPrivilege(3), mCounts() { }
+
+            uint32_t mPrivilege; //!< current privilege level, harts come out of reset in machine mode
+            std::unordered_map<std::string, uint64_t> mCounts[uint32_t(ECoverageCategory::Count)]; //!< counters for each category
+        };
+
+        void Increment(uint32_t cpuId, ECoverageCategory category, const std::string& rName) //!< increment a single counter
+        {
+            ++mCpuCounts[cpuId].mCounts[uint32_t(category)][rName];
+        }
+
+        void RecordCsrAccess(uint32_t cpuId, uint32_t opcode); //!< count the CSR accesses of a SYSTEM instruction
+    private:
+        std::map<uint32_t, CpuCounts> mCpuCounts; //!< counters ordered by cpu ID
+    };
+
+}
+
+#endif
@@ -271,6 +271,8 @@ class RegDepCounter : public Force::SimPlugin
             return is_supported;
         };
       
+        bool NeedsRegisterReads() const { return true; } // read-after-write dependencies need source register reads
+      
         // Turn arguments from the top level that went uninterpreted into possible plugin options.
         void parsePluginsClargs(vector<string> &plugins_cl_args) {  }
       
@@ -87,6 +87,8 @@ class RegDependsChecker : public Force::SimPlugin
             return is_supported;
         };
 
+        bool NeedsRegisterReads() const { return true; } // dependency checks need source register reads
+
         // Turn arguments from the top level that went uninterpreted into possible plugin options.
         void parsePluginsClargs(vector<string> &plugins_cl_args)
         {
@@ -211,6 +211,12 @@ PluginManager::~PluginManager() {
   }
 }
 
+//!< check whether any plugin instance asked for register read updates...
+
+bool PluginManager::NeedsRegisterReads() const {
+  return std::any_of(mPlugins.cbegin(), mPlugins.cend(), [](const SimPlugin* pPlugin) { return pPlugin->NeedsRegisterReads(); });
+}
+
 //!< send sim-event notification to connected plugins... 
 
 void PluginManager::Signal(SimThreadEvent &pData) {
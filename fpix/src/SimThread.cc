@@ -66,6 +66,10 @@ void SimThread::Init() {
 
   mPluginsMgr = new PluginManager(event_types);
 
+  // register read updates cost a simulator callback per operand, so only ask for them when a plugin uses them...
+  if (mPluginsMgr->NeedsRegisterReads())
+    mSimPtr->SetRegisterReadUpdates(true);
+
   // at start, these are the only known events. Other events may be inserted during simulation...
   mEvents.push_back( new SimThreadStartTestEvent( *this ) );
   mEvents.push_back( new SimThreadStepEvent(*this, mSimCfg->MaxInsts(), mSimCfg->TreatLowPowerAsNOP() ) );
@@ -446,6 +446,15 @@ namespace Force {
       delete map_item.second;
   }
 
+  void Memory::Clear()
+  {
+    for (auto &map_item : mContent)
+      delete map_item.second;
+
+    mContent.clear();
+    mReservedRanges.clear();
+  }
+
   /*!
     \class MetaAccess
     \brief class for aligned memory access.
@@ -73,6 +73,7 @@ namespace Force {
     void Dump(std::ostream& out_str) const;                  //!< dump memory model for debug
     void Dump (std::ostream& out_str, uint64 address, uint64 nBytes) const; //!< dump memory range
     void GetSections(std::vector<Section>& rSections) const;    //!< Get sections the memory object contained, by address ascending order
+    void Clear(); //!< Remove all memory content and reserved ranges, returning the memory model to its freshly constructed state.
 
     Memory(EMemBankType bankType, bool autoInit) : mBankType(bankType), mContent(), mAutoInit(autoInit) { }  //!< Constructor.
     ~Memory(); //!< Destructor.
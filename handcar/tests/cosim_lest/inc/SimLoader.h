@@ -30,6 +30,7 @@ struct SimDllApi {
   void (*initialize_simulator)(const char*);
   void (*terminate_simulator)();
   int (*simulator_load_elf)(int, const char*);
+  int (*reset_simulator)();
   int (*step_simulator)(int, int, int);
   int (*get_disassembly)(const uint64_t*, char**, char**);
   int (*get_simulator_version)(char*);
@@ -41,6 +42,17 @@ struct SimDllApi {
   int (*write_simulator_memory)(int, const uint64_t*, int, const uint8_t*);
   int (*translate_virtual_address)(int, const uint64_t*, int, uint64_t*, uint64_t*);
   int (*initialize_simulator_memory)(int, const uint64_t*, int, uint64_t);
+  void (*set_register_read_updates)(int);
+  struct handcar_instance* (*create_simulator_instance)();
+  void (*destroy_simulator_instance)(struct handcar_instance*);
+  struct handcar_instance* (*current_simulator_instance)();
+  void (*initialize_simulator_for_instance)(struct handcar_instance*, const char*);
+  int (*simulator_load_elf_for_instance)(struct handcar_instance*, int, const char*);
+  int (*reset_simulator_for_instance)(struct handcar_instance*);
+  int (*step_simulator_for_instance)(struct handcar_instance*, int, int, int);
+  int (*read_simulator_register_for_instance)(struct handcar_instance*, int, const char*, uint8_t*, int);
+  int (*write_simulator_register_for_instance)(struct handcar_instance*, int, const char*, const uint8_t*, int);
+  int (*write_simulator_memory_for_instance)(struct handcar_instance*, int, const uint64_t*, int, const uint8_t*);
 
   SimDllApi() : 
     sim_lib(NULL),
@@ -48,6 +60,7 @@ struct SimDllApi {
     terminate_simulator(NULL),
     set_simulator_parameter(NULL),
     simulator_load_elf(NULL),
+    reset_simulator(NULL),
     step_simulator(NULL),
     get_disassembly(NULL),
     get_simulator_version(NULL),
@@ -58,7 +71,18 @@ struct SimDllApi {
     read_simulator_memory(NULL),
     write_simulator_memory(NULL),
     translate_virtual_address(NULL),
-    initialize_simulator_memory(NULL)
+    initialize_simulator_memory(NULL),
+    set_register_read_updates(NULL),
+    create_simulator_instance(NULL),
+    destroy_simulator_instance(NULL),
+    current_simulator_instance(NULL),
+    initialize_simulator_for_instance(NULL),
+    simulator_load_elf_for_instance(NULL),
+    reset_simulator_for_instance(NULL),
+    step_simulator_for_instance(NULL),
+    read_simulator_register_for_instance(NULL),
+    write_simulator_register_for_instance(NULL),
+    write_simulator_memory_for_instance(NULL)
     {};
   
   // other simulator functions as they become available...
@@ -97,6 +97,26 @@ int open_sim_dll(const char *sim_dll_path,struct SimDllApi *api_ptrs) {
    if(CheckSimOp("initialize_simulator_memory"))
      return -1;
 
+   //!< optional simulator functions; older simulator builds may not provide these...
+   (*api_ptrs).set_register_read_updates = (void (*)(int)) dlsym(my_sim_lib,"set_register_read_updates");
+   if ((*api_ptrs).set_register_read_updates == NULL)
+     dlerror(); // clear the error, the simulator keeps reporting register reads
+
+   (*api_ptrs).reset_simulator = (int (*)()) dlsym(my_sim_lib,"reset_simulator");
+   (*api_ptrs).reset_simulator_for_instance = (int (*)(struct handcar_instance*)) dlsym(my_sim_lib,"reset_simulator_for_instance");
+   dlerror(); // clear the error of any missing reset function, the simulator is then rebuilt to run another test
+
+   (*api_ptrs).create_simulator_instance = (struct handcar_instance* (*)()) dlsym(my_sim_lib,"create_simulator_instance");
+   (*api_ptrs).destroy_simulator_instance = (void (*)(struct handcar_instance*)) dlsym(my_sim_lib,"destroy_simulator_instance");
+   (*api_ptrs).current_simulator_instance = (struct handcar_instance* (*)()) dlsym(my_sim_lib,"current_simulator_instance");
+   (*api_ptrs).initialize_simulator_for_instance = (void (*)(struct handcar_instance*, const char*)) dlsym(my_sim_lib,"initialize_simulator_for_instance");
+   (*api_ptrs).simulator_load_elf_for_instance = (int (*)(struct handcar_instance*, int, const char*)) dlsym(my_sim_lib,"simulator_load_elf_for_instance");
+   (*api_ptrs).step_simulator_for_instance = (int (*)(struct handcar_instance*, int, int, int)) dlsym(my_sim_lib,"step_simulator_for_instance");
+   (*api_ptrs).read_simulator_register_for_instance = (int (*)(struct handcar_instance*, int, const char*, uint8_t*, int)) dlsym(my_sim_lib,"read_simulator_register_for_instance");
+   (*api_ptrs).write_simulator_register_for_instance = (int (*)(struct handcar_instance*, int, const char*, const uint8_t*, int)) dlsym(my_sim_lib,"write_simulator_register_for_instance");
+   (*api_ptrs).write_simulator_memory_for_instance = (int (*)(struct handcar_instance*, int, const uint64_t*, int, const uint8_t*)) dlsym(my_sim_lib,"write_simulator_memory_for_instance");
+   dlerror(); // clear the error of any missing instance function, the simulator then only provides its global instance
+
    //!< other simulator functions T
 
    return 0;
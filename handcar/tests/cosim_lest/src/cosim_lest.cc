@@ -18,6 +18,8 @@
 #include <cstring>
 #include <iostream>
 #include <map>
+#include <mutex>
+#include <thread>
 
 #include "lest/lest.hpp"
 
@@ -27,10 +29,22 @@ using text = std::string;
 
 std::vector<uint8_t> global_buffer(32);
 const char* handcar_path = "../../../utils/handcar/handcar_cosim.so";
+uint64_t global_register_read_count = 0;
+struct handcar_instance* (*global_current_instance)() = nullptr;
+std::map<struct handcar_instance*, uint64_t> global_instance_write_counts;
+std::mutex global_instance_write_counts_mutex;
 
 extern "C" {
   void update_generator_register(uint32_t cpuid, const char *pRegName, uint64_t rval, uint64_t mask, const char *pAccessType)
   {
+    if (strcmp(pAccessType, "read") == 0) {
+      ++global_register_read_count;
+    }
+    else if (global_current_instance != nullptr) {
+      std::lock_guard<std::mutex> lock(global_instance_write_counts_mutex);
+      ++global_instance_write_counts[global_current_instance()];
+    }
+
     //std::cout << "REG update: " << std::endl;
     //std::cout << pRegName << " " << std::hex << rval << " " << pAccessType  << std::endl;
   }
@@ -50,6 +64,15 @@ void update_vector_element(uint32_t cpuid, const char *pRegName, uint32_t vRegIn
 
 }
 
+//!< check the simulator provides the optional simulator instance api
+bool has_instance_api(const SimDllApi& rSimApi)
+{
+  return rSimApi.create_simulator_instance != NULL and rSimApi.destroy_simulator_instance != NULL and
+    rSimApi.current_simulator_instance != NULL and rSimApi.initialize_simulator_for_instance != NULL and
+    rSimApi.simulator_load_elf_for_instance != NULL and rSimApi.step_simulator_for_instance != NULL and
+    rSimApi.read_simulator_register_for_instance != NULL and rSimApi.write_simulator_register_for_instance != NULL and
+    rSimApi.write_simulator_memory_for_instance != NULL;
+}
 
 const lest::test specification[] = {
 
@@ -437,6 +460,67 @@ CASE("Test 4, get_disassembly(...) api") {
   }
 },
 
+CASE("Test 4.a, set_register_read_updates(...) api") {
+
+  SETUP("Load SimDllApi Object")  {
+    SimDllApi sim_api;
+    std::string options = "-p1";
+    std::string elf_path = "../resources/multiply.riscv";
+    int num_steps = 200;
+    int stx_failed = 0;
+    std::vector<std::string> reg_names = {"pc", "x1", "x2", "x10", "x11", "x15"};
+
+    EXPECT(not open_sim_dll(handcar_path, &sim_api));
+
+    // the simulator does not provide the optional api, nothing to test
+    if (sim_api.set_register_read_updates == NULL) {
+      close_sim_dll(&sim_api);
+      return;
+    }
+
+    SECTION("Test 4.a, 0: register reads are reported only when enabled, final state is unchanged") {
+      std::vector<uint64_t> final_values[2];
+
+      for (int enable = 0; enable < 2; ++enable) {
+        // start each run from a freshly loaded simulator
+        if (enable) {
+          EXPECT(not open_sim_dll(handcar_path, &sim_api));
+        }
+
+        sim_api.set_register_read_updates(enable);
+        global_register_read_count = 0;
+
+        sim_api.initialize_simulator(options.c_str());
+        sim_api.simulator_load_elf(0, elf_path.c_str());
+
+        int rcode = 0;
+        for (int step = 0; step < num_steps; ++step) {
+          rcode |= sim_api.step_simulator(0, 1, stx_failed);
+        }
+        EXPECT(rcode == 0);
+
+        for (const std::string& reg_name : reg_names) {
+          uint64_t value = 0;
+          EXPECT(sim_api.read_simulator_register(0, reg_name.c_str(), reinterpret_cast<uint8_t*>(&value), 8) == 0);
+          final_values[enable].push_back(value);
+        }
+
+        sim_api.terminate_simulator();
+        close_sim_dll(&sim_api);
+
+        if (enable) {
+          EXPECT(global_register_read_count > 0u);
+        }
+        else {
+          EXPECT(global_register_read_count == 0u);
+        }
+      }
+
+      EXPECT(final_values[0] == final_values[1]);
+    }
+  }
+},
+
 CASE("Test 5, read_simulator_register(...) and write_simulator_register(...) api") {
 
   SETUP("Load SimDllApi Object")  {
@@ -903,6 +987,173 @@ CASE("Test 7, translate_virtual_address(...) api") {
 },
 
 
+CASE("Test 8, simulator instances") {
+
+  SETUP("Load SimDllApi Object")  {
+    SimDllApi sim_api;
+    std::string elf_path = "../resources/multiply.riscv";
+    int num_steps = 200;
+    int stx_failed = 0;
+    std::vector<std::string> reg_names = {"pc", "x1", "x2", "x5", "x10", "x11", "x15"};
+
+    EXPECT(not open_sim_dll(handcar_path, &sim_api));
+
+    // the simulator does not provide the optional api, nothing to test
+    if (not has_instance_api(sim_api)) {
+      close_sim_dll(&sim_api);
+      return;
+    }
+
+    global_current_instance = sim_api.current_simulator_instance;
+
+    auto read_registers = [&](struct handcar_instance* pInstance) {
+      std::vector<uint64_t> values;
+      for (const std::string& reg_name : reg_names) {
+        uint64_t value = 0;
+        EXPECT(sim_api.read_simulator_register_for_instance(pInstance, 0, reg_name.c_str(), reinterpret_cast<uint8_t*>(&value), 8) == 0);
+        values.push_back(value);
+      }
+      return values;
+    };
+
+    SECTION("Test 8, 0: two instances stepped in parallel keep separate state") {
+      // reference run of the ELF program on its own
+      struct handcar_instance* reference = sim_api.create_simulator_instance();
+      sim_api.initialize_simulator_for_instance(reference, "-p1");
+      EXPECT(sim_api.simulator_load_elf_for_instance(reference, 0, elf_path.c_str()) == 0);
+      int rcode = 0;
+      for (int step = 0; step < num_steps; ++step) {
+        rcode |= sim_api.step_simulator_for_instance(reference, 0, 1, stx_failed);
+      }
+      EXPECT(rcode == 0);
+      std::vector<uint64_t> reference_values = read_registers(reference);
+      sim_api.destroy_simulator_instance(reference);
+
+      // the ELF program in one instance, a run of ADDI x5, x5, 1 placed at the reset vector in the other
+      struct handcar_instance* elf_instance = sim_api.create_simulator_instance();
+      struct handcar_instance* addi_instance = sim_api.create_simulator_instance();
+      EXPECT(elf_instance != addi_instance);
+      sim_api.initialize_simulator_for_instance(elf_instance, "-p1");
+      EXPECT(sim_api.simulator_load_elf_for_instance(elf_instance, 0, elf_path.c_str()) == 0);
+      sim_api.initialize_simulator_for_instance(addi_instance, "--auto-init-mem");
+
+      uint8_t zero[8] = {0};
+      EXPECT(sim_api.write_simulator_register_for_instance(addi_instance, 0, "x5", zero, 8) == 0);
+      uint8_t addi_data[4] = {0x93, 0x82, 0x12, 0x0};  // ADDI x5, x5, 1
+      uint64_t reset_vector = 0x1000;
+      for (int step = 0; step < num_steps; ++step) {
+        uint64_t instr_addr = reset_vector + 4 * step;
+        EXPECT(sim_api.write_simulator_memory_for_instance(addi_instance, 0, &instr_addr, 4, addi_data) == 0);
+      }
+
+      global_instance_write_counts.clear();
+      int elf_rcode = 0;
+      int addi_rcode = 0;
+      std::thread elf_thread([&]() {
+        for (int step = 0; step < num_steps; ++step) {
+          elf_rcode |= sim_api.step_simulator_for_instance(elf_instance, 0, 1, stx_failed);
+        }
+      });
+      std::thread addi_thread([&]() {
+        for (int step = 0; step < num_steps; ++step) {
+          addi_rcode |= sim_api.step_simulator_for_instance(addi_instance, 0, 1, stx_failed);
+        }
+      });
+      elf_thread.join();
+      addi_thread.join();
+      EXPECT(elf_rcode == 0);
+      EXPECT(addi_rcode == 0);
+
+      EXPECT(read_registers(elf_instance) == reference_values);
+
+      uint64_t x5_value = 0;
+      EXPECT(sim_api.read_simulator_register_for_instance(addi_instance, 0, "x5", reinterpret_cast<uint8_t*>(&x5_value), 8) == 0);
+      EXPECT(x5_value == uint64_t(num_steps));
+      uint64_t pc_value = 0;
+      EXPECT(sim_api.read_simulator_register_for_instance(addi_instance, 0, "pc", reinterpret_cast<uint8_t*>(&pc_value), 8) == 0);
+      EXPECT(pc_value == reset_vector + 4 * num_steps);
+
+      // each instance reported its own updates, at least the x5 and PC writes of every ADDI for the second one
+      EXPECT(global_instance_write_counts[elf_instance] > 0u);
+      EXPECT(global_instance_write_counts[addi_instance] >= uint64_t(2 * num_steps));
+
+      sim_api.destroy_simulator_instance(elf_instance);
+      sim_api.destroy_simulator_instance(addi_instance);
+      global_current_instance = nullptr;
+      close_sim_dll(&sim_api);
+    }
+  }
+},
+
+CASE("Test 9, reset_simulator(...) api") {
+
+  SETUP("Load SimDllApi Object")  {
+    SimDllApi sim_api;
+    std::string elf_path = "../resources/multiply.riscv";
+    int num_steps = 200;
+    int stx_failed = 0;
+    std::vector<std::string> reg_names = {"pc", "x1", "x2", "x5", "x10", "x11", "x15"};
+
+    EXPECT(not open_sim_dll(handcar_path, &sim_api));
+
+    auto read_registers = [&](struct handcar_instance* pInstance) {
+      std::vector<uint64_t> values;
+      for (const std::string& reg_name : reg_names) {
+        uint64_t value = 0;
+        EXPECT(sim_api.read_simulator_register_for_instance(pInstance, 0, reg_name.c_str(), reinterpret_cast<uint8_t*>(&value), 8) == 0);
+        values.push_back(value);
+      }
+      return values;
+    };
+
+    auto run_program = [&](struct handcar_instance* pInstance) {
+      EXPECT(sim_api.simulator_load_elf_for_instance(pInstance, 0, elf_path.c_str()) == 0);
+      int rcode = 0;
+      for (int step = 0; step < num_steps; ++step) {
+        rcode |= sim_api.step_simulator_for_instance(pInstance, 0, 1, stx_failed);
+      }
+      EXPECT(rcode == 0);
+      return read_registers(pInstance);
+    };
+
+    SECTION("Test 9, 0: reset_simulator() called before initialization") {
+      if (sim_api.reset_simulator != NULL) {
+        EXPECT(sim_api.reset_simulator() == 1);
+      }
+      close_sim_dll(&sim_api);
+    }
+
+    SECTION("Test 9, 1: a reset instance runs a program like a fresh one") {
+      if (not has_instance_api(sim_api) or sim_api.reset_simulator_for_instance == NULL) {
+        close_sim_dll(&sim_api);
+        return;
+      }
+
+      struct handcar_instance* fresh_instance = sim_api.create_simulator_instance();
+      sim_api.initialize_simulator_for_instance(fresh_instance, "-p1");
+      std::vector<uint64_t> power_on_values = read_registers(fresh_instance);
+      std::vector<uint64_t> fresh_values = run_program(fresh_instance);
+      sim_api.destroy_simulator_instance(fresh_instance);
+
+      struct handcar_instance* reused_instance = sim_api.create_simulator_instance();
+      sim_api.initialize_simulator_for_instance(reused_instance, "-p1");
+      EXPECT(run_program(reused_instance) == fresh_values);
+
+      // leave state behind that a fresh instance would not have
+      uint8_t all_ones[8] = {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
+      EXPECT(sim_api.write_simulator_register_for_instance(reused_instance, 0, "x5", all_ones, 8) == 0);
+      EXPECT(sim_api.write_simulator_register_for_instance(reused_instance, 0, "x15", all_ones, 8) == 0);
+
+      EXPECT(sim_api.reset_simulator_for_instance(reused_instance) == 0);
+      EXPECT(read_registers(reused_instance) == power_on_values);
+      EXPECT(run_program(reused_instance) == fresh_values);
+
+      sim_api.destroy_simulator_instance(reused_instance);
+      close_sim_dll(&sim_api);
+    }
+  }
+},
+
 };
 
 int main(int argc, char* argv[])
@@ -24,6 +24,7 @@ from base.Macro import Macro
 from base.Sequence import Sequence
 from base.TestException import *
 from base.ThreadRequest import ThreadRequestContextManager
+from base.WeightedPicker import WeightedPicker
 
 
 #  GenThreadSetupSequence class
@@ -557,7 +558,15 @@ class GenThread(object):
     def getVariable(self, name, var_type):
         return self.interface.getVariable(self.genThreadID, name, var_type)
 
+    # Compile a weighted dict or ItemMap into a picker that can be passed to
+    # pickWeighted() and pickWeightedValue() in place of the dict.
+    def registerWeightedPicker(self, weighted):
+        return WeightedPicker(weighted)
+
     def pickWeighted(self, weighted_dict):
+        if isinstance(weighted_dict, WeightedPicker):
+            return weighted_dict.pick()
+
         total_weight = functools.reduce(lambda total, val: total + val, weighted_dict.values())
         if total_weight <= 0:
             raise TestException("Sum of all weights in weighted-dict incorrect %d" % total_weight)
@@ -701,3 +710,19 @@ class GenThread(object):
 
     def synchronizeWithBarrier(self, kwargs):
         return self.interface.synchronizeWithBarrier(self.genThreadID, kwargs)
+
+    # Independent segment APIs
+    def prepareSegmentFork(self):
+        return self.interface.prepareSegmentFork(self.genThreadID)
+
+    def beginSegment(self, aSeed, aSimTraceFile):
+        self.interface.beginSegment(self.genThreadID, aSeed, aSimTraceFile)
+
+    def endSegment(self, aJournalFile):
+        self.interface.endSegment(self.genThreadID, aJournalFile)
+
+    def importSegment(self, aJournalFile):
+        return self.interface.importSegment(self.genThreadID, aJournalFile)
+
+    def importSegmentState(self, aJournalFile):
+        self.interface.importSegmentState(self.genThreadID, aJournalFile)
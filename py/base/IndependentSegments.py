@@ -0,0 +1,216 @@
+#
+# Copyright (C) [2020] Futurewei Technologies, Inc.
+#
+# FORCE-RISCV is licensed under the Apache License, Version 2.0
+#  (the "License"); you may not use this file except in compliance
+#  with the License.  You may obtain a copy of the License at
+#
+#  http://www.apache.org/licenses/LICENSE-2.0
+#
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES
+# OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+# NON-INFRINGEMENT, MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+#  IndependentSegments class
+#  base class generating independent code segments in parallel
+import os
+import shutil
+import sys
+import tempfile
+import traceback
+
+import Log
+import RandomUtils
+import StateTransition
+from State import State
+
+from base.Sequence import Sequence
+
+
+#  Generates code segments that don't depend on each other concurrently, each
+#  in a forked generator process, and stitches them into the test.
+#
+#  Every segment is generated in its own physical memory region, starting from
+#  the register context at the fork and with a seed drawn from the parent, so
+#  the test only depends on the seed, not on the number of jobs.  Each segment
+#  records the registers it reads before writing them, the registers and memory
+#  it writes and the PC it ends at in a journal.  The parent imports the
+#  journals and, for each segment in order, reloads the GPRs and floating point
+#  registers the segment reads that the segments before it changed, jumps to
+#  its start using a link register reserved in all segments, and takes the
+#  final state of the segment from its journal instead of executing it again.
+#
+#  Only register and memory state the segments share through the context at
+#  the fork is kept consistent, so the segments must not depend on system
+#  registers changed by the segments before them.  Paging is out of scope:
+#  when segments can't be generated in forked processes, e.g. with paging
+#  enabled, or with Parallel=False, they are generated in sequence instead.
+#
+#  Usage:
+#    IndependentSegmentsRISCV(self.genThread).run(
+#        Segments=[SegmentSequence, ...], RegionSize=0x10000, Jobs=8)
+class IndependentSegments(Sequence):
+    def __init__(self, aGenThread, aName=None):
+        super().__init__(aGenThread, aName)
+        self.mRegionSize = 0x10000  # physical memory region size of each segment
+        self.mTailSize = 0x100  # region tail left free for the code following the segment
+        self.mWorkDir = None  # directory holding the journals and logs of the segments
+
+    def generate(self, **kargs):
+        segment_classes = kargs["Segments"]
+        self.mRegionSize = kargs.get("RegionSize", self.mRegionSize)
+        jobs = max(1, kargs.get("Jobs", len(os.sched_getaffinity(0))))
+
+        if not (kargs.get("Parallel", True) and self.genThread.prepareSegmentFork()):
+            for segment_class in segment_classes:
+                segment_class(self.genThread).run()
+            return
+
+        link_gpr_index = self.getRandomGPR(exclude="0")
+        self._initializeRegisterContext(self._getGprName(link_gpr_index))
+        seeds = [RandomUtils.random64() for _ in segment_classes]
+        starts = []
+        for index in range(len(segment_classes)):
+            start = self.genPA(Size=self.mRegionSize, Align=0x1000, Type="I")
+            self.reserveMemoryRange(self._regionName(index), start, self.mRegionSize, 0)
+            starts.append(start)
+
+        self.mWorkDir = tempfile.mkdtemp(prefix="segments_", dir=os.getcwd())
+        self._forkSegments(segment_classes, seeds, starts, link_gpr_index, jobs)
+
+        for (index, start) in enumerate(starts):
+            self.unreserveMemoryRange(self._regionName(index), start, self.mRegionSize, 0)
+
+        live_ins = [
+            self.genThread.importSegment(self._journalPath(index)) for index in range(len(starts))
+        ]
+
+        reload_count = 0
+        for (index, start) in enumerate(starts):
+            reload_count += self._reloadLiveInRegisters(live_ins[index])
+            self._genJump(link_gpr_index, start)
+            self.genThread.importSegmentState(self._journalPath(index))
+
+        shutil.rmtree(self.mWorkDir)
+        Log.notice(
+            "Generated %d independent segments with %d jobs, reloaded %d registers"
+            % (len(starts), jobs, reload_count)
+        )
+
+    # return the names of the registers initialized before the fork
+    def _getRegisterContextNames(self):
+        raise NotImplementedError
+
+    # return the name of the context register holding a physical register, None
+    # if it isn't one
+    def _getContextRegisterName(self, aPhysRegName):
+        raise NotImplementedError
+
+    # return the name of a GPR
+    def _getGprName(self, aGprIndex):
+        raise NotImplementedError
+
+    # generate instructions jumping to the target address using the specified GPR
+    def _genJump(self, aGprIndex, aTarget):
+        raise NotImplementedError
+
+    def _regionName(self, aIndex):
+        return "IndependentSegment%d" % aIndex
+
+    def _journalPath(self, aIndex):
+        return os.path.join(self.mWorkDir, "segment%d.journal" % aIndex)
+
+    def _logPath(self, aIndex):
+        return os.path.join(self.mWorkDir, "segment%d.log" % aIndex)
+
+    # initialize the context registers, so every segment starts from the same values
+    def _initializeRegisterContext(self, aExcludedName):
+        for reg_name in self._getRegisterContextNames():
+            if reg_name != aExcludedName:
+                self.randomInitializeRegister(reg_name)
+
+    # load the values a segment read from the context registers whose values
+    # have changed since the fork, return the number of registers loaded
+    def _reloadLiveInRegisters(self, aLiveIns):
+        state = State()
+        reload_count = 0
+        for (phys_reg_name, live_in_value, live_in_mask) in aLiveIns:
+            reg_name = self._getContextRegisterName(phys_reg_name)
+            if reg_name is None:
+                continue
+
+            (reg_value, valid) = self.readRegister(reg_name)
+            if (reg_value & live_in_mask) == (live_in_value & live_in_mask):
+                continue
+
+            reg_value = (reg_value & ~live_in_mask) | (live_in_value & live_in_mask)
+            state.addRegisterStateElement(reg_name, (reg_value,))
+            reload_count += 1
+
+        if reload_count > 0:
+            StateTransition.transitionToState(state)
+
+        return reload_count
+
+    def _forkSegments(self, aSegmentClasses, aSeeds, aStarts, aLinkGprIndex, aJobs):
+        pending = list(range(len(aSegmentClasses)))
+        running = {}
+        failed = []
+        while pending or running:
+            while pending and (len(running) < aJobs):
+                index = pending.pop(0)
+                sys.stdout.flush()
+                sys.stderr.flush()
+                pid = os.fork()
+                if pid == 0:
+                    self._runSegment(
+                        index, aSegmentClasses[index], aSeeds[index], aStarts, aLinkGprIndex
+                    )
+
+                running[pid] = index
+
+            (pid, status) = os.wait()
+            index = running.pop(pid)
+            if status != 0:
+                failed.append(index)
+
+        if failed:
+            self.error(
+                "Failed to generate independent segments %s, see the logs in %s"
+                % (sorted(failed), self.mWorkDir)
+            )
+
+    # generate a segment in the forked process, never returns
+    def _runSegment(self, aIndex, aSegmentClass, aSeed, aStarts, aLinkGprIndex):
+        exit_code = 1
+        try:
+            log_fd = os.open(self._logPath(aIndex), os.O_WRONLY | os.O_CREAT | os.O_TRUNC, 0o644)
+            os.dup2(log_fd, 1)
+            os.dup2(log_fd, 2)
+            os.close(log_fd)
+
+            sim_trace_path = os.path.join(self.mWorkDir, "segment%d.sim.log" % aIndex)
+            self.genThread.beginSegment(aSeed, sim_trace_path)
+
+            # keep the segment in its own region, leaving the tail free.
+            start = aStarts[aIndex]
+            self.unreserveMemoryRange(self._regionName(aIndex), start, self.mRegionSize, 0)
+            tail_start = start + self.mRegionSize - self.mTailSize
+            outside_ranges = ["0x%x-0xffffffffffffffff" % tail_start]
+            if start > 0:
+                outside_ranges.insert(0, "0x0-0x%x" % (start - 1))
+            self.reserveMemory("IndependentSegmentOutside", ",".join(outside_ranges), 0)
+            self.reserveRegister(self._getGprName(aLinkGprIndex), "ReadWrite")
+
+            self.setPEstate("PC", start)
+            aSegmentClass(self.genThread).run()
+            self.genThread.endSegment(self._journalPath(aIndex))
+            exit_code = 0
+        except BaseException:
+            traceback.print_exc()
+        finally:
+            sys.stdout.flush()
+            sys.stderr.flush()
+            os._exit(exit_code)
@@ -328,6 +328,9 @@ class Sequence(object):
         # Tuple of (is_instr, addr)
         return self.genThread.validAddressMask("ValidAddressMask", addr, is_instr)
 
+    def registerWeightedPicker(self, weighted):
+        return self.genThread.registerWeightedPicker(weighted)
+
     def pickWeighted(self, weighted_dict):
         return self.genThread.pickWeighted(weighted_dict)
 
@@ -0,0 +1,66 @@
+#
+# Copyright (C) [2020] Futurewei Technologies, Inc.
+#
+# FORCE-RISCV is licensed under the Apache License, Version 2.0
+#  (the "License"); you may not use this file except in compliance
+#  with the License.  You may obtain a copy of the License at
+#
+#  http://www.apache.org/licenses/LICENSE-2.0
+#
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES
+# OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+# NON-INFRINGEMENT, MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+import RandomUtils
+
+from base.ItemMap import ItemMap
+from base.Macro import Macro
+from base.TestException import TestException
+
+
+#  A weighted dict or ItemMap compiled once into a native picker, so that each pick
+#  neither sums nor sorts the weights again. Picks follow the same random sequence as
+#  GenThread.pickWeighted() on the dict the picker was compiled from.
+#
+class WeightedPicker(object):
+    def __init__(self, aWeighted):
+        self.mItems = []
+        self.mNativePicker = RandomUtils.WeightedPicker()
+
+        weighted_dict = aWeighted
+        if isinstance(aWeighted, ItemMap):
+            weighted_dict = aWeighted.mItemDict
+
+        self._addNode(weighted_dict)
+
+    def pick(self):
+        return self.mItems[self.mNativePicker.pick()]
+
+    def size(self):
+        return len(self.mItems)
+
+    def _addNode(self, aWeightedDict):
+        total_weight = sum(aWeightedDict.values())
+        if total_weight <= 0:
+            raise TestException("Sum of all weights in weighted-dict incorrect %d" % total_weight)
+
+        node_index = self.mNativePicker.addNode()
+        for item, weight in sorted(aWeightedDict.items()):
+            if weight < 0:
+                raise TestException("Negative weight %d for item %s" % (weight, item))
+
+            if weight == 0:
+                continue
+
+            if isinstance(item, str) or isinstance(item, Macro):
+                self.mNativePicker.addLeaf(node_index, weight, len(self.mItems))
+                self.mItems.append(item)
+            elif isinstance(item, ItemMap):
+                child_index = self._addNode(item.mItemDict)
+                self.mNativePicker.addBranch(node_index, weight, child_index)
+            else:
+                raise TestException("Picked unsupported object.")
+
+        return node_index
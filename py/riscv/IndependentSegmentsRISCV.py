@@ -0,0 +1,48 @@
+#
+# Copyright (C) [2020] Futurewei Technologies, Inc.
+#
+# FORCE-RISCV is licensed under the Apache License, Version 2.0
+#  (the "License"); you may not use this file except in compliance
+#  with the License.  You may obtain a copy of the License at
+#
+#  http://www.apache.org/licenses/LICENSE-2.0
+#
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES
+# OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+# NON-INFRINGEMENT, MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+import re
+
+from base.IndependentSegments import IndependentSegments
+from riscv.Utils import LoadGPR64
+
+
+class IndependentSegmentsRISCV(IndependentSegments):
+    def __init__(self, aGenThread, aName=None):
+        super().__init__(aGenThread, aName)
+
+    def _getRegisterContextNames(self):
+        return ["x%d" % index for index in range(1, 32)] + ["D%d" % index for index in range(32)]
+
+    def _getContextRegisterName(self, aPhysRegName):
+        match = re.fullmatch(r"x([1-9]\d?)|f(\d+)_0", aPhysRegName)
+        if match is None:
+            return None
+
+        if match.group(1) is not None:
+            return "x%s" % match.group(1)
+
+        return "D%s" % match.group(2)
+
+    def _getGprName(self, aGprIndex):
+        return "x%d" % aGprIndex
+
+    def _genJump(self, aGprIndex, aTarget):
+        load_gpr64_seq = LoadGPR64(self.genThread)
+        load_gpr64_seq.load(aGprIndex, aTarget)
+        self.genInstruction(
+            "JALR##RISCV",
+            {"rd": 0, "rs1": aGprIndex, "simm12": 0, "NoRestriction": 1},
+        )
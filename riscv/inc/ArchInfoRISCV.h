@@ -35,6 +35,7 @@ namespace Force {
     const char* DefaultConfigFile() const override { return "config/riscv_rv64.config"; } //!< Return the default config file name.
     PhysicalPageManager* InstantiatePhysicalPageManager(EMemBankType bankType, MemoryTraitsManager* pMemTraitsManager) const override; //!< Instantiate a RISC-V architecture PhysicalPageManager object.
     MemoryTraitsRegistry* InstantiateMemoryTraitsRegistry() const override; //!< Instantiate a RISC-V architecture MemoryTraitsRegistry object.
+    NativeExecutor* InstantiateNativeExecutor() const override; //!< Instantiate a RISC-V architecture NativeExecutor object.
   protected:
     Generator* InstantiateGenerator() const override; //!< Instantiate a RISC-V architecture Generator object.
     VmManager* InstantiateVmManager() const override; //!< Instantiate a RISC-V architecture VmManager object.
@@ -0,0 +1,39 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef Force_NativeExecutorRISCV_H
+#define Force_NativeExecutorRISCV_H
+
+#include "NativeExecutor.h"
+
+namespace Force {
+
+  /*!
+    \class NativeExecutorRISCV
+    \brief Computes the results of the RV32I/RV64I integer register-register, register-immediate, LUI and AUIPC instructions.
+  */
+  class NativeExecutorRISCV : public NativeExecutor {
+  public:
+    NativeExecutorRISCV() : NativeExecutor() { } //!< Default constructor.
+    ~NativeExecutorRISCV() { } //!< Destructor.
+
+    bool Execute(const Generator& rGen, const Instruction& rInstr, std::string& rDestRegName, uint64& rDestValue) const override; //!< Compute the destination register value of the instruction, return false if the instruction can't be executed natively.
+  private:
+    bool ReadSourceRegister(const Generator& rGen, const Instruction& rInstr, const std::string& rOprName, uint64& rValue) const; //!< Read the value of a source register operand, return false if the register isn't initialized.
+  };
+
+}
+
+#endif
@@ -40,6 +40,7 @@ namespace Force {
     const char*       Type()     const override { return "VmasControlBlockRISCV"; }
 
     void Setup(Generator* pGen) override; //!< Setup VM Context Parameters
+    void SetupContextParameters(); //!< Add the VM context parameters of the privilege level.
     void GetAddressErrorRanges(std::vector<TranslationRange>& rRanges) const override; //!< Obtain address error ranges.
     bool InitializeRootPageTable(VmAddressSpace* pVmas, RootPageTable* pRootTable) override; //!< Initialize root page table.
     EMemBankType NextLevelTableMemoryBank(const PageTable* parentTable, const GenPageRequest& rPageReq) const override; //!< Return memory bank of next level table.
@@ -29,6 +29,7 @@
 #include "GeneratorRISCV.h"
 #include "Log.h"
 #include "MemoryTraitsRISCV.h"
+#include "NativeExecutorRISCV.h"
 #include "PageRequestRegulatorRISCV.h"
 #include "PhysicalPageManagerRISCV.h"
 #include "Register.h"
@@ -137,6 +138,11 @@ namespace Force {
     return new AddressTableManagerRISCV();
   }
 
+  NativeExecutor* ArchInfoRISCV::InstantiateNativeExecutor() const
+  {
+    return new NativeExecutorRISCV();
+  }
+
   AddressSolutionFilter* ArchInfoRISCV::InstantiateAddressSolutionFilter(EAddressSolutionFilterType filterType) const
   {
     switch (filterType) {
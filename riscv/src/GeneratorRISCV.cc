@@ -96,6 +96,10 @@ namespace Force {
 
     auto reg = mpRegisterFile->RegisterLookup(name);
     VmManager* vm_mgr = GetVmManager();
+    if (not vm_mgr->IsContextRegister(reg)) {
+      return false; // most register writes, skip building the current regime's register context.
+    }
+
     VmRegime*  vm_regime = vm_mgr->CurrentVmRegime();
 
     auto reg_context = vm_regime->RegisterContext();
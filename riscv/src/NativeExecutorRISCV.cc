@@ -0,0 +1,177 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "NativeExecutorRISCV.h"
+
+#include <map>
+
+#include "Generator.h"
+#include "Instruction.h"
+#include "Operand.h"
+#include "Register.h"
+#include "UtilityFunctions.h"
+
+using namespace std;
+
+/*!
+  \file NativeExecutorRISCV.cc
+  \brief Code computing the results of RISC-V integer ALU instructions on the generator side.
+*/
+
+namespace Force {
+
+  /*!
+    \enum ENativeOperationRISCV
+    \brief Operations modeled by NativeExecutorRISCV.
+  */
+  enum class ENativeOperationRISCV {
+    Add, Sub, And, Or, Xor, Slt, Sltu, Sll, Srl, Sra,
+    Addi, Andi, Ori, Xori, Slti, Sltiu, Slli, Srli, Srai,
+    Lui, Auipc,
+    Addw, Subw, Sllw, Srlw, Sraw, Addiw, Slliw, Srliw, Sraiw,
+  };
+
+  static const map<string, ENativeOperationRISCV> sNativeOperations = {
+    {"ADD", ENativeOperationRISCV::Add}, {"SUB", ENativeOperationRISCV::Sub}, {"AND", ENativeOperationRISCV::And}, {"OR", ENativeOperationRISCV::Or},
+    {"XOR", ENativeOperationRISCV::Xor}, {"SLT", ENativeOperationRISCV::Slt}, {"SLTU", ENativeOperationRISCV::Sltu}, {"SLL", ENativeOperationRISCV::Sll},
+    {"SRL", ENativeOperationRISCV::Srl}, {"SRA", ENativeOperationRISCV::Sra}, {"ADDI", ENativeOperationRISCV::Addi}, {"ANDI", ENativeOperationRISCV::Andi},
+    {"ORI", ENativeOperationRISCV::Ori}, {"XORI", ENativeOperationRISCV::Xori}, {"SLTI", ENativeOperationRISCV::Slti}, {"SLTIU", ENativeOperationRISCV::Sltiu},
+    {"SLLI", ENativeOperationRISCV::Slli}, {"SRLI", ENativeOperationRISCV::Srli}, {"SRAI", ENativeOperationRISCV::Srai}, {"LUI", ENativeOperationRISCV::Lui},
+    {"AUIPC", ENativeOperationRISCV::Auipc}, {"ADDW", ENativeOperationRISCV::Addw}, {"SUBW", ENativeOperationRISCV::Subw}, {"SLLW", ENativeOperationRISCV::Sllw},
+    {"SRLW", ENativeOperationRISCV::Srlw}, {"SRAW", ENativeOperationRISCV::Sraw}, {"ADDIW", ENativeOperationRISCV::Addiw}, {"SLLIW", ENativeOperationRISCV::Slliw},
+    {"SRLIW", ENativeOperationRISCV::Srliw}, {"SRAIW", ENativeOperationRISCV::Sraiw},
+  };
+
+  bool NativeExecutorRISCV::ReadSourceRegister(const Generator& rGen, const Instruction& rInstr, const string& rOprName, uint64& rValue) const
+  {
+    auto src_opr = dynamic_cast<const RegisterOperand*>(rInstr.FindOperand(rOprName, true));
+    if (src_opr->Value() == 0) {
+      rValue = 0; // x0
+      return true;
+    }
+
+    const Register* src_reg = rGen.GetRegisterFile()->RegisterLookup(src_opr->ChoiceText());
+    if (not src_reg->IsInitialized()) {
+      return false;
+    }
+
+    rValue = src_reg->Value();
+    return true;
+  }
+
+  bool NativeExecutorRISCV::Execute(const Generator& rGen, const Instruction& rInstr, string& rDestRegName, uint64& rDestValue) const
+  {
+    auto find_iter = sNativeOperations.find(rInstr.Name());
+    if (find_iter == sNativeOperations.end()) {
+      return false;
+    }
+    ENativeOperationRISCV operation = find_iter->second;
+
+    auto dest_opr = dynamic_cast<const RegisterOperand*>(rInstr.FindOperand("rd", false));
+    if (nullptr == dest_opr) {
+      return false;
+    }
+
+    rDestRegName.clear();
+    if (dest_opr->Value() == 0) {
+      return true; // writes to x0 are discarded.
+    }
+
+    const Register* dest_reg = rGen.GetRegisterFile()->RegisterLookup(dest_opr->ChoiceText());
+    uint32 xlen = dest_reg->Size();
+    uint64 xlen_mask = (xlen == 64) ? MAX_UINT64 : ((1ull << xlen) - 1);
+
+    uint64 rs1 = 0;
+    uint64 rs2 = 0;
+    uint64 imm = 0;
+    switch (operation) {
+    case ENativeOperationRISCV::Lui:
+    case ENativeOperationRISCV::Auipc:
+      imm = sign_extend64(rInstr.FindOperand("simm20", true)->Value() << 12, 32);
+      break;
+    case ENativeOperationRISCV::Addi:
+    case ENativeOperationRISCV::Andi:
+    case ENativeOperationRISCV::Ori:
+    case ENativeOperationRISCV::Xori:
+    case ENativeOperationRISCV::Slti:
+    case ENativeOperationRISCV::Sltiu:
+    case ENativeOperationRISCV::Addiw:
+      imm = sign_extend64(rInstr.FindOperand("simm12", true)->Value(), 12);
+      if (not ReadSourceRegister(rGen, rInstr, "rs1", rs1)) {
+        return false;
+      }
+      break;
+    case ENativeOperationRISCV::Slli:
+    case ENativeOperationRISCV::Srli:
+    case ENativeOperationRISCV::Srai:
+    case ENativeOperationRISCV::Slliw:
+    case ENativeOperationRISCV::Srliw:
+    case ENativeOperationRISCV::Sraiw:
+      imm = rInstr.FindOperand("shamt", true)->Value();
+      if (not ReadSourceRegister(rGen, rInstr, "rs1", rs1)) {
+        return false;
+      }
+      break;
+    default:
+      if ((not ReadSourceRegister(rGen, rInstr, "rs1", rs1)) or (not ReadSourceRegister(rGen, rInstr, "rs2", rs2))) {
+        return false;
+      }
+    }
+
+    // sign extended operands for the signed comparisons and the arithmetic right shifts.
+    int64 signed_rs1 = int64(sign_extend64(rs1 & xlen_mask, xlen));
+    int64 signed_rs2 = int64(sign_extend64(rs2 & xlen_mask, xlen));
+    uint32 shift_mask = xlen - 1;
+
+    uint64 result = 0;
+    switch (operation) {
+    case ENativeOperationRISCV::Add: result = rs1 + rs2; break;
+    case ENativeOperationRISCV::Sub: result = rs1 - rs2; break;
+    case ENativeOperationRISCV::And: result = rs1 & rs2; break;
+    case ENativeOperationRISCV::Or: result = rs1 | rs2; break;
+    case ENativeOperationRISCV::Xor: result = rs1 ^ rs2; break;
+    case ENativeOperationRISCV::Slt: result = (signed_rs1 < signed_rs2) ? 1 : 0; break;
+    case ENativeOperationRISCV::Sltu: result = ((rs1 & xlen_mask) < (rs2 & xlen_mask)) ? 1 : 0; break;
+    case ENativeOperationRISCV::Sll: result = rs1 << (rs2 & shift_mask); break;
+    case ENativeOperationRISCV::Srl: result = (rs1 & xlen_mask) >> (rs2 & shift_mask); break;
+    case ENativeOperationRISCV::Sra: result = uint64(signed_rs1 >> (rs2 & shift_mask)); break;
+    case ENativeOperationRISCV::Addi: result = rs1 + imm; break;
+    case ENativeOperationRISCV::Andi: result = rs1 & imm; break;
+    case ENativeOperationRISCV::Ori: result = rs1 | imm; break;
+    case ENativeOperationRISCV::Xori: result = rs1 ^ imm; break;
+    case ENativeOperationRISCV::Slti: result = (signed_rs1 < int64(imm)) ? 1 : 0; break;
+    case ENativeOperationRISCV::Sltiu: result = ((rs1 & xlen_mask) < (imm & xlen_mask)) ? 1 : 0; break;
+    case ENativeOperationRISCV::Slli: result = rs1 << (imm & shift_mask); break;
+    case ENativeOperationRISCV::Srli: result = (rs1 & xlen_mask) >> (imm & shift_mask); break;
+    case ENativeOperationRISCV::Srai: result = uint64(signed_rs1 >> (imm & shift_mask)); break;
+    case ENativeOperationRISCV::Lui: result = imm; break;
+    case ENativeOperationRISCV::Auipc: result = rGen.PC() + imm; break;
+    case ENativeOperationRISCV::Addw: result = sign_extend64(uint32(rs1 + rs2), 32); break;
+    case ENativeOperationRISCV::Subw: result = sign_extend64(uint32(rs1 - rs2), 32); break;
+    case ENativeOperationRISCV::Sllw: result = sign_extend64(uint32(rs1 << (rs2 & 0x1f)), 32); break;
+    case ENativeOperationRISCV::Srlw: result = sign_extend64(uint32(rs1) >> (rs2 & 0x1f), 32); break;
+    case ENativeOperationRISCV::Sraw: result = uint64(int64(int32(uint32(rs1)) >> (rs2 & 0x1f))); break;
+    case ENativeOperationRISCV::Addiw: result = sign_extend64(uint32(rs1 + imm), 32); break;
+    case ENativeOperationRISCV::Slliw: result = sign_extend64(uint32(rs1 << (imm & 0x1f)), 32); break;
+    case ENativeOperationRISCV::Srliw: result = sign_extend64(uint32(rs1) >> (imm & 0x1f), 32); break;
+    case ENativeOperationRISCV::Sraiw: result = uint64(int64(int32(uint32(rs1)) >> (imm & 0x1f))); break;
+    }
+
+    rDestRegName = dest_opr->ChoiceText();
+    rDestValue = result & xlen_mask;
+    return true;
+  }
+
+}
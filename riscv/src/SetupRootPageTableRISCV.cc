@@ -49,10 +49,17 @@ namespace Force {
     auto reg_ptr = pRegFile->RegisterLookup(regName);
     auto field_ptr = reg_ptr->RegisterFieldLookup("PPN");
 
-    if (!field_ptr->IsInitialized())
+    // the root table the register points to can belong to another address space, allocate a new one for this address space then.
+    bool root_table_used = field_ptr->IsInitialized() and pMemMgr->GetPageTableManager(bankType)->HasRootPageTable(field_ptr->Value() << 12);
+
+    if ((!field_ptr->IsInitialized()) or root_table_used)
     {
       pMemMgr->AllocatePageTableBlock(bankType, tableSize, tableSize, usable, root_addr);
       LOG(debug) << "[SetupRootPageTableRISCV::SetupRootPageTable] initial root-address: 0x" << std::hex << root_addr << std::dec << std::endl;
+      if (root_table_used) {
+        LOG(notice) << "{SetupRootPageTableRISCV::SetupRootPageTable} " << regName << ".PPN root table is used by another address space, new root-address: 0x" << std::hex << root_addr << std::dec << std::endl;
+        return root_addr;
+      }
       pRegFile->InitializeRegisterFieldFullValue(reg_ptr, "PPN", (root_addr >> 12)); //field is just PPN, so 44:0 need to be written ignoring the page offset (should be 0x000 for this case)
       auto reg_ptrX = pRegFile->RegisterLookup(regName);
       auto field_ptrX = reg_ptrX->RegisterFieldLookup("PPN");
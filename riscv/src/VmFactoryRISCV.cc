@@ -172,10 +172,10 @@ namespace Force {
 
   VmContext* VmFactoryRISCV::CreateVmContext() const
   {
-    LOG(fail) << "{VmFactoryRISCV::CreateVmContext} not yet implemented." << endl;
-    FAIL("not-yet-implemented");
-
-    return nullptr;
+    // address spaces are looked up by their context parameters only, so a control block that isn't set up serves as the context.
+    auto vm_context = new VmasControlBlockRISCV(GetPrivilegeLevel(), EMemBankType::Default);
+    vm_context->SetupContextParameters();
+    return vm_context;
   }
 
   void VmFactoryRISCV::CreatePageTableConstraints(std::vector<PageTableConstraint* >& rPageTableConstraints) const
@@ -60,6 +60,11 @@ namespace Force {
     //call base class setup (setup paging choices adapter/generator ptr)
     VmasControlBlock::Setup(pGen);
 
+    SetupContextParameters();
+  }
+
+  void VmasControlBlockRISCV::SetupContextParameters()
+  {
     VmContextParameter*      context_param = nullptr;
     EVmContextParamType      param_type;
     std::vector<std::string> status_param_names; //mstatus, sstatus, ustatus
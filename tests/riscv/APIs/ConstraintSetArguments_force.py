@@ -0,0 +1,86 @@
+#
+# Copyright (C) [2020] Futurewei Technologies, Inc.
+#
+# FORCE-RISCV is licensed under the Apache License, Version 2.0
+#  (the "License"); you may not use this file except in compliance
+#  with the License.  You may obtain a copy of the License at
+#
+#  http://www.apache.org/licenses/LICENSE-2.0
+#
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES
+# OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+# NON-INFRINGEMENT, MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+from riscv.EnvRISCV import EnvRISCV
+from riscv.GenThreadRISCV import GenThreadRISCV
+from base.Sequence import Sequence
+from Constraint import ConstraintSet
+import RandomUtils
+
+
+# This test verifies that ConstraintSet objects and lists of ranges can be
+# passed directly as request argument values.  Generating with the option
+# "StringArguments=1" passes the same constraints as range list strings
+# instead, which should generate the same test.
+class MainSequence(Sequence):
+    def generate(self, **kargs):
+        (string_args, valid) = self.getOption("StringArguments")
+        self.mStringArgs = valid and (string_args != 0)
+
+        region_size = 0x10000
+        region_addr = self.genVA(Size=region_size, Align=0x1000, Type="D")
+
+        # carve out a fragmented set of usable addresses.
+        addr_constr = ConstraintSet(region_addr, region_addr + region_size - 1)
+        addr_ranges = []
+        for index in range(region_size // 0x100):
+            hole_addr = region_addr + index * 0x100 + 0x40
+            addr_constr.subRange(hole_addr, hole_addr + 0x7F)
+            addr_ranges.append((region_addr + index * 0x100, hole_addr - 1))
+            addr_ranges.append((hole_addr + 0x80, region_addr + index * 0x100 + 0xFF))
+
+        for _ in range(RandomUtils.random32(20, 40)):
+            addr = self.genVA(Size=8, Align=8, Type="D", Range=self._arg(addr_constr))
+            self._checkContained(addr, addr_constr)
+
+            addr = self.genVA(Size=8, Align=8, Type="D", Range=self._arg(addr_ranges))
+            self._checkContained(addr, addr_constr)
+
+            instr_rec_id = self.genInstruction(
+                "LD##RISCV",
+                {"LSTarget": self._arg(addr_constr), "rd": self._arg([(5, 7), 10])},
+            )
+            instr_obj = self.queryInstructionRecord(instr_rec_id)
+            self._checkContained(instr_obj["LSTarget"], addr_constr)
+            if instr_obj["Dests"]["rd"] not in (5, 6, 7, 10):
+                self.error(
+                    "Destination register x%d outside of the specified values"
+                    % instr_obj["Dests"]["rd"]
+                )
+
+    # return the argument value, converted to a range list string when requested
+    def _arg(self, aConstraint):
+        if not self.mStringArgs:
+            return aConstraint
+
+        if isinstance(aConstraint, ConstraintSet):
+            return str(aConstraint)
+
+        return ",".join(
+            ("0x%x-0x%x" % item) if isinstance(item, tuple) else ("0x%x" % item)
+            for item in aConstraint
+        )
+
+    def _checkContained(self, aAddr, aAddrConstr):
+        if not aAddrConstr.containsValue(aAddr):
+            self.error(
+                "Address 0x%x was generated outside of the specified range %s"
+                % (aAddr, aAddrConstr)
+            )
+
+
+MainSequenceClass = MainSequence
+GenThreadClass = GenThreadRISCV
+EnvClass = EnvRISCV
@@ -0,0 +1,80 @@
+#
+# Copyright (C) [2020] Futurewei Technologies, Inc.
+#
+# FORCE-RISCV is licensed under the Apache License, Version 2.0
+#  (the "License"); you may not use this file except in compliance
+#  with the License.  You may obtain a copy of the License at
+#
+#  http://www.apache.org/licenses/LICENSE-2.0
+#
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES
+# OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+# NON-INFRINGEMENT, MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# This template generates independent segments of random instructions in
+# parallel and reports the generation time.  With the option "Parallel=0" it
+# generates the same segments in sequence instead, and the option "Jobs" sets
+# the number of segments generated at once.
+import time
+
+from DV.riscv.trees.instruction_tree import (
+    ALU_Int64_map,
+    ALU_Float_Double_map,
+    BranchJump_map,
+    LDST_Int_map,
+)
+from base.Sequence import Sequence
+from riscv.EnvRISCV import EnvRISCV
+from riscv.GenThreadRISCV import GenThreadRISCV
+from riscv.IndependentSegmentsRISCV import IndependentSegmentsRISCV
+
+
+class SegmentSequence(Sequence):
+
+    # instruction maps hash by an empty sortable name, so pick them by name
+    cInstrMaps = {
+        "ALU_Int64": ALU_Int64_map,
+        "LDST_Int": LDST_Int_map,
+        "ALU_Float_Double": ALU_Float_Double_map,
+        "BranchJump": BranchJump_map,
+    }
+
+    def generate(self, **kargs):
+        map_weights = {"ALU_Int64": 10, "LDST_Int": 5, "ALU_Float_Double": 2, "BranchJump": 1}
+        for _ in range(400):
+            instr_map = self.cInstrMaps[self.pickWeighted(map_weights)]
+            self.genInstruction(instr_map.pick(self.genThread))
+
+
+class MainSequence(Sequence):
+    def generate(self, **kargs):
+        (parallel, valid) = self.getOption("Parallel")
+        parallel = (not valid) or (parallel != 0)
+        segment_args = {"Parallel": parallel}
+        (jobs, valid) = self.getOption("Jobs")
+        if valid:
+            segment_args["Jobs"] = jobs
+
+        for _ in range(20):
+            self.genInstruction(ALU_Int64_map.pick(self.genThread))
+
+        segment_count = 16
+        start_time = time.perf_counter()
+        IndependentSegmentsRISCV(self.genThread).run(
+            Segments=[SegmentSequence] * segment_count, RegionSize=0x8000, **segment_args
+        )
+        gen_time = time.perf_counter() - start_time
+        self.notice(
+            "Generated %d independent segments %s in %.3fs"
+            % (segment_count, "in parallel" if parallel else "in sequence", gen_time)
+        )
+
+        for _ in range(20):
+            self.genInstruction(ALU_Int64_map.pick(self.genThread))
+
+
+MainSequenceClass = MainSequence
+GenThreadClass = GenThreadRISCV
+EnvClass = EnvRISCV
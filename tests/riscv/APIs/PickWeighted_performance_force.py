@@ -0,0 +1,64 @@
+#
+# Copyright (C) [2020] Futurewei Technologies, Inc.
+#
+# FORCE-RISCV is licensed under the Apache License, Version 2.0
+#  (the "License"); you may not use this file except in compliance
+#  with the License.  You may obtain a copy of the License at
+#
+#  http://www.apache.org/licenses/LICENSE-2.0
+#
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES
+# OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+# NON-INFRINGEMENT, MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# This template compares the run time of pickWeighted() on a 1000-entry instruction tree
+# when picking from the dict directly and when picking from a registered WeightedPicker.
+import time
+
+from riscv.EnvRISCV import EnvRISCV
+from riscv.GenThreadRISCV import GenThreadRISCV
+from base.InstructionMap import InstructionMap
+from base.Sequence import Sequence
+
+
+class MainSequence(Sequence):
+    def generate(self, **kargs):
+        nested_map = InstructionMap("nested_instructions", {("NESTED_%d" % i): (i % 7) + 1 for i in range(100)})
+        instr_tree = {("INSTR_%d" % i): (i % 13) + 1 for i in range(900)}
+        instr_tree[nested_map] = 100
+
+        leaf_names = set(k for k in instr_tree.keys() if isinstance(k, str))
+        leaf_names.update(nested_map.mItemDict.keys())
+
+        pick_count = 20000
+        start_time = time.perf_counter()
+        for i in range(pick_count):
+            self._checkPicked(self.pickWeighted(instr_tree), leaf_names)
+        dict_time = time.perf_counter() - start_time
+
+        start_time = time.perf_counter()
+        picker = self.registerWeightedPicker(instr_tree)
+        for i in range(pick_count):
+            self._checkPicked(self.pickWeighted(picker), leaf_names)
+        picker_time = time.perf_counter() - start_time
+
+        if picker.size() != len(leaf_names):
+            self.error("Registered picker has %d items, expected %d" % (picker.size(), len(leaf_names)))
+
+        self.notice("%d picks from %d-entry tree: dict %.3fs, registered picker %.3fs" % (pick_count, len(leaf_names), dict_time, picker_time))
+
+    def _checkPicked(self, aPicked, aLeafNames):
+        if aPicked not in aLeafNames:
+            self.error("Picked unexpected item %s" % aPicked)
+
+
+#  Points to the MainSequence defined in this file
+MainSequenceClass = MainSequence
+
+#  Using GenThreadRISCV by default, can be overriden with extended classes
+GenThreadClass = GenThreadRISCV
+
+#  Using EnvRISCV by default, can be overriden with extended classes
+EnvClass = EnvRISCV
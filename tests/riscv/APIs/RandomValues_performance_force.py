@@ -0,0 +1,88 @@
+#
+# Copyright (C) [2020] Futurewei Technologies, Inc.
+#
+# FORCE-RISCV is licensed under the Apache License, Version 2.0
+#  (the "License"); you may not use this file except in compliance
+#  with the License.  You may obtain a copy of the License at
+#
+#  http://www.apache.org/licenses/LICENSE-2.0
+#
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES
+# OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+# NON-INFRINGEMENT, MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# This template compares the run time of drawing 1M random values one call at
+# a time and in bulk, from a range and from a ConstraintSet.
+import time
+
+from riscv.EnvRISCV import EnvRISCV
+from riscv.GenThreadRISCV import GenThreadRISCV
+from base.Sequence import Sequence
+from Constraint import ConstraintSet
+import RandomUtils
+
+
+class MainSequence(Sequence):
+    def generate(self, **kargs):
+        draw_count = 1000000
+        (min_value, max_value) = (0x80000000, 0x8FFFFFFF)
+        addr_constr = ConstraintSet(min_value, max_value)
+        for index in range(0x100):
+            hole_addr = min_value + index * 0x100000
+            addr_constr.subRange(hole_addr, hole_addr + 0x7FFFF)
+
+        start_time = time.perf_counter()
+        for _ in range(draw_count):
+            RandomUtils.random64(min_value, max_value)
+        range_call_time = time.perf_counter() - start_time
+
+        start_time = time.perf_counter()
+        values = RandomUtils.randomValues64(draw_count, min_value, max_value)
+        range_bulk_time = time.perf_counter() - start_time
+        self._checkValues(values, draw_count, lambda value: min_value <= value <= max_value)
+
+        start_time = time.perf_counter()
+        for _ in range(draw_count):
+            addr_constr.chooseValue()
+        constr_call_time = time.perf_counter() - start_time
+
+        start_time = time.perf_counter()
+        values = addr_constr.chooseValues(draw_count)
+        constr_bulk_time = time.perf_counter() - start_time
+        self._checkValues(values, draw_count, addr_constr.containsValue)
+
+        values = addr_constr.chooseValues(draw_count, aAlign=8, aUnique=True)
+        self._checkValues(
+            values, draw_count, lambda value: addr_constr.containsValue(value) and (value % 8 == 0)
+        )
+        if len(set(values)) != draw_count:
+            self.error("Values drawn without replacement are repeated")
+
+        self.notice(
+            "%d random values from a range: per call %.3fs, bulk %.3fs"
+            % (draw_count, range_call_time, range_bulk_time)
+        )
+        self.notice(
+            "%d random values from a ConstraintSet: per call %.3fs, bulk %.3fs"
+            % (draw_count, constr_call_time, constr_bulk_time)
+        )
+
+    def _checkValues(self, aValues, aCount, aCheckFunc):
+        if len(aValues) != aCount:
+            self.error("Drew %d values, expected %d" % (len(aValues), aCount))
+
+        for value in aValues:
+            if not aCheckFunc(value):
+                self.error("Drew unexpected value 0x%x" % value)
+
+
+#  Points to the MainSequence defined in this file
+MainSequenceClass = MainSequence
+
+#  Using GenThreadRISCV by default, can be overriden with extended classes
+GenThreadClass = GenThreadRISCV
+
+#  Using EnvRISCV by default, can be overriden with extended classes
+EnvClass = EnvRISCV
@@ -0,0 +1,44 @@
+#
+# Copyright (C) [2020] Futurewei Technologies, Inc.
+#
+# FORCE-RISCV is licensed under the Apache License, Version 2.0
+#  (the "License"); you may not use this file except in compliance
+#  with the License.  You may obtain a copy of the License at
+#
+#  http://www.apache.org/licenses/LICENSE-2.0
+#
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES
+# OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+# NON-INFRINGEMENT, MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# This template measures the generation rate of unconstrained integer ALU instructions.
+import time
+
+from riscv.EnvRISCV import EnvRISCV
+from riscv.GenThreadRISCV import GenThreadRISCV
+from base.Sequence import Sequence
+
+
+class MainSequence(Sequence):
+    def generate(self, **kargs):
+        instr_count = 3000
+        alu_instrs = ("ADD##RISCV", "SUB##RISCV", "XOR##RISCV", "OR##RISCV", "AND##RISCV", "SLT##RISCV", "ADDI##RISCV", "XORI##RISCV", "ANDI##RISCV", "SLLI#RV64I#RISCV", "LUI##RISCV")
+
+        start_time = time.perf_counter()
+        for _ in range(instr_count):
+            self.genInstruction(self.choice(alu_instrs))
+        gen_time = time.perf_counter() - start_time
+
+        self.notice("Generated %d ALU instructions in %.3fs, %.0f instructions per second" % (instr_count, gen_time, instr_count / gen_time))
+
+
+#  Points to the MainSequence defined in this file
+MainSequenceClass = MainSequence
+
+#  Using GenThreadRISCV by default, can be overriden with extended classes
+GenThreadClass = GenThreadRISCV
+
+#  Using EnvRISCV by default, can be overriden with extended classes
+EnvClass = EnvRISCV
@@ -84,6 +84,14 @@ control_items = [
         "fname": "skip_boot_force.py",
         "generator": {"--options": '"SkipBootCode=1"'},
     },
+    {
+        "fname": "SimpleInstruction_performance_force.py",
+        "generator": {"--options": '"NativeExecutionCheck=1"'},
+    },
+    {
+        "fname": "SimpleInstruction_performance_force.py",
+        "generator": {"--options": '"NativeExecution=1"'},
+    },
     {"fname": "Constraint_force.py"},
     {"fname": "LoadImmediate_force.py"},
     {"fname": "State_force.py"},
@@ -105,4 +113,33 @@ control_items = [
     {"fname": "LoopControlTest_force.py"},
     {"fname": "InitializeRegisterTest_force.py"},
     {"fname": "SetMisaInitialValue_force.py"},
+    {
+        "fname": "IndependentSegments_force.py",
+        "generator": {"--options": '"Jobs=4"', "parity": '--options "Jobs=1"'},
+    },
+    {
+        "fname": "ConstraintSetArguments_force.py",
+        "generator": {"parity": '--options "StringArguments=1"'},
+    },
+    {
+        "fname": "api_genVA_01_force.py",
+        "generator": {"--record-api": "api.record", "parity": "--replay-api ../api.record"},
+    },
+    {
+        "fname": "ChoicesModificationTest_force.py",
+        "generator": {"--record-api": "api.record", "parity": "--replay-api ../api.record"},
+    },
+    {
+        "fname": "LoopControlTest_force.py",
+        "generator": {"--record-api": "api.record", "parity": "--replay-api ../api.record"},
+    },
+    {
+        "fname": "IndependentSegments_force.py",
+        "options": {"max-instr": 50000},
+        "generator": {"--record-api": "api.record", "parity": "--replay-api ../api.record"},
+    },
+    {
+        "fname": "ConstraintSetArguments_force.py",
+        "generator": {"--record-api": "api.record", "parity": "--replay-api ../api.record"},
+    },
 ]
@@ -39,4 +39,19 @@ control_items = [
         },
         "generator": {"--options": '"PrivilegeLevel=1"'},
     },
+    {
+        "fname": "multiprocessing_scheduling_quantum_force.py",
+        "options": {"num-cores": 4},
+        "generator": {"--options": '"SchedulingQuantum=8"'},
+    },
+    {
+        "fname": "multiprocessing_scheduling_quantum_force.py",
+        "options": {
+            "num-chips": 4,
+            "num-cores": 2,
+            "num-threads": 2,
+            "max-instr": 50000,
+        },
+        "generator": {"--options": '"SchedulingQuantum=1000"'},
+    },
 ]
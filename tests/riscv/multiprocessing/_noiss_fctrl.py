@@ -44,4 +44,19 @@ control_items = [
         },
         "generator": {"--options": '"PrivilegeLevel=1"', "--noiss": None},
     },
+    {
+        "fname": "multiprocessing_scheduling_quantum_force.py",
+        "options": {"num-cores": 4},
+        "generator": {"--options": '"SchedulingQuantum=8"', "--noiss": None},
+    },
+    {
+        "fname": "multiprocessing_scheduling_quantum_force.py",
+        "options": {
+            "num-chips": 4,
+            "num-cores": 2,
+            "num-threads": 2,
+            "max-instr": 50000,
+        },
+        "generator": {"--options": '"SchedulingQuantum=1000"', "--noiss": None},
+    },
 ]
@@ -0,0 +1,54 @@
+#
+# Copyright (C) [2020] Futurewei Technologies, Inc.
+#
+# FORCE-RISCV is licensed under the Apache License, Version 2.0
+#  (the "License"); you may not use this file except in compliance
+#  with the License.  You may obtain a copy of the License at
+#
+#  http://www.apache.org/licenses/LICENSE-2.0
+#
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES
+# OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+# NON-INFRINGEMENT, MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# This template measures the per call cost of common ConstraintSet operations.
+# Run it with different hart counts, e.g. "--num-cores 1" and
+# "--num-cores 4", to compare single and multi-hart modes.
+import time
+
+from Constraint import ConstraintSet
+from base.Sequence import Sequence
+from riscv.EnvRISCV import EnvRISCV
+from riscv.GenThreadRISCV import GenThreadRISCV
+
+
+class MainSequence(Sequence):
+    def generate(self, **kargs):
+        call_count = 2000
+        hart_count = self.getThreadNumber()
+        constr_set = ConstraintSet(0x1000, 0x100000)
+
+        operations = (
+            ("addRange", lambda index: constr_set.addRange(index << 12, (index << 12) + 0x7FF)),
+            ("subValue", lambda index: constr_set.subValue((index << 12) + 0x10)),
+            ("containsValue", lambda index: constr_set.containsValue(index << 12)),
+            ("size", lambda index: constr_set.size()),
+            ("lowerBound", lambda index: constr_set.lowerBound()),
+        )
+        for (op_name, op_func) in operations:
+            start_time = time.perf_counter()
+            for index in range(call_count):
+                op_func(index)
+            elapsed_time = time.perf_counter() - start_time
+
+            self.notice(
+                "%d harts: ConstraintSet.%s %.2fus per call"
+                % (hart_count, op_name, elapsed_time * 1e6 / call_count)
+            )
+
+
+MainSequenceClass = MainSequence
+GenThreadClass = GenThreadRISCV
+EnvClass = EnvRISCV
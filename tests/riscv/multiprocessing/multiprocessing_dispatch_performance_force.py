@@ -0,0 +1,44 @@
+#
+# Copyright (C) [2020] Futurewei Technologies, Inc.
+#
+# FORCE-RISCV is licensed under the Apache License, Version 2.0
+#  (the "License"); you may not use this file except in compliance
+#  with the License.  You may obtain a copy of the License at
+#
+#  http://www.apache.org/licenses/LICENSE-2.0
+#
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES
+# OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+# NON-INFRINGEMENT, MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# This template measures the rate of back end API calls while all harts are
+# interleaved by the multi-threading dispatcher. Run it with different hart
+# counts, e.g. "--num-cores 16", to see how the dispatch overhead scales.
+import time
+
+from base.Sequence import Sequence
+from riscv.EnvRISCV import EnvRISCV
+from riscv.GenThreadRISCV import GenThreadRISCV
+
+
+class MainSequence(Sequence):
+    def generate(self, **kargs):
+        call_count = 2000
+        hart_count = self.getThreadNumber()
+
+        start_time = time.perf_counter()
+        for _ in range(call_count):
+            self.isRegisterReserved("x5")
+        elapsed_time = time.perf_counter() - start_time
+
+        self.notice(
+            "%d harts: %d API calls per hart in %.3fs, %.0f API calls per second"
+            % (hart_count, call_count, elapsed_time, hart_count * call_count / elapsed_time)
+        )
+
+
+MainSequenceClass = MainSequence
+GenThreadClass = GenThreadRISCV
+EnvClass = EnvRISCV
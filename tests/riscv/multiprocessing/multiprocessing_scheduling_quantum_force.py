@@ -0,0 +1,75 @@
+#
+# Copyright (C) [2020] Futurewei Technologies, Inc.
+#
+# FORCE-RISCV is licensed under the Apache License, Version 2.0
+#  (the "License"); you may not use this file except in compliance
+#  with the License.  You may obtain a copy of the License at
+#
+#  http://www.apache.org/licenses/LICENSE-2.0
+#
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES
+# OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+# NON-INFRINGEMENT, MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+import RandomUtils
+
+from DV.riscv.trees.instruction_tree import RV_G_map, RV32_G_map
+from base.Sequence import Sequence
+from riscv.EnvRISCV import EnvRISCV
+from riscv.GenThreadRISCV import GenThreadRISCV
+
+
+# This test checks that thread locking and barriers keep working when the
+# scheduling quantum lets a thread run many API calls before the schedule
+# rotates. It is intended to be run with the SchedulingQuantum option set.
+class MainSequence(Sequence):
+    def generate(self, **kargs):
+        thread_num = self.getThreadNumber()
+
+        for round_index in range(3):
+            arrived_name = "Arrived %d" % round_index
+            with self.threadLockingContext():
+                # No other thread may run while the lock is held, however
+                # long the locked section is.
+                arrived = self._getSharedCount(arrived_name)
+                self._genRandomInstructions()
+                if self._getSharedCount(arrived_name) != arrived:
+                    self.error("Shared count changed while the thread lock was held")
+                self.setSharedThreadObject(arrived_name, arrived + 1)
+
+            self._genRandomInstructions()
+            self.synchronizeWithBarrier()
+
+            # Every thread must have arrived before any thread passes the
+            # barrier.
+            arrived = self._getSharedCount(arrived_name)
+            if arrived != thread_num:
+                self.error(
+                    "Passed barrier %d with %d of %d threads arrived"
+                    % (round_index, arrived, thread_num)
+                )
+
+    # Return the value of a shared counter, or 0 if no thread has set it yet.
+    #
+    #  @param aName An identifier for the shared counter.
+    def _getSharedCount(self, aName):
+        if self.hasSharedThreadObject(aName):
+            return self.getSharedThreadObject(aName)
+
+        return 0
+
+    # Generate a random number of a wide variety of instructions.
+    def _genRandomInstructions(self):
+        for _ in range(RandomUtils.random32(0, 10)):
+            if self.getGlobalState("AppRegisterWidth") == 32:
+                instr = RV32_G_map.pick(self.genThread)
+            else:
+                instr = RV_G_map.pick(self.genThread)
+            self.genInstruction(instr)
+
+
+MainSequenceClass = MainSequence
+GenThreadClass = GenThreadRISCV
+EnvClass = EnvRISCV
@@ -88,6 +88,20 @@ control_items = [
             "--options": '"PrivilegeLevel=1,FlatMap=1"',
         },
     },
+    {
+        "fname": "native_execution_page_fault_force.py",
+        "options": {"max-instr": 10000},
+        "generator": {
+            "--options": '"PrivilegeLevel=1,NativeExecution=1"',
+        },
+    },
+    {
+        "fname": "native_execution_page_fault_force.py",
+        "options": {"max-instr": 10000},
+        "generator": {
+            "--options": '"PrivilegeLevel=1,FlatMap=1,NativeExecution=1"',
+        },
+    },
     {
         "fname": "paging_memory_attributes_basic_force.py",
         "options": {"max-instr": 10000},
@@ -165,4 +179,25 @@ control_items = [
     {
         "fname": "page_fault_rv64_fctrl.py",
     },
+    {
+        "fname": "vm_context_lookup_force.py",
+        "options": {"max-instr": 10000},
+        "generator": {
+            "--options": '"PrivilegeLevel=1"',
+        },
+    },
+    {
+        "fname": "vm_context_lookup_force.py",
+        "options": {"max-instr": 10000},
+        "generator": {
+            "--options": '"PrivilegeLevel=1,DescendingOrder=1"',
+        },
+    },
+    {
+        "fname": "superpage_mapping_performance_force.py",
+        "options": {"max-instr": 10000},
+        "generator": {
+            "--options": '"PrivilegeLevel=1,SuperpageMapping=1"',
+        },
+    },
 ]
@@ -0,0 +1,73 @@
+#
+# Copyright (C) [2020] Futurewei Technologies, Inc.
+#
+# FORCE-RISCV is licensed under the Apache License, Version 2.0
+#  (the "License"); you may not use this file except in compliance
+#  with the License.  You may obtain a copy of the License at
+#
+#  http://www.apache.org/licenses/LICENSE-2.0
+#
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES
+# OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+# NON-INFRINGEMENT, MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+from PageFaultSequence import PageFaultSequence
+from riscv.EnvRISCV import EnvRISCV
+from riscv.GenThreadRISCV import GenThreadRISCV
+from riscv.ModifierUtils import PageFaultModifier
+
+
+#  This test branches to pages that fault on instruction fetch and generates
+#  an ALU instruction at the branch target. With the NativeExecution option,
+#  the ALU instruction must still be stepped on the ISS and take the fault
+#  instead of being executed on the generator side.
+class MainSequence(PageFaultSequence):
+    def __init__(self, gen_thread, name=None):
+        super().__init__(gen_thread, name)
+        self._mExceptionCodes = [12]
+
+    def generate(self, **kargs):
+        self.generatePreFaultInstructions()
+
+        # initialize the destination register first, so that the ALU
+        # instruction can be executed natively at a mapped PC.
+        (dest_reg_index,) = self.getRandomGPRsForAccess(1, "Write", exclude="0", no_skip=True)
+        self.genInstruction("ADDI##RISCV", {"rd": dest_reg_index, "rs1": 0})
+
+        page_fault_mod = self.createPageFaultModifier()
+        page_fault_mod.apply(**{"All": 1})
+
+        for _ in range(100):
+            self.genInstruction("JAL##RISCV")
+            if self._hasPageFaultOccurred():
+                self.error(
+                    "The instruction page fault was taken by the branch, not by the "
+                    "ALU instruction at its target."
+                )
+
+            self.genInstruction("ADDI##RISCV", {"rd": dest_reg_index, "rs1": 0})
+            if self._hasPageFaultOccurred():
+                break
+
+        page_fault_mod.revert()
+
+        if not self._hasPageFaultOccurred():
+            self.error("No instruction page fault was taken.")
+
+        for _ in range(5):
+            self.genInstruction("ORI##RISCV", {"rd": 0, "rs1": 0, "simm12": 0})
+
+    # Create an instance of the appropriate page fault modifier.
+    def createPageFaultModifier(self):
+        return PageFaultModifier(self.genThread, self.getGlobalState("AppRegisterWidth"))
+
+    # Return exception codes.
+    def getExceptionCodes(self):
+        return self._mExceptionCodes
+
+
+MainSequenceClass = MainSequence
+GenThreadClass = GenThreadRISCV
+EnvClass = EnvRISCV
@@ -0,0 +1,76 @@
+#
+# Copyright (C) [2020] Futurewei Technologies, Inc.
+#
+# FORCE-RISCV is licensed under the Apache License, Version 2.0
+#  (the "License"); you may not use this file except in compliance
+#  with the License.  You may obtain a copy of the License at
+#
+#  http://www.apache.org/licenses/LICENSE-2.0
+#
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES
+# OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+# NON-INFRINGEMENT, MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# This template measures the time to create VM contexts that share the page
+# tables fully mapping the common physical regions with the first address
+# space.  Run it with --options "PrivilegeLevel=1,MemoryReportInterval=0" and
+# compare the page_tables rows of memory_report.csv with those of a run adding
+# PageTableSharing=1 to the options.  Contexts selects how many contexts
+# are created, from 1 to 3; only three other combinations of MXR and SUM are
+# left at the same satp MODE.
+import time
+
+from riscv.EnvRISCV import EnvRISCV
+from riscv.GenThreadRISCV import GenThreadRISCV
+from base.ChoicesModifier import ChoicesModifier
+from base.Sequence import Sequence
+
+
+class MainSequence(Sequence):
+    def generate(self, **kargs):
+        (sharing, valid) = self.getOption("PageTableSharing")
+        sharing = valid and sharing
+        if sharing:
+            choices_mod = ChoicesModifier(self.genThread)
+            choices_mod.modifyPagingChoices("Page Table Sharing", {"NoSharing": 0, "Sharing": 10})
+            choices_mod.commitSet()
+
+        (context_count, valid) = self.getOption("Contexts")
+        if not valid:
+            context_count = 3
+        if not 1 <= context_count <= 3:
+            self.error("Contexts=%d is not in the range 1 to 3" % context_count)
+
+        for _ in range(20):
+            self.genInstruction("LD##RISCV")
+
+        # the satp MODE is the same, so the contexts can share page tables.
+        context_times = []
+        for (mxr, sum_value) in ((1, 0), (0, 1), (1, 1))[:context_count]:
+            start_time = time.perf_counter()
+            self.genVmContext(MXR=mxr, SUM=sum_value)
+            context_times.append(time.perf_counter() - start_time)
+
+            for _ in range(20):
+                self.genInstruction("LD##RISCV")
+
+        self.notice(
+            "Created %d VM contexts, page table sharing %s: %s"
+            % (
+                len(context_times),
+                "enabled" if sharing else "disabled",
+                ", ".join("%.3fms" % (context_time * 1000) for context_time in context_times),
+            )
+        )
+
+
+#  Points to the MainSequence defined in this file
+MainSequenceClass = MainSequence
+
+#  Using GenThreadRISCV by default, can be overriden with extended classes
+GenThreadClass = GenThreadRISCV
+
+#  Using EnvRISCV by default, can be overriden with extended classes
+EnvClass = EnvRISCV
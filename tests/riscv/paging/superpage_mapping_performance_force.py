@@ -0,0 +1,83 @@
+#
+# Copyright (C) [2020] Futurewei Technologies, Inc.
+#
+# FORCE-RISCV is licensed under the Apache License, Version 2.0
+#  (the "License"); you may not use this file except in compliance
+#  with the License.  You may obtain a copy of the License at
+#
+#  http://www.apache.org/licenses/LICENSE-2.0
+#
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES
+# OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+# NON-INFRINGEMENT, MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# This template measures the time to map a large data region and counts the
+# pages mapping it.  Run it with --options "PrivilegeLevel=1,SuperpageMapping=1"
+# to map the region with superpages, picked by the page size choice weights,
+# and without SuperpageMapping=1 to compare with the default page size mix.
+# RegionSize=<size> changes the region size, 256MB by default.
+import time
+
+from riscv.EnvRISCV import EnvRISCV
+from riscv.GenThreadRISCV import GenThreadRISCV
+from base.ChoicesModifier import ChoicesModifier
+from base.Sequence import Sequence
+
+
+class MainSequence(Sequence):
+    def generate(self, **kargs):
+        (superpage_mapping, valid) = self.getOption("SuperpageMapping")
+        superpage_mapping = valid and superpage_mapping
+        if superpage_mapping:
+            choices_mod = ChoicesModifier(self.genThread)
+            choices_mod.modifyPagingChoices(
+                "Superpage Mapping", {"NoSuperpage": 0, "Superpage": 10}
+            )
+            choices_mod.commitSet()
+
+        (region_size, valid) = self.getOption("RegionSize")
+        if not valid:
+            region_size = 0x10000000
+
+        # align the region to the largest power of 2 it covers, so superpages can map it.
+        region_align = 1 << (region_size.bit_length() - 1)
+        start_time = time.perf_counter()
+        region_va = self.genVA(Size=region_size, Align=region_align, Type="D")
+        map_time = time.perf_counter() - start_time
+
+        page_sizes = {}
+        page_va = region_va
+        while page_va < (region_va + region_size):
+            page_info = self.getPageInfo(page_va, "VA", 0)
+            page_size = page_info["Page"]["Upper"] - page_info["Page"]["Lower"] + 1
+            page_sizes[page_size] = page_sizes.get(page_size, 0) + 1
+            page_va = page_info["Page"]["Upper"] + 1
+
+        self.notice(
+            "Mapped 0x%x bytes at 0x%x, superpage mapping %s: %.3fms, %d pages (%s)"
+            % (
+                region_size,
+                region_va,
+                "enabled" if superpage_mapping else "disabled",
+                map_time * 1000,
+                sum(page_sizes.values()),
+                ", ".join("%d x 0x%x" % (page_sizes[size], size) for size in sorted(page_sizes)),
+            )
+        )
+
+        region_range = "0x%x-0x%x" % (region_va, region_va + region_size - 1)
+        for _ in range(20):
+            target_va = self.genVA(Size=8, Align=8, Type="D", Range=region_range)
+            self.genInstruction("LD##RISCV", {"LSTarget": target_va})
+
+
+#  Points to the MainSequence defined in this file
+MainSequenceClass = MainSequence
+
+#  Using GenThreadRISCV by default, can be overriden with extended classes
+GenThreadClass = GenThreadRISCV
+
+#  Using EnvRISCV by default, can be overriden with extended classes
+EnvClass = EnvRISCV
@@ -0,0 +1,65 @@
+#
+# Copyright (C) [2020] Futurewei Technologies, Inc.
+#
+# FORCE-RISCV is licensed under the Apache License, Version 2.0
+#  (the "License"); you may not use this file except in compliance
+#  with the License.  You may obtain a copy of the License at
+#
+#  http://www.apache.org/licenses/LICENSE-2.0
+#
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES
+# OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+# NON-INFRINGEMENT, MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+from riscv.EnvRISCV import EnvRISCV
+from riscv.GenThreadRISCV import GenThreadRISCV
+from base.Sequence import Sequence
+
+
+# This test creates VM contexts for each combination of the MXR and SUM
+# context parameters and checks that requesting a context again returns the
+# address space created for it.  Run it with --options "PrivilegeLevel=1".
+# The contexts are created in ascending order of their parameters, or in
+# descending order with DescendingOrder=1 added to the options.
+class MainSequence(Sequence):
+
+    # combinations of MXR and SUM, in ascending order
+    cContextParams = ((0, 0), (0, 1), (1, 0), (1, 1))
+
+    def generate(self, **kargs):
+        (descending, valid) = self.getOption("DescendingOrder")
+        context_params = self.cContextParams
+        if valid and descending:
+            context_params = tuple(reversed(context_params))
+
+        current_id = self.getVmCurrentContext()
+
+        context_ids = {}
+        for (mxr, sum_value) in context_params:
+            context_ids[(mxr, sum_value)] = self.genVmContext(MXR=mxr, SUM=sum_value)
+
+            for _ in range(10):
+                self.genInstruction("LD##RISCV")
+
+        if len(set(context_ids.values())) != len(self.cContextParams):
+            self.error("Expected a distinct context ID per context, got %s" % context_ids)
+
+        if current_id not in context_ids.values():
+            self.error("Current context ID %d not returned for its context" % current_id)
+
+        for (mxr, sum_value) in context_params:
+            context_id = self.genVmContext(MXR=mxr, SUM=sum_value)
+            if context_id != context_ids[(mxr, sum_value)]:
+                self.error(
+                    "Context MXR=%d, SUM=%d returned ID %d, expected %d"
+                    % (mxr, sum_value, context_id, context_ids[(mxr, sum_value)])
+                )
+
+        self.notice("Created and looked up VM contexts: %s" % context_ids)
+
+
+MainSequenceClass = MainSequence
+GenThreadClass = GenThreadRISCV
+EnvClass = EnvRISCV
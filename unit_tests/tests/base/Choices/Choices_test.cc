@@ -17,6 +17,8 @@
 
 #include "lest/lest.hpp"
 
+#include "ChoicesFilter.h"
+#include "Constraint.h"
 #include "GenException.h"
 #include "Log.h"
 #include "Random.h"
@@ -106,6 +108,31 @@ CASE( "test case set 1 for Choices module" ) {
 	}
 	delete cyclic_tree; // cloned_tree will be deleted by cyclic_tree
       }
+
+      SECTION( "test filtered choosing without cloning" ) {
+	ConstraintSet filter_constr("1-3");
+	ConstraintChoicesFilter choices_filter(&filter_constr);
+	EXPECT(choices_tree.FilteredWeight(choices_filter) == 10u);
+	EXPECT(choice0->FilteredWeight(choices_filter) == 0u);
+	EXPECT(choice2->FilteredWeight(choices_filter) == 133u);
+
+	ChoiceTree* filtered_tree = dynamic_cast<ChoiceTree* >(choices_tree.Clone());
+	filtered_tree->ApplyFilter(choices_filter);
+	for (uint64 seed = 1; seed <= 20; ++ seed) {
+	  Random::Instance()->Seed(seed);
+	  uint32 filtered_value = choices_tree.ChooseFiltered(choices_filter)->Value();
+	  Random::Instance()->Seed(seed);
+	  EXPECT(filtered_value == filtered_tree->Choose()->Value());
+	  EXPECT((filtered_value >= 1u and filtered_value <= 3u));
+	}
+	delete filtered_tree;
+	EXPECT(choice0->Weight() == 100u);
+
+	ConstraintSet empty_constr("5-6");
+	ConstraintChoicesFilter empty_filter(&empty_constr);
+	EXPECT(choices_tree.FilteredWeight(empty_filter) == 0u);
+	EXPECT_THROWS_AS(choices_tree.ChooseFiltered(empty_filter), ChoicesError);
+      }
     }
 },
 
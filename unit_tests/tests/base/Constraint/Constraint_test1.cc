@@ -15,6 +15,9 @@
 //
 #include "Constraint.h"
 
+#include <algorithm>
+#include <set>
+
 #include "lest/lest.hpp"
 
 #include "GenException.h"
@@ -469,5 +472,32 @@ CASE( "test set 3 for Constraint module" ) {
       ConstraintSet all_values_constr_set(0, MAX_UINT64);
       EXPECT_NO_THROW(all_values_constr_set.ChooseValue());
     }
+
+    SECTION("test choosing multiple values from ConstraintSet") {
+      ConstraintSet my_constr_set("0x1001-0x1020,0x2000,0x3003-0x3009,0x4000-0x4fff");
+      vector<uint64> values;
+      my_constr_set.ChooseValues(1000, 1, false, values);
+      EXPECT(values.size() == 1000u);
+      EXPECT(all_of(values.begin(), values.end(), [&my_constr_set](uint64 value) { return my_constr_set.ContainsValue(value); }));
+
+      my_constr_set.ChooseValues(1000, 8, false, values);
+      EXPECT(values.size() == 1000u);
+      EXPECT(all_of(values.begin(), values.end(), [&my_constr_set](uint64 value) { return my_constr_set.ContainsValue(value) and ((value & 0x7) == 0); }));
+
+      // 0x1008-0x1020, 0x2000, 0x3008 and 0x4000-0x4ff8 hold 4 + 1 + 1 + 0x200 aligned values.
+      my_constr_set.ChooseValues(0x206, 8, true, values);
+      set<uint64> unique_values(values.begin(), values.end());
+      EXPECT(unique_values.size() == 0x206u);
+      EXPECT(unique_values.count(0x3008) == 1u);
+      EXPECT_THROWS(my_constr_set.ChooseValues(0x207, 8, true, values));
+      EXPECT_THROWS_AS(my_constr_set.ChooseValues(1, 0x10000, false, values), ConstraintError);
+    }
+
+    SECTION("test choosing multiple values from ConstraintSet of all values") {
+      ConstraintSet all_values_constr_set(0, MAX_UINT64);
+      vector<uint64> values;
+      EXPECT_NO_THROW(all_values_constr_set.ChooseValues(100, 1, true, values));
+      EXPECT(values.size() == 100u);
+    }
   }
 }
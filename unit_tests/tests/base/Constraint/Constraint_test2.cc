@@ -57,6 +57,25 @@ CASE( "test set 4 for Constraint module" ) {
       EXPECT(my_constr_set.ContainsConstraint(val_constr3) == false);
     }
 
+    SECTION("test ContainingConstraint method") {
+      const Constraint* containing_constr = my_constr_set.ContainingConstraint(0x4000020010, 0x400002ffff);
+      EXPECT(containing_constr != nullptr);
+      EXPECT(containing_constr->LowerBound() == 0x4000020000ULL);
+      EXPECT(containing_constr->UpperBound() == 0x400002ffffULL);
+      containing_constr = my_constr_set.ContainingConstraint(0x4000040000, 0x4000040000);
+      EXPECT(containing_constr != nullptr);
+      EXPECT(containing_constr->LowerBound() == 0x4000040000ULL);
+      EXPECT(my_constr_set.ContainingConstraint(0x400001ffff, 0x400002ffff) == nullptr);
+      EXPECT(my_constr_set.ContainingConstraint(0x400002ffff, 0x4000040000) == nullptr);
+      EXPECT(my_constr_set.ContainingConstraint(0x4000010000, 0x4000010000) == nullptr);
+
+      my_constr_set.SubRange(0x400006fff0, 0x400006fffe);
+      containing_constr = my_constr_set.ContainingConstraint(0x400006ffff, 0x400006ffff);
+      EXPECT(containing_constr != nullptr);
+      EXPECT(containing_constr->Type() == EConstraintType::Value);
+      EXPECT(ConstraintSet().ContainingConstraint(0x0, 0x0) == nullptr);
+    }
+
     SECTION("test ContainsConstraintSet method") {
       ConstraintSet test_set1("0x4000000000-0x4000000020,0x4000001000-0x400000ffff,0x4000020000");
       EXPECT(my_constr_set.ContainsConstraintSet(test_set1) == true);
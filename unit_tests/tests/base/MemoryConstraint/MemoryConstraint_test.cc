@@ -15,6 +15,9 @@
 //
 #include "MemoryConstraint.h"
 
+#include <memory>
+#include <stdexcept>
+
 #include "lest/lest.hpp"
 
 #include "AddressReuseMode.h"
@@ -33,6 +36,53 @@ void enable_all_reuse_types(AddressReuseMode& rAddrReuseMode)
   }
 }
 
+// Compute the applicable data constraint the way it was computed before data access states were
+// tracked: intersect clones of the constraint with the usable, shared and enabled used sets and
+// merge the results.
+void apply_reference_data_constraint(const ConstraintSet& rUsable, const ConstraintSet& rShared, const ConstraintSet& rReadUsed, const ConstraintSet& rWriteUsed, bool reuseReads, bool reuseWrites, ConstraintSet* pConstrSet)
+{
+  ConstraintSet result(*pConstrSet);
+  if (rUsable.IsEmpty()) {
+    result.Clear();
+  }
+  else {
+    result.ApplyConstraintSet(rUsable);
+  }
+
+  std::vector<const ConstraintSet*> reuse_constrs = {&rShared};
+  if (reuseReads) {
+    reuse_constrs.push_back(&rReadUsed);
+  }
+  if (reuseWrites) {
+    reuse_constrs.push_back(&rWriteUsed);
+  }
+
+  for (const ConstraintSet* reuse_constr : reuse_constrs) {
+    if (reuse_constr->IsEmpty()) {
+      continue;
+    }
+
+    ConstraintSet reuse_clone(*pConstrSet);
+    reuse_clone.ApplyConstraintSet(*reuse_constr);
+    result.MergeConstraintSet(reuse_clone);
+  }
+
+  pConstrSet->Clear();
+  pConstrSet->MergeConstraintSet(result);
+}
+
+// Check a range against the usable window and return the result, which must match a search of the
+// whole usable constraint.
+bool usable_contains_range(const MemoryConstraint& rMemConstr, uint64 lower, uint64 upper)
+{
+  bool contains = rMemConstr.UsableContainsRange(lower, upper);
+  if (contains != rMemConstr.Usable()->ContainsRange(lower, upper)) {
+    throw std::logic_error("usable window result differs from usable constraint");
+  }
+
+  return contains;
+}
+
 const lest::test specification[] = {
 
 CASE( "Test initialization" ) {
@@ -495,6 +545,233 @@ CASE( "Test multi-threaded address reuse" ) {
   }
 },
 
+CASE( "Test address reuse against reference used sets" ) {
+
+  SETUP( "Setup MemoryConstraint" )  {
+    cuint32 thread_count = 3;
+    std::unique_ptr<MemoryConstraint> mem_constr(new MultiThreadMemoryConstraint(thread_count));
+    ConstraintSet usable(0x0, 0xffff);
+    mem_constr->Initialize(usable);
+    ConstraintSet shared;
+    std::vector<ConstraintSet> read_used(thread_count);
+    std::vector<ConstraintSet> write_used(thread_count);
+
+    SECTION( "Test chosen addresses match for fixed seeds" ) {
+      for (uint64 seed : {0x12345ull, 0x2468aull, 0xfeedull}) {
+        Random::Instance()->Seed(seed);
+
+        for (uint32 i = 0; i < 400; i++) {
+          uint32 thread_id = Random::Instance()->Random32(0, thread_count - 1);
+          uint64 start = Random::Instance()->Random64(0, 0xfff0);
+          uint64 end = start + Random::Instance()->Random64(0, 0xf);
+
+          switch (Random::Instance()->Random32(0, 5)) {
+          case 0:
+            mem_constr->MarkUsedForType(start, end, EMemDataType::Data, EMemAccessType::Read, thread_id);
+            usable.SubRange(start, end);
+            read_used[thread_id].AddRange(start, end);
+            write_used[thread_id].SubRange(start, end);
+            break;
+          case 1:
+            mem_constr->MarkUsedForType(start, end, EMemDataType::Data, EMemAccessType::Write, thread_id);
+            usable.SubRange(start, end);
+            write_used[thread_id].AddRange(start, end);
+            read_used[thread_id].SubRange(start, end);
+            break;
+          case 2:
+            mem_constr->MarkShared(start, end);
+            shared.AddRange(start, end);
+            usable.SubRange(start, end);
+            break;
+          case 3:
+            mem_constr->UnmarkUsed(start, end);
+            usable.AddRange(start, end);
+            break;
+          default:
+            {
+              const EMemAccessType access_types[] = {EMemAccessType::Read, EMemAccessType::Write, EMemAccessType::ReadWrite};
+              EMemAccessType access_type = access_types[Random::Instance()->Random32(0, 2)];
+              bool is_read = (access_type == EMemAccessType::Read);
+              AddressReuseMode addr_reuse_mode;
+              bool reuse_reads = Random::Instance()->Random32(0, 1);
+              bool reuse_writes = Random::Instance()->Random32(0, 1);
+              if (reuse_reads) {
+                addr_reuse_mode.EnableReuseType(is_read ? EAddressReuseType::ReadAfterRead : EAddressReuseType::WriteAfterRead);
+              }
+              if (reuse_writes) {
+                addr_reuse_mode.EnableReuseType(is_read ? EAddressReuseType::ReadAfterWrite : EAddressReuseType::WriteAfterWrite);
+              }
+
+              ConstraintSet constr_set(start, start + 0x400);
+              ConstraintSet reference_constr_set(constr_set);
+              mem_constr->ApplyToConstraintSet(EMemDataType::Data, access_type, thread_id, addr_reuse_mode, &constr_set);
+              apply_reference_data_constraint(usable, shared, read_used[thread_id], write_used[thread_id], reuse_reads, reuse_writes, &reference_constr_set);
+              EXPECT(constr_set.ToSimpleString() == reference_constr_set.ToSimpleString());
+
+              if (not reference_constr_set.IsEmpty()) {
+                Random::Instance()->Seed(seed + i);
+                uint64 chosen = constr_set.ChooseValue();
+                Random::Instance()->Seed(seed + i);
+                EXPECT(chosen == reference_constr_set.ChooseValue());
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+},
+
+CASE( "Test data address reuse across threads" ) {
+
+  SETUP( "Setup MemoryConstraint" )  {
+    std::unique_ptr<MemoryConstraint> mem_constr(new MultiThreadMemoryConstraint(2));
+    mem_constr->Initialize(ConstraintSet(0x0, 0xffff));
+    // Thread 0 reads 0x1000-0x1fff and thread 1 writes 0x1800-0x27ff; thread 0 then writes 0x1c00-0x1dff.
+    mem_constr->MarkUsedForType(0x1000, 0x1fff, EMemDataType::Data, EMemAccessType::Read, 0);
+    mem_constr->MarkUsedForType(0x1800, 0x27ff, EMemDataType::Data, EMemAccessType::Write, 1);
+    mem_constr->MarkUsedForType(0x1c00, 0x1dff, EMemDataType::Data, EMemAccessType::Write, 0);
+    AddressReuseMode read_reuse_mode;
+    read_reuse_mode.EnableReuseType(EAddressReuseType::ReadAfterRead);
+    AddressReuseMode write_reuse_mode;
+    write_reuse_mode.EnableReuseType(EAddressReuseType::WriteAfterWrite);
+
+    SECTION( "Test read reuse only sees the reads of the same thread" ) {
+      ConstraintSet thread_0_constr_set(0x0, 0x2fff);
+      mem_constr->ApplyToConstraintSet(EMemDataType::Data, EMemAccessType::Read, 0, read_reuse_mode, &thread_0_constr_set);
+      EXPECT(thread_0_constr_set.ToSimpleString() == "0x0-0x1bff,0x1e00-0x1fff,0x2800-0x2fff");
+
+      ConstraintSet thread_1_constr_set(0x0, 0x2fff);
+      mem_constr->ApplyToConstraintSet(EMemDataType::Data, EMemAccessType::Read, 1, read_reuse_mode, &thread_1_constr_set);
+      EXPECT(thread_1_constr_set.ToSimpleString() == "0x0-0xfff,0x2800-0x2fff");
+    }
+
+    SECTION( "Test write reuse only sees the writes of the same thread" ) {
+      ConstraintSet thread_0_constr_set(0x0, 0x2fff);
+      mem_constr->ApplyToConstraintSet(EMemDataType::Data, EMemAccessType::Write, 0, write_reuse_mode, &thread_0_constr_set);
+      EXPECT(thread_0_constr_set.ToSimpleString() == "0x0-0xfff,0x1c00-0x1dff,0x2800-0x2fff");
+
+      ConstraintSet thread_1_constr_set(0x0, 0x2fff);
+      mem_constr->ApplyToConstraintSet(EMemDataType::Data, EMemAccessType::ReadWrite, 1, write_reuse_mode, &thread_1_constr_set);
+      EXPECT(thread_1_constr_set.ToSimpleString() == "0x0-0xfff,0x1800-0x2fff");
+    }
+
+    SECTION( "Test shared addresses are reusable by all threads" ) {
+      mem_constr->MarkShared(0x1a00, 0x1aff);
+      AddressReuseMode no_reuse_mode;
+      for (cuint32 thread_id : {0u, 1u}) {
+        ConstraintSet constr_set(0x1000, 0x1fff);
+        mem_constr->ApplyToConstraintSet(EMemDataType::Data, EMemAccessType::ReadWrite, thread_id, no_reuse_mode, &constr_set);
+        EXPECT(constr_set.ToSimpleString() == "0x1a00-0x1aff");
+      }
+    }
+  }
+},
+
+
+CASE( "Test usable window" ) {
+
+  SETUP( "Setup MemoryConstraint" )  {
+    std::unique_ptr<MemoryConstraint> mem_constr(new SingleThreadMemoryConstraint(0));
+    mem_constr->Initialize(ConstraintSet("0x0-0xfff,0x1000-0x1fff,0x3000-0x3fff"));
+    // The usable window starts as the whole 0x0-0x1fff range.
+    EXPECT(usable_contains_range(*mem_constr, 0x800, 0x1800));
+
+    SECTION( "Test window hit" ) {
+      EXPECT(usable_contains_range(*mem_constr, 0x0, 0x1fff));
+      EXPECT(usable_contains_range(*mem_constr, 0x1234, 0x1234));
+      EXPECT_NOT(usable_contains_range(*mem_constr, 0x1ff0, 0x200f));
+      EXPECT(usable_contains_range(*mem_constr, 0x3000, 0x3fff));
+      EXPECT(usable_contains_range(*mem_constr, 0x1000, 0x1003));
+    }
+
+    SECTION( "Test trimming the head of the window" ) {
+      mem_constr->MarkUsed(0x0, 0x10ff);
+      EXPECT_NOT(usable_contains_range(*mem_constr, 0x1000, 0x1003));
+      EXPECT_NOT(usable_contains_range(*mem_constr, 0x10fc, 0x1103));
+      EXPECT(usable_contains_range(*mem_constr, 0x1100, 0x1fff));
+    }
+
+    SECTION( "Test trimming the tail of the window" ) {
+      mem_constr->MarkUsedForType(0x1f00, 0x3003, EMemDataType::Data, EMemAccessType::Write, 0);
+      EXPECT_NOT(usable_contains_range(*mem_constr, 0x1efc, 0x1f03));
+      EXPECT(usable_contains_range(*mem_constr, 0x0, 0x1eff));
+      EXPECT_NOT(usable_contains_range(*mem_constr, 0x3000, 0x3003));
+    }
+
+    SECTION( "Test trimming the window with shared ranges" ) {
+      mem_constr->MarkShared(ConstraintSet("0x0-0xff,0x1f00-0x1fff"));
+      EXPECT_NOT(usable_contains_range(*mem_constr, 0x0, 0x3));
+      EXPECT_NOT(usable_contains_range(*mem_constr, 0x1f00, 0x1f03));
+      EXPECT(usable_contains_range(*mem_constr, 0x100, 0x1eff));
+    }
+
+    SECTION( "Test removing the middle of the window" ) {
+      mem_constr->MarkUsed(ConstraintSet("0x1800-0x18ff"));
+      EXPECT_NOT(usable_contains_range(*mem_constr, 0x17fc, 0x1803));
+      EXPECT_NOT(usable_contains_range(*mem_constr, 0x1880, 0x1883));
+      EXPECT(usable_contains_range(*mem_constr, 0x0, 0x17ff));
+      EXPECT(usable_contains_range(*mem_constr, 0x1900, 0x1fff));
+    }
+
+    SECTION( "Test removing the whole window" ) {
+      mem_constr->MarkUsed(0x0, 0x2fff);
+      EXPECT_NOT(usable_contains_range(*mem_constr, 0x1000, 0x1003));
+      EXPECT(usable_contains_range(*mem_constr, 0x3000, 0x3003));
+    }
+
+    SECTION( "Test replacing usable ranges in the window" ) {
+      ConstraintSet replace_constr("0x1000-0x13ff");
+      mem_constr->ReplaceUsableInRange(0x1000, 0x1fff, replace_constr);
+      EXPECT_NOT(usable_contains_range(*mem_constr, 0x1400, 0x1403));
+      EXPECT(usable_contains_range(*mem_constr, 0x1000, 0x13ff));
+    }
+
+    SECTION( "Test initializing the usable constraint again" ) {
+      mem_constr->Initialize(ConstraintSet(0x5000, 0x5fff));
+      EXPECT_NOT(usable_contains_range(*mem_constr, 0x1000, 0x1003));
+      EXPECT(usable_contains_range(*mem_constr, 0x5000, 0x5003));
+      mem_constr->Uninitialize();
+      EXPECT_NOT(usable_contains_range(*mem_constr, 0x5000, 0x5003));
+    }
+
+    SECTION( "Test a range spanning two usable ranges" ) {
+      mem_constr->MarkUsed(0x2000, 0x2fff);
+      mem_constr->UnmarkUsed(0x2000, 0x2fff);
+      EXPECT(usable_contains_range(*mem_constr, 0x1ff0, 0x300f));
+      mem_constr->MarkUsed(0x2000, 0x2000);
+      EXPECT_NOT(usable_contains_range(*mem_constr, 0x1ff0, 0x200f));
+      EXPECT(usable_contains_range(*mem_constr, 0x2001, 0x300f));
+    }
+
+    SECTION( "Test the window against the usable constraint for random updates" ) {
+      Random::Instance()->Seed(0x1357);
+      for (uint32 i = 0; i < 2000; i++) {
+        uint64 start = Random::Instance()->Random64(0, 0x3ff0);
+        uint64 end = start + Random::Instance()->Random64(0, 0x3f);
+
+        switch (Random::Instance()->Random32(0, 9)) {
+        case 0:
+          mem_constr->MarkUsed(start, end);
+          break;
+        case 1:
+          mem_constr->MarkShared(start, end);
+          break;
+        case 2:
+          mem_constr->UnmarkUsed(start, end);
+          break;
+        default:
+          {
+            uint64 check_start = Random::Instance()->Random64(0, 0x3ff0);
+            uint64 check_end = check_start + Random::Instance()->Random64(0, 0xf);
+            EXPECT_NO_THROW(usable_contains_range(*mem_constr, check_start, check_end));
+          }
+        }
+      }
+    }
+  }
+},
+
 };
 
 int main(int argc, char * argv[])
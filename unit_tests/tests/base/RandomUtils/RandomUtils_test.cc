@@ -0,0 +1,144 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "RandomUtils.h"
+
+#include <map>
+#include <set>
+
+#include "lest/lest.hpp"
+
+#include "Log.h"
+#include "Random.h"
+
+using namespace std;
+using namespace Force;
+
+using text = std::string;
+
+/*!
+  \class WeightedItem
+  \brief Item with an id and a weight to draw from.
+*/
+class WeightedItem {
+public:
+  WeightedItem(cuint32 id, cuint32 weight) : mId(id), mWeight(weight) { } //!< Constructor.
+  uint32 Id() const { return mId; } //!< Return the item id.
+  uint32 Weight() const { return mWeight; } //!< Return the item weight.
+private:
+  uint32 mId; //!< Item id.
+  uint32 mWeight; //!< Item weight.
+};
+
+const lest::test specification[] = {
+
+CASE( "test case for draw_weighted_item" ) {
+
+  SETUP( "setup item tiers" ) {
+    // preferred tier: item 0 (weight 1), item 1 (weight 3)
+    // other tier: item 2 (weight 10), item 3 (weight 0), item 4 (weight 5)
+    vector<WeightedItem> items = { {0, 1}, {1, 3}, {2, 10}, {3, 0}, {4, 5} };
+    auto make_tiers = [&items]() {
+      return vector<vector<WeightedItem* > > { {&items[0], &items[1]}, {&items[2], &items[3], &items[4]} };
+    };
+
+    SECTION( "test drawing follows the weighted order, preferred tier first" ) {
+      Random::Instance()->Seed(0x1234);
+      vector<uint32> drawn_ids;
+      for (uint32 i = 0; i < 100; ++ i) {
+        auto item_tiers = make_tiers();
+        WeightedItem* accepted = draw_weighted_item(item_tiers, [&drawn_ids](WeightedItem* pItem) { drawn_ids.push_back(pItem->Id()); return false; });
+        EXPECT( accepted == nullptr );
+        EXPECT( item_tiers[0].empty() );
+        EXPECT( item_tiers[1].empty() );
+      }
+
+      EXPECT( drawn_ids.size() == 500u );
+      Random::Instance()->Seed(0x1234);
+      for (uint32 i = 0; i < drawn_ids.size(); i += 5) {
+        // the last item of a tier is taken without a draw, the zero weight item is only taken when it is the last one.
+        uint32 first_id = (random_value32(0, 3) < 1) ? 0 : 1;
+        EXPECT( drawn_ids[i] == first_id );
+        EXPECT( drawn_ids[i + 1] == 1 - first_id );
+
+        uint32 second_id = (random_value32(0, 14) < 10) ? 2 : 4;
+        if (2 == second_id) {
+          random_value32(0, 4);
+        }
+        else {
+          random_value32(0, 9);
+        }
+        EXPECT( drawn_ids[i + 2] == second_id );
+        EXPECT( drawn_ids[i + 3] == 6 - second_id );
+        EXPECT( drawn_ids[i + 4] == 3u );
+      }
+    }
+
+    SECTION( "test drawing stops at the first accepted item" ) {
+      auto item_tiers = make_tiers();
+      set<uint32> drawn_ids;
+      WeightedItem* accepted = draw_weighted_item(item_tiers, [&drawn_ids](WeightedItem* pItem) { drawn_ids.insert(pItem->Id()); return (pItem->Id() == 1); });
+      EXPECT( accepted == &items[1] );
+      EXPECT( drawn_ids.count(1) == 1u );
+      EXPECT( drawn_ids.count(2) == 0u );
+      EXPECT( drawn_ids.count(4) == 0u );
+      EXPECT( item_tiers[1].size() == 3u );
+
+      item_tiers = make_tiers();
+      accepted = draw_weighted_item(item_tiers, [](WeightedItem* pItem) { return (pItem->Id() == 3); });
+      EXPECT( accepted == &items[3] );
+      EXPECT( item_tiers[0].empty() );
+      EXPECT( item_tiers[1].empty() );
+    }
+
+    SECTION( "test accepted items are chosen by weight within the first tier that has any" ) {
+      map<uint32, uint32> accepted_counts;
+      for (uint32 i = 0; i < 6000; ++ i) {
+        auto item_tiers = make_tiers();
+        WeightedItem* accepted = draw_weighted_item(item_tiers, [](WeightedItem* pItem) { return (pItem->Id() != 0); });
+        ++ accepted_counts[accepted->Id()];
+      }
+
+      EXPECT( accepted_counts[1] == 6000u );
+
+      accepted_counts.clear();
+      for (uint32 i = 0; i < 6000; ++ i) {
+        auto item_tiers = make_tiers();
+        WeightedItem* accepted = draw_weighted_item(item_tiers, [](WeightedItem* pItem) { return (pItem->Id() >= 2); });
+        ++ accepted_counts[accepted->Id()];
+      }
+
+      EXPECT( accepted_counts.count(3) == 0u );
+      EXPECT( accepted_counts[2] > 3700u );
+      EXPECT( accepted_counts[2] < 4300u );
+      EXPECT( accepted_counts[4] > 1700u );
+      EXPECT( accepted_counts[4] < 2300u );
+    }
+  }
+},
+
+};
+
+int main( int argc, char * argv[] )
+{
+  Force::Logger::Initialize();
+  Force::Random::Initialize();
+  if (int failures = lest::run( specification, argc, argv )) {
+      return failures;
+  }
+  Force::Random::Destroy();
+  Force::Logger::Destroy();
+  return std::cout << "All tests passed\n", EXIT_SUCCESS;
+}
@@ -18,6 +18,7 @@
 #include "lest/lest.hpp"
 
 #include "Log.h"
+#include "MemoryAccounting.h"
 #include "UtilityFunctions.h"
 
 using text = std::string;
@@ -229,6 +230,40 @@ CASE( "Record with memory access type" ) {
   }
 },
 
+CASE( "Record archive memory accounting" ) {
+
+  SETUP( "Setup code for Record module" )  {
+    RecordArchive record_archive;
+
+    SECTION( "Test AccountMemory() on an empty archive" ) {
+      MemoryUsage usage;
+      record_archive.AccountMemory(usage);
+      EXPECT(usage.mObjects == 0u);
+      EXPECT(usage.mBytes == 0u);
+    }
+
+    SECTION( "Test AccountMemory() counts records until they are swapped out" ) {
+      record_archive.GetMemoryInitRecord(0, 4, 4, EMemDataType::Instruction);
+      record_archive.GetMemoryInitRecord(0, 16, 8, EMemDataType::Data);
+
+      MemoryUsage usage;
+      record_archive.AccountMemory(usage);
+      EXPECT(usage.mObjects == 2u);
+      EXPECT(usage.mBytes >= 2 * sizeof(MemoryInitRecord) + 2 * (4 + 16));
+
+      vector<MemoryInitRecord* > swapped_records;
+      record_archive.SwapMemoryInitRecords(swapped_records);
+      MemoryUsage swapped_usage;
+      record_archive.AccountMemory(swapped_usage);
+      EXPECT(swapped_usage.mObjects == 0u);
+
+      for (auto rec_item : swapped_records) {
+        delete rec_item;
+      }
+    }
+  }
+},
+
 };
 
 int main( int argc, char * argv[] )
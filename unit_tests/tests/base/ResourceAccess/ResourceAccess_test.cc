@@ -589,6 +589,69 @@ CASE( "Test case 5 ResourceAccessQueue class with random constraint lookup" ) {
       // << "queue now: " << my_queue.ToString() << endl;
     }
   }
+},
+
+CASE( "Test case 6 ResourceAccessQueue class checkpoints" ) {
+
+  SETUP( "ResourceAccessQueue test case 6 setup" )  {
+    //-----------------------------------------
+    // include necessary setup code here
+    //-----------------------------------------
+    ResourceAccessQueue my_queue;
+    setup_ResourceAccessQueue(my_queue, 4);
+
+    AccessStageSequence stage_sequence({
+      { {"Read", "GPR", "1"}, {"Read", "GPR", "2"}, {"Write", "GPR", "3"} }, // R3 = R1 + R2
+      { {"Read", "GPR", "4"}, {"Read", "GPR", "5"}, {"Write", "GPR", "6"} }, // R6 = R4 + R5
+      { {"Read", "FPR", "1"}, {"Write", "FPR", "2"} }                        // V2 = V1
+    });
+    stage_sequence.PopulateAccessQueue(my_queue);
+
+    SECTION( "test restoring nested checkpoints" ) {
+      string queue_str = my_queue.ToString();
+      auto gpr_entropy = my_queue.mTypeEntropies[0];
+      uint32 src_entropy = gpr_entropy->SourceEntropy().Entropy();
+      uint32 dest_entropy = gpr_entropy->DestEntropy().Entropy();
+
+      auto outer_checkpoint = my_queue.TakeCheckpoint();
+      AccessStageSequence outer_sequence({
+        { {"Read", "GPR", "1"}, {"Read", "GPR", "6"}, {"Write", "GPR", "2"} }, // R2 = R1 + R6, removes accesses from earlier stages
+        { {"Read", "GPR", "3"}, {"Write", "GPR", "4"} }                        // R4 = R3
+      });
+      outer_sequence.PopulateAccessQueue(my_queue);
+      string outer_str = my_queue.ToString();
+
+      auto inner_checkpoint = my_queue.TakeCheckpoint();
+      AccessStageSequence inner_sequence({
+        { {"Read", "GPR", "2"}, {"Write", "GPR", "1"} }, // R1 = R2
+        { {"Read", "GPR", "4"}, {"Write", "GPR", "5"} }, // R5 = R4
+        { {"Read", "GPR", "5"}, {"Write", "GPR", "6"} }  // R6 = R5
+      });
+      inner_sequence.PopulateAccessQueue(my_queue);
+      EXPECT(my_queue.ToString() != outer_str);
+
+      my_queue.RestoreCheckpoint(inner_checkpoint);
+      EXPECT(my_queue.ToString() == outer_str);
+
+      my_queue.RestoreCheckpoint(outer_checkpoint);
+      EXPECT(my_queue.ToString() == queue_str);
+      EXPECT(my_queue.mCheckpoints.empty());
+      gpr_entropy = my_queue.mTypeEntropies[0];
+      EXPECT(gpr_entropy->SourceEntropy().Entropy() == src_entropy);
+      EXPECT(gpr_entropy->DestEntropy().Entropy() == dest_entropy);
+      EXPECT(my_queue.mTypeAges[0]->GetAccessAge(2).AccessType() == EAccessAgeType::Read);
+      EXPECT(my_queue.mTypeAges[0]->GetAccessAge(6).Age() == 1u);
+
+      // the restored history goes on as if the accesses after the checkpoint never happened.
+      AccessStageSequence next_sequence({ { {"Read", "GPR", "6"}, {"Write", "GPR", "7"} } }); // R7 = R6
+      next_sequence.PopulateAccessQueue(my_queue);
+      ResourceAccessQueue ref_queue;
+      setup_ResourceAccessQueue(ref_queue, 4);
+      stage_sequence.PopulateAccessQueue(ref_queue);
+      next_sequence.PopulateAccessQueue(ref_queue);
+      EXPECT(my_queue.ToString() == ref_queue.ToString());
+    }
+  }
 }
 
 };
@@ -170,7 +170,78 @@ CASE( "test case for ShuffledRoundRobinSchedulingStrategy class" ) {
       EXPECT_FAIL( strategy_ptr->DeactivateThread(locked_thread_id), "inconsistent-thread-scheduler-state");
     }
   }
-}};
+},
+
+CASE( "test case for ShuffledRoundRobinSchedulingStrategy scheduling quantum" ) {
+
+  SETUP( "setup scheduling strategy with a quantum" ) {
+    const uint32 quantum = 3;
+    ShuffledRoundRobinSchedulingStrategy strategy(quantum);
+    const uint32 scheduled_threads_num = 4;
+    for (uint32 i = 0; i < scheduled_threads_num; ++ i) {
+      strategy.AddThreadId(i);
+    }
+    strategy.RefreshSchedule();
+
+    SECTION( "test each thread runs a full quantum per round" ) {
+      ConstraintSet scheduled_threads;
+      for (uint32 i = 0; i < scheduled_threads_num; ++ i) {
+        uint32 t_id = strategy.CurrentThreadId();
+        EXPECT( not scheduled_threads.ContainsValue(t_id) );
+        scheduled_threads.AddValue(t_id);
+        for (uint32 j = 1; j < quantum; ++ j) {
+          strategy.NextThread();
+          EXPECT( strategy.CurrentThreadId() == t_id );
+        }
+        strategy.NextThread();
+      }
+      EXPECT( scheduled_threads.Size() == scheduled_threads_num );
+    }
+
+    SECTION( "test lock holds the thread beyond its quantum" ) {
+      uint32 locked_thread_id = strategy.CurrentThreadId();
+      strategy.LockSchedule(locked_thread_id);
+      for (uint32 i = 0; i < 2 * quantum; ++ i) {
+        strategy.NextThread();
+        EXPECT( strategy.CurrentThreadId() == locked_thread_id );
+      }
+      strategy.UnlockSchedule(locked_thread_id);
+      for (uint32 i = 1; i < quantum; ++ i) {
+        strategy.NextThread();
+        EXPECT( strategy.CurrentThreadId() == locked_thread_id );
+      }
+      strategy.NextThread();
+      EXPECT( strategy.CurrentThreadId() != locked_thread_id );
+    }
+
+    SECTION( "test deactivated thread gives up its quantum" ) {
+      uint32 deactivate_thread_id = strategy.CurrentThreadId();
+      strategy.DeactivateThread(deactivate_thread_id);
+      strategy.NextThread();
+      EXPECT( strategy.CurrentThreadId() != deactivate_thread_id );
+
+      ConstraintSet scheduled_threads;
+      for (uint32 i = 0; i < 4 * quantum * scheduled_threads_num; ++ i) {
+        strategy.NextThread();
+        scheduled_threads.AddValue(strategy.CurrentThreadId());
+      }
+      EXPECT( scheduled_threads.ContainsValue(deactivate_thread_id) == false );
+    }
+
+    SECTION( "test removed thread gives up its quantum" ) {
+      uint32 removed_thread_id = strategy.CurrentThreadId();
+      strategy.RemoveThreadId(removed_thread_id);
+      strategy.NextThread();
+      EXPECT( strategy.CurrentThreadId() != removed_thread_id );
+    }
+  }
+},
+
+CASE( "test case for invalid ShuffledRoundRobinSchedulingStrategy scheduling quantum" ) {
+  EXPECT_FAIL( ShuffledRoundRobinSchedulingStrategy strategy(0), "invalid-scheduling-quantum" );
+},
+
+};
 
 int main( int argc, char * argv[] )
 {
@@ -0,0 +1,110 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "VmContextParameter.h"
+
+#include "lest/lest.hpp"
+
+#include "Generator.h"
+#include "Log.h"
+
+using text = std::string;
+using namespace std;
+using namespace Force;
+
+namespace Force {
+
+  // VmContextParameter only uses the generator to read and initialize register fields, which the tests below don't do.
+  uint64 Generator::GetRegisterFieldValue(const std::string& regName, const std::string& fieldName)
+  {
+    return 0;
+  }
+
+  uint64 Generator::RegisterFieldReloadValue(const std::string& regName, const std::string& fieldName) const
+  {
+    return 0;
+  }
+
+  bool Generator::ReadRegister(const std::string& name, const std::string& field, uint64& reg_value) const
+  {
+    return false;
+  }
+
+}
+
+// Return a VmContext with MXR and SUM parameters of the given values.
+static VmContext* create_vm_context(uint64 mxr, uint64 sum)
+{
+  VmContext* vm_context = new VmContext();
+
+  VmContextParameter* mxr_param = new VmContextParameter(EVmContextParamType::MXR, "mstatus", "MXR");
+  mxr_param->SetValue(mxr);
+  vm_context->AddParameter(mxr_param);
+
+  VmContextParameter* sum_param = new VmContextParameter(EVmContextParamType::SUM, "mstatus", "SUM");
+  sum_param->SetValue(sum);
+  vm_context->AddParameter(sum_param);
+
+  return vm_context;
+}
+
+const lest::test specification[] = {
+
+CASE( "VmContext ordering" ) {
+
+    SETUP( "contexts with MXR and SUM parameters" )  {
+      vector<VmContext*> vm_contexts;
+      for (uint64 mxr = 0; mxr < 2; ++ mxr) {
+        for (uint64 sum = 0; sum < 2; ++ sum) {
+          vm_contexts.push_back(create_vm_context(mxr, sum));
+        }
+      }
+
+      SECTION( "contexts are ordered by their first differing parameter" ) {
+        for (uint32 i = 0; i < vm_contexts.size(); ++ i) {
+          for (uint32 j = 0; j < vm_contexts.size(); ++ j) {
+            EXPECT( (*vm_contexts[i] < *vm_contexts[j]) == (i < j) );
+          }
+        }
+      }
+
+      SECTION( "a context differing in two parameters is not less in both directions" ) {
+        VmContext* mxr0_sum1 = vm_contexts[1];
+        VmContext* mxr1_sum0 = vm_contexts[2];
+        EXPECT( *mxr0_sum1 < *mxr1_sum0 );
+        EXPECT_NOT( *mxr1_sum0 < *mxr0_sum1 );
+      }
+
+      SECTION( "a context is not less than a matching context" ) {
+        VmContext* vm_context = create_vm_context(1, 0);
+        EXPECT( vm_context->Matches(*vm_contexts[2]) );
+        EXPECT_NOT( *vm_context < *vm_contexts[2] );
+        EXPECT_NOT( *vm_contexts[2] < *vm_context );
+        delete vm_context;
+      }
+
+      for (auto vm_context : vm_contexts) {
+        delete vm_context;
+      }
+    }
+}};
+
+int main( int argc, char * argv[] )
+{
+    Force::Logger::Initialize();
+    int ret = lest::run( specification, argc, argv );
+    Force::Logger::Destroy();
+    return ret;
+}
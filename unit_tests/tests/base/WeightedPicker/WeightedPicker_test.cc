@@ -0,0 +1,96 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "WeightedPicker.h"
+
+#include <map>
+
+#include "lest/lest.hpp"
+
+#include "Log.h"
+#include "Random.h"
+
+using namespace std;
+using namespace Force;
+
+using text = std::string;
+
+const lest::test specification[] = {
+
+CASE( "test case for WeightedPicker class" ) {
+
+  SETUP( "setup weighted picker" ) {
+    // root: leaf 0 (weight 10), nested node (weight 30), leaf 1 (weight 0), leaf 2 (weight 60)
+    // nested node: leaf 3 (weight 1), leaf 4 (weight 3)
+    WeightedPicker picker;
+    uint32 root_index = picker.AddNode();
+    uint32 nested_index = picker.AddNode();
+    picker.AddLeaf(root_index, 10, 0);
+    picker.AddBranch(root_index, 30, nested_index);
+    picker.AddLeaf(root_index, 0, 1);
+    picker.AddLeaf(root_index, 60, 2);
+    picker.AddLeaf(nested_index, 1, 3);
+    picker.AddLeaf(nested_index, 3, 4);
+
+    SECTION( "test picking follows the linear weighted scan" ) {
+      Random::Instance()->Seed(0x1234);
+      vector<uint32> picked_leaves;
+      for (uint32 i = 0; i < 1000; ++ i) {
+        picked_leaves.push_back(picker.Pick());
+      }
+
+      Random::Instance()->Seed(0x1234);
+      for (uint32 picked_leaf : picked_leaves) {
+        uint64 picked_value = Random::Instance()->Random64(0, 99);
+        uint32 expected_leaf = 2;
+        if (picked_value < 10) {
+          expected_leaf = 0;
+        }
+        else if (picked_value < 40) {
+          expected_leaf = (Random::Instance()->Random64(0, 3) < 1) ? 3 : 4;
+        }
+        EXPECT( picked_leaf == expected_leaf );
+      }
+    }
+
+    SECTION( "test picking weights" ) {
+      map<uint32, uint32> leaf_counts;
+      for (uint32 i = 0; i < 10000; ++ i) {
+        ++ leaf_counts[picker.Pick()];
+      }
+
+      EXPECT( leaf_counts.count(1) == 0u );
+      EXPECT( leaf_counts[0] > 800u );
+      EXPECT( leaf_counts[0] < 1200u );
+      EXPECT( leaf_counts[2] > 5700u );
+      EXPECT( leaf_counts[2] < 6300u );
+      EXPECT( leaf_counts[4] > leaf_counts[3] );
+    }
+  }
+},
+
+};
+
+int main( int argc, char * argv[] )
+{
+  Force::Logger::Initialize();
+  Force::Random::Initialize();
+  if (int failures = lest::run( specification, argc, argv )) {
+      return failures;
+  }
+  Force::Random::Destroy();
+  Force::Logger::Destroy();
+  return std::cout << "All tests passed\n", EXIT_SUCCESS;
+}
@@ -0,0 +1,135 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "CoverageCounts.h"
+
+#include <sstream>
+
+#include "lest/lest.hpp"
+
+#include "Log.h"
+
+using text = std::string;
+using namespace Force;
+
+const lest::test specification[] = {
+
+CASE( "tests for CoverageCounts opcode classes" ) {
+
+  SETUP ( "setup CoverageCounts" )  {
+
+    SECTION( "test opcode class decoding" ) {
+      EXPECT(text(CoverageCounts::OpcodeClass(0x00100093)) == "OP-IMM"); // addi x1, x0, 1
+      EXPECT(text(CoverageCounts::OpcodeClass(0x0000a103)) == "LOAD"); // lw x2, 0(x1)
+      EXPECT(text(CoverageCounts::OpcodeClass(0x30200073)) == "SYSTEM"); // mret
+      EXPECT(text(CoverageCounts::OpcodeClass(0x0505)) == "C1"); // c.addi x10, 1
+      EXPECT(text(CoverageCounts::OpcodeClass(0x0000)) == "UNKNOWN");
+      EXPECT(text(CoverageCounts::OpcodeClass(0x0000007f)) == "UNKNOWN");
+    }
+  }
+},
+
+CASE( "tests for CoverageCounts instruction counters" ) {
+
+  SETUP ( "setup CoverageCounts" )  {
+    CoverageCounts counts;
+    counts.RecordInstruction(0, 0x00100093, "addi    x1, x0, 1");
+    counts.RecordInstruction(0, 0x00100093, "addi    x1, x0, 1");
+    counts.RecordInstruction(0, 0x30009073, "csrrw   x0, mstatus, x1");
+    counts.RecordInstruction(0, 0x341022f3, "csrrs   x5, mepc, x0");
+    counts.RecordInstruction(0, 0x10017373, "csrrci  x6, sstatus, 2");
+    counts.RecordInstruction(0, 0x30200073, "mret");
+    counts.RecordInstruction(1, 0x0505, "c.addi  x10, 1");
+
+    SECTION( "test step, opcode class and mnemonic counts" ) {
+      EXPECT(counts.Count(ECoverageCategory::Steps, 0, "total") == 6u);
+      EXPECT(counts.Count(ECoverageCategory::Steps, 1, "total") == 1u);
+      EXPECT(counts.Count(ECoverageCategory::OpcodeClass, 0, "OP-IMM") == 2u);
+      EXPECT(counts.Count(ECoverageCategory::OpcodeClass, 0, "SYSTEM") == 4u);
+      EXPECT(counts.Count(ECoverageCategory::OpcodeClass, 1, "C1") == 1u);
+      EXPECT(counts.Count(ECoverageCategory::OpcodeClass, 1, "OP-IMM") == 0u);
+      EXPECT(counts.Count(ECoverageCategory::Mnemonic, 0, "addi") == 2u);
+      EXPECT(counts.Count(ECoverageCategory::Mnemonic, 0, "mret") == 1u);
+      EXPECT(counts.Count(ECoverageCategory::Mnemonic, 1, "c.addi") == 1u);
+      EXPECT(counts.Count(ECoverageCategory::Mnemonic, 2, "c.addi") == 0u);
+    }
+
+    SECTION( "test CSR read and write counts" ) {
+      EXPECT(counts.Count(ECoverageCategory::CsrRead, 0, "0x300") == 0u);
+      EXPECT(counts.Count(ECoverageCategory::CsrWrite, 0, "0x300") == 1u);
+      EXPECT(counts.Count(ECoverageCategory::CsrRead, 0, "0x341") == 1u);
+      EXPECT(counts.Count(ECoverageCategory::CsrWrite, 0, "0x341") == 0u);
+      EXPECT(counts.Count(ECoverageCategory::CsrRead, 0, "0x100") == 1u);
+      EXPECT(counts.Count(ECoverageCategory::CsrWrite, 0, "0x100") == 1u);
+      EXPECT(counts.Count(ECoverageCategory::CsrRead, 0, "0x302") == 0u);
+      EXPECT(counts.Count(ECoverageCategory::CsrWrite, 0, "0x302") == 0u);
+    }
+  }
+},
+
+CASE( "tests for CoverageCounts update counters" ) {
+
+  SETUP ( "setup CoverageCounts" )  {
+    CoverageCounts counts;
+    counts.RecordRegisterWrite(0, "x1");
+    counts.RecordRegisterWrite(0, "x1");
+    counts.RecordRegisterWrite(0, "mepc");
+    counts.RecordException(0, 8, "enter_m");
+    counts.RecordException(0, 0x4e, "exit_mret");
+    counts.RecordPrivilege(0, 3);
+    counts.RecordPrivilege(0, 1);
+    counts.RecordPrivilege(0, 1);
+    counts.RecordPrivilege(0, 3);
+    counts.RecordPrivilege(0, 0);
+
+    SECTION( "test register write and exception counts" ) {
+      EXPECT(counts.Count(ECoverageCategory::RegisterWrite, 0, "x1") == 2u);
+      EXPECT(counts.Count(ECoverageCategory::RegisterWrite, 0, "mepc") == 1u);
+      EXPECT(counts.Count(ECoverageCategory::Exception, 0, "enter_m:8") == 1u);
+      EXPECT(counts.Count(ECoverageCategory::Exception, 0, "exit_mret:78") == 1u);
+    }
+
+    SECTION( "test privilege transition counts" ) {
+      EXPECT(counts.Count(ECoverageCategory::Privilege, 0, "M->M") == 0u);
+      EXPECT(counts.Count(ECoverageCategory::Privilege, 0, "M->S") == 1u);
+      EXPECT(counts.Count(ECoverageCategory::Privilege, 0, "S->S") == 0u);
+      EXPECT(counts.Count(ECoverageCategory::Privilege, 0, "S->M") == 1u);
+      EXPECT(counts.Count(ECoverageCategory::Privilege, 0, "M->U") == 1u);
+    }
+
+    SECTION( "test summary output" ) {
+      std::ostringstream summary;
+      counts.WriteSummary(summary);
+      EXPECT(summary.str() == "Category, CpuID, Name, Count\n"
+                              "register_write, 0, mepc, 1\n"
+                              "register_write, 0, x1, 2\n"
+                              "exception, 0, enter_m:8, 1\n"
+                              "exception, 0, exit_mret:78, 1\n"
+                              "privilege, 0, M->S, 1\n"
+                              "privilege, 0, M->U, 1\n"
+                              "privilege, 0, S->M, 1\n");
+    }
+  }
+},
+
+};
+
+int main(int argc, char* argv[])
+{
+  Logger::Initialize();
+  int ret = lest::run(specification, argc, argv);
+  Logger::Destroy();
+  return ret;
+}
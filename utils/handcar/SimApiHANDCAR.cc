@@ -477,6 +477,14 @@ namespace Force {
     mExceptionUpdates.push_back(ExceptionUpdate(pException->mExceptionID, pException->mExceptionAttributes, pException->mpComments));
   }
   
+  void SimApiHANDCAR::SetRegisterReadUpdates(bool enable)
+  {
+    // Simulator builds without this entry point always report register reads.
+    if (mpSimDllAPI->set_register_read_updates != nullptr) {
+      mpSimDllAPI->set_register_read_updates(enable ? 1 : 0);
+    }
+  }
+
   void SimApiHANDCAR::WakeUp(uint32 cpuId)
   {
   }
@@ -40,7 +40,7 @@ namespace Force {
     void Terminate() override;
 
     //!< obtain the opcode and dissassembly that corresponds to a given PC address
-    void GetDisassembly(uint32 CpuID, const uint64_t* pPc, std::string& rOpcode, std::string& rDisassembly);
+    void GetDisassembly(uint32 CpuID, const uint64_t* pPc, std::string& rOpcode, std::string& rDisassembly) override;
 
     //!< write simulator physical memory. Return 0 if no errors...
     void WritePhysicalMemory(uint32 memBank, uint64 address, uint32  size, const unsigned char *pBytes) override;
@@ -63,6 +63,7 @@ namespace Force {
     void EnterSpeculativeMode(uint32 cpuId) override; //!< The CPU thread enters speculative mode.
     void LeaveSpeculativeMode(uint32 cpuId) override; //!< The CPU thread leaves speculative mode.
     void RecordExceptionUpdate(const SimException *pException) override; //!< Record exception update.
+    void SetRegisterReadUpdates(bool enable) override; //!< Choose whether register reads are reported in step updates.
 
     ASSIGNMENT_OPERATOR_ABSENT(SimApiHANDCAR);
     COPY_CONSTRUCTOR_ABSENT(SimApiHANDCAR);
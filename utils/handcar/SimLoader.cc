@@ -96,6 +96,11 @@ int open_sim_dll(const char *sim_dll_path,struct SimDllApi *api_ptrs) {
    if ( CheckSimOp("inject_simulator_events") )
      return -1;
 
+   //!< optional simulator functions; older simulator builds may not provide these...
+   (*api_ptrs).set_register_read_updates = (void (*)(int)) dlsym(my_sim_lib, "set_register_read_updates");
+   if ((*api_ptrs).set_register_read_updates == NULL)
+     dlerror(); // clear the error, the simulator keeps reporting register reads
+
    //!< other simulator functions T
 
    return 0;
@@ -39,10 +39,12 @@ struct SimDllApi {
   int  (*write_simulator_register)( uint32_t target_id, const char* registerName, uint64_t value, uint64_t mask);
   int  (*step_simulator)(int target_id, int num_steps, int stx_failed);
   bool (*inject_simulator_events)(uint32_t, uint32_t);
+  void (*set_register_read_updates)(int enable); //!< optional, NULL if the simulator always reports register reads
 
   SimDllApi() : sim_lib(NULL),initialize_simulator(NULL),terminate_simulator(NULL),
        get_simulator_version(NULL),get_disassembly(NULL),get_disassembly_for_target(NULL),read_simulator_memory(NULL),write_simulator_memory(NULL),
-       read_simulator_register(NULL),partial_read_large_register(NULL),partial_write_large_register(NULL),write_simulator_register(NULL), step_simulator(NULL), inject_simulator_events(NULL) {};
+       read_simulator_register(NULL),partial_read_large_register(NULL),partial_write_large_register(NULL),write_simulator_register(NULL), step_simulator(NULL), inject_simulator_events(NULL),
+       set_register_read_updates(NULL) {};
 
   
   // other simulator functions as they become available...
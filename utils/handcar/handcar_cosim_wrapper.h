@@ -88,6 +88,19 @@ void terminate_simulator();
 //
 int simulator_load_elf(int target_id, const char* elf_path);
 
+// reset_simulator function: return the simulator to its power-on state without rebuilding it
+//
+// notes:
+//     The memory model is emptied and every hart is reset. The options the simulator was initialized with are kept, so a new
+//     test can be loaded with simulator_load_elf and run as if the simulator had just been initialized. This avoids parsing the
+//     options and constructing the simulated system again between tests.
+//
+// returns:
+//     0 means success,
+//     1 means the simulator was not initialized
+//
+int reset_simulator();
+
 // For development purposes only, will only dump sparse memory in the future when the dense model is no longer required for reference.
 //
 //
@@ -106,6 +119,16 @@ void dump_memory(const char* file_to_create);
 //
 int step_simulator(int target_id, int num_steps, int stx_failed);
 
+// set_register_read_updates function: choose whether register reads are reported through the update_generator_register callback
+//
+// notes:
+//     Register read updates are off by default; register write updates are always reported. May be called before or after initialize_simulator.
+//
+// inputs:
+//     int enable -- nonzero to report register reads, zero to suppress them
+//
+void set_register_read_updates(int enable);
+
 // get_disassembly function: for the given pc address, populates the information in the preallocated opcode and disassemby string buffers.
 //
 // warning: 
@@ -267,6 +290,50 @@ bool inject_simulator_events(uint32_t cpuid, uint32_t events){return false;} //!
 //
 int translate_virtual_address(int target_id, const uint64_t* vaddr, int intent, uint64_t* paddr, uint64_t* memattrs);
 
+// Simulator instances
+//
+// The functions above all drive one default simulated system. Any number of further, fully isolated systems can be created with
+// create_simulator_instance and driven through the *_for_instance functions below, which behave like their counterparts above
+// but act on the given instance. Different instances may be driven from different threads at the same time; calls on one
+// instance must not overlap.
+//
+// The update callbacks (update_generator_register and so on) are shared by all instances. While a callback runs,
+// current_simulator_instance returns the instance that made it.
+typedef struct handcar_instance handcar_instance_t;
+
+// create_simulator_instance function: allocate a new, uninitialized simulator instance
+//
+// returns:
+//      handle of the new instance, to be released with destroy_simulator_instance
+handcar_instance_t* create_simulator_instance();
+
+// destroy_simulator_instance function: terminate the instance if needed and release it, the handle is invalid afterwards
+void destroy_simulator_instance(handcar_instance_t* instance);
+
+// current_simulator_instance function: the instance whose API call is running on the calling thread, the default instance for
+// the functions without a handle, NULL outside of an API call
+handcar_instance_t* current_simulator_instance();
+
+int set_simulator_parameter_for_instance(handcar_instance_t* instance, const char* name, const uint64_t* value, const char* path);
+void initialize_simulator_for_instance(handcar_instance_t* instance, const char* options);
+void terminate_simulator_for_instance(handcar_instance_t* instance);
+int simulator_load_elf_for_instance(handcar_instance_t* instance, int target_id, const char* elf_path);
+int reset_simulator_for_instance(handcar_instance_t* instance);
+void dump_memory_for_instance(handcar_instance_t* instance, const char* file_to_create);
+int step_simulator_for_instance(handcar_instance_t* instance, int target_id, int num_steps, int stx_failed);
+void set_register_read_updates_for_instance(handcar_instance_t* instance, int enable);
+int get_disassembly_for_instance(handcar_instance_t* instance, int target_id, const uint64_t* pPc, char** pOpcode, char** pDisassembly);
+int read_simulator_memory_for_instance(handcar_instance_t* instance, int target_id, const uint64_t* addr, int length, uint8_t* data);
+int write_simulator_memory_for_instance(handcar_instance_t* instance, int target_id, const uint64_t* addr, int length, const uint8_t* data);
+int initialize_simulator_memory_for_instance(handcar_instance_t* instance, int target_id, const uint64_t* addr, int length, uint64_t data);
+int read_simulator_register_for_instance(handcar_instance_t* instance, int target_id, const char* pRegName, uint8_t* value, int length);
+int partial_read_large_register_for_instance(handcar_instance_t* instance, int target_id, const char* pRegName, uint8_t* pValue, uint32_t length, uint32_t offset);
+int partial_write_large_register_for_instance(handcar_instance_t* instance, int target_id, const char* pRegName, const uint8_t* pValue, uint32_t length, uint32_t offset);
+int read_simulator_register_fpix_for_instance(handcar_instance_t* instance, uint32_t target_id, const char* registerName, uint64_t* value, uint64_t* mask);
+int write_simulator_register_for_instance(handcar_instance_t* instance, int target_id, const char* pRegName, const uint8_t* data, int length);
+int write_simulator_register_fpix_for_instance(handcar_instance_t* instance, uint32_t target_id, const char* registerName, uint64_t value, uint64_t mask);
+int translate_virtual_address_for_instance(handcar_instance_t* instance, int target_id, const uint64_t* vaddr, int intent, uint64_t* paddr, uint64_t* memattrs);
+
 #ifdef __cplusplus
 };
 #endif
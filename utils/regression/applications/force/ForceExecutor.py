@@ -17,13 +17,24 @@
 # comment: implements IssExecutor which serves as a Class Wrapper for
 #          for executing force in client processing apps
 
+import filecmp
+
 from executors.generate_executor import *
 
 
+# A control item can add a parity run to the generation with a "parity" key in
+# its generator dictionary. Its value holds the generator arguments of a second
+# run, which generates the test again with the same seed in the parity
+# directory; the other generator arguments are not passed to it. The task
+# fails if the two runs do not produce the same assembly and ELF outputs.
 class ForceExecutor(GenerateExecutor):
+
+    parity_dir = "parity"
+
     def __init__(self):
         super().__init__()
         self.force_cmd = None
+        self.parity_cmd = None
 
     def load(self, arg_ctrl_item):
         super().load(arg_ctrl_item)
@@ -37,6 +48,7 @@ class ForceExecutor(GenerateExecutor):
             self.ctrl_item.num_cores,
             self.ctrl_item.num_threads,
         )
+        my_parity_cmd = my_cmd + " -s %s"
         my_cmd += SysUtils.ifthen(
             self.ctrl_item.seed is None, "", (" -s %s" % (self.ctrl_item.seed))
         )
@@ -44,7 +56,7 @@ class ForceExecutor(GenerateExecutor):
 
         if isinstance(self.ctrl_item.generator, dict):
             for my_key in self.ctrl_item.generator.keys():
-                if my_key not in ["path"]:
+                if my_key not in ["path", "parity"]:
                     my_cmd += " %s %s " % (
                         str(my_key),
                         SysUtils.ifthen(
@@ -55,6 +67,11 @@ class ForceExecutor(GenerateExecutor):
                     )
         self.force_cmd = my_cmd.strip()
 
+        if isinstance(self.ctrl_item.generator, dict):
+            my_parity_args = self.ctrl_item.generator.get("parity", None)
+            if my_parity_args is not None:
+                self.parity_cmd = ("%s %s" % (my_parity_cmd, str(my_parity_args))).strip()
+
     def execute(self):
 
         # Msg.dbg("ExecuteController::exec_gen(%s)" % (arg_task_file))
@@ -83,10 +100,64 @@ class ForceExecutor(GenerateExecutor):
         # the return from exec_process is a tuple, see generate_executor.py,
         # retcode, stdout, stderr, start-time, end-time
         my_results = self.extract_results(my_return, "./" + my_log, "./" + my_elog)
+
+        my_success = SysUtils.success(int(my_results[GenerateKeys.gen_retcode]))
+        if my_success and (self.parity_cmd is not None):
+            my_message = self.execute_parity(my_log, my_elog)
+            if my_message is not None:
+                my_results[GenerateKeys.gen_retcode] = 1
+                my_results[GenerateKeys.gen_message] = my_message
+                my_success = False
+
         Msg.info("GenResult = " + str(my_results))
         Msg.flush()
 
-        return SysUtils.success(int(my_return[GenerateResult.process_retcode]))
+        return my_success
+
+    # generate the test again in the parity directory with the seed of the
+    # first run, returns an error message if the parity run fails or its
+    # outputs differ, None otherwise
+    def execute_parity(self, arg_log, arg_elog):
+        my_task_dir = PathUtils.current_dir()
+        if not PathUtils.chdir(self.parity_dir, True):
+            return "Parity Directory Not Created: %s" % (self.parity_dir)
+
+        my_cmd = self.parity_cmd % (self.task_file, self.ctrl_item.seed)
+        Msg.info("ParityCmd = " + my_cmd, True)
+        my_return = SysUtils.exec_process(my_cmd, arg_log, arg_elog, self.ctrl_item.timeout, True)
+        if self.ctrl_item.suffix is not None:
+            self.rename_elfs(self.ctrl_item.suffix)
+
+        PathUtils.chdir(my_task_dir)
+
+        if SysUtils.failed(int(my_return[GenerateResult.process_retcode])):
+            return "Parity Run Failed, see %s" % (
+                PathUtils.append_path(self.parity_dir, arg_log)
+            )
+
+        return self.compare_parity_outputs()
+
+    # compare the assembly and ELF outputs of the task directory with the ones
+    # of the parity directory
+    def compare_parity_outputs(self):
+        my_files = set()
+        for my_mask in ["*.ELF", "*.S"]:
+            for my_dir in [".", self.parity_dir]:
+                my_match_files = PathUtils.list_files(PathUtils.append_path(my_dir, my_mask))
+                my_files.update(PathUtils.base_name(my_file) for my_file in my_match_files)
+
+        if len(my_files) == 0:
+            return "Parity Outputs Not Found"
+
+        for my_file in sorted(my_files):
+            my_parity_file = PathUtils.append_path(self.parity_dir, my_file)
+            if not (PathUtils.check_file(my_file) and PathUtils.check_file(my_parity_file)):
+                return "Parity Output Missing: %s" % (my_file)
+
+            if not filecmp.cmp(my_file, my_parity_file, False):
+                return "Parity Output Differs: %s" % (my_file)
+
+        return None
 
     # extract information from logs methods
     def query_result_log(self, arg_hfile):
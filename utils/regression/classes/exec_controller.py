@@ -23,6 +23,7 @@ from common.errors import *
 
 from classes.controller import Controller
 from classes.control_item import ControlItem, CtrlItmKeys
+from classes.result_cache import ResultCache
 
 
 class ExecuteController(Controller):
@@ -33,6 +34,7 @@ class ExecuteController(Controller):
         self.task_file = None
         self.task_name = None
         self.task_ndx = None
+        self.result_cache = None
 
     def load(self, arg_ctrl_item):
         super().load(arg_ctrl_item)
@@ -52,6 +54,9 @@ class ExecuteController(Controller):
     def set_frun(self, arg_frun):
         self.frun = arg_frun
 
+    def set_result_cache(self, arg_cache_dir):
+        self.result_cache = ResultCache(arg_cache_dir)
+
     def load_executors(self):
         try:
             # for app_cfg in self.mAppsInfo.mSequenceApps:
@@ -83,6 +88,13 @@ class ExecuteController(Controller):
         my_ret_val = False
 
         try:
+            if self.result_cache is not None:
+                self.result_cache.load(self.frun, self.ctrl_item)
+                if self.result_cache.restore():
+                    return True
+                self.result_cache.start_capture()
+
+            my_all_success = True
             for my_executor in self.executors:
                 Msg.user(
                     "ExecuteController::process_executors( my_executor: %s )"
@@ -92,9 +104,13 @@ class ExecuteController(Controller):
                 my_executor.pre()
                 if not my_executor.execute():
                     Msg.user("Executor returning False", "EXE-CTRL")
+                    my_all_success = False
                     break
                 my_executor.post()
 
+            if my_all_success and self.result_cache is not None:
+                self.result_cache.store()
+
             my_ret_val = True
 
         except Exception as arg_ex:
@@ -102,6 +118,8 @@ class ExecuteController(Controller):
             self.report_error(arg_ex)
 
         finally:
+            if self.result_cache is not None:
+                self.result_cache.stop_capture()
             return my_ret_val
 
     def initialize_task(self):
@@ -0,0 +1,346 @@
+#
+# Copyright (C) [2020] Futurewei Technologies, Inc.
+#
+# FORCE-RISCV is licensed under the Apache License, Version 2.0
+#  (the "License"); you may not use this file except in compliance
+#  with the License.  You may obtain a copy of the License at
+#
+#  http://www.apache.org/licenses/LICENSE-2.0
+#
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES
+# OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+# NON-INFRINGEMENT, MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# file: result_cache.py
+# comment: implements ResultCache which stores the outcome and artifacts of
+#          a task keyed by the content of everything that went into it, so
+#          that an unchanged task can be reused rather than regenerated and
+#          resimulated
+
+import ast
+import hashlib
+import json
+import os
+import re
+import shutil
+import sys
+import tempfile
+
+from common.msg_utils import Msg
+from common.path_utils import PathUtils
+from common.sys_utils import SysUtils
+
+
+# writes to the wrapped stream while keeping the lines the summary reads back
+class ResultLineCapture(object):
+    def __init__(self, aStream, aTags):
+        self.mStream = aStream
+        self.mPattern = re.compile(r"^(%s) = " % "|".join(aTags))
+        self.mPartial = ""
+        self.mLines = []
+
+    def write(self, aText):
+        self.mStream.write(aText)
+        my_lines = (self.mPartial + aText).split("\n")
+        self.mPartial = my_lines.pop()
+        for my_line in my_lines:
+            if self.mPattern.match(my_line):
+                self.mLines.append(my_line)
+
+    def flush(self):
+        self.mStream.flush()
+
+    def __getattr__(self, aName):
+        return getattr(self.mStream, aName)
+
+
+# The cache key is a digest of
+# 1. the task control file, which holds every option, the seed and the paths
+#    of the applications,
+# 2. every file named in the control file, notably the generator and
+#    simulator binaries and configurations,
+# 3. the test template and every python module it imports from the template
+#    directory or the Force py library,
+# 4. the generator configuration file and every file it references, in turn
+#    following the imports of referenced python modules.
+# Only tasks whose applications all succeed are stored; a task with a
+# random seed never matches a stored one.
+class ResultCache(object):
+
+    # lines in the task log from which the summary extracts the results
+    cResultTags = [
+        "GenCmd",
+        "GenResult",
+        "ISSCommand",
+        "ISSResult",
+        "RTLCommand",
+        "RTLResult",
+        "CMPCommand",
+        "CMPResult",
+    ]
+    cResultFile = "_result_cache.py"
+    cFilesDir = "_files"
+    cDefaultConfig = "config/riscv_rv64.config"
+    cConfigFileAttr = re.compile(r'\bfile="([^"]+)"')
+
+    def __init__(self, aCacheDir):
+        self.mCacheDir = PathUtils.real_path(aCacheDir)
+        self.mKey = None
+        self.mInputs = {}
+        self.mCapture = None
+        self.mOrgStdout = None
+        self.mPreExisting = None
+
+    # compute the key of a task, aFrun is the task control file and
+    # aCtrlItem the control item loaded from it
+    def load(self, aFrun, aCtrlItem):
+        with open(aFrun, "r") as my_hfile:
+            my_content = my_hfile.read()
+        self.mInputs = {"frun": hashlib.sha256(my_content.encode()).hexdigest()}
+
+        my_template = PathUtils.real_path(
+            PathUtils.append_path(aCtrlItem.fctrl_dir, aCtrlItem.fctrl_name)
+        )
+        my_force_path = self.locate_force_path(aCtrlItem)
+        my_lib_dirs = [
+            os.path.dirname(my_template),
+            PathUtils.append_path(my_force_path, "py"),
+        ]
+        self.add_python(my_template, my_lib_dirs)
+
+        my_config = self.locate_config(aCtrlItem, my_force_path)
+        self.add_config(my_config, my_force_path, my_lib_dirs)
+
+        for my_token in re.split(r"[\s'\"=,]+", my_content):
+            if my_token.startswith("/") and PathUtils.check_file(my_token):
+                self.add_file(my_token, my_token)
+
+        my_digest = hashlib.sha256()
+        for my_name in sorted(self.mInputs.keys()):
+            my_digest.update(("%s %s\n" % (my_name, self.mInputs[my_name])).encode())
+        self.mKey = my_digest.hexdigest()
+        Msg.user("Result Cache Key: %s" % (self.mKey), "RESULT-CACHE")
+
+        return True
+
+    def entry_dir(self):
+        return PathUtils.append_path(self.mCacheDir, "%s/%s" % (self.mKey[:2], self.mKey))
+
+    # restore the artifacts of a stored task into the current directory and
+    # report its results, returns False when the task is not cached
+    def restore(self):
+        my_entry_dir = self.entry_dir()
+        my_result_file = PathUtils.append_path(my_entry_dir, self.cResultFile)
+        if not PathUtils.check_file(my_result_file):
+            return False
+
+        with open(my_result_file, "r") as my_hfile:
+            my_glb, my_loc = SysUtils.exec_content(my_hfile.read())
+
+        for my_file in my_loc["artifacts"]:
+            shutil.copy2(PathUtils.append_path(my_entry_dir, my_file), my_file)
+
+        Msg.user("Result Cache Hit: %s" % (my_entry_dir), "RESULT-CACHE")
+        for my_line in my_loc["result_lines"]:
+            Msg.info(my_line, True)
+
+        return True
+
+    # start capturing the results of the task being run
+    def start_capture(self):
+        self.mPreExisting = set(os.listdir("."))
+        self.mOrgStdout = sys.stdout
+        self.mCapture = ResultLineCapture(sys.stdout, self.cResultTags)
+        sys.stdout = self.mCapture
+
+    def stop_capture(self):
+        if self.mCapture is not None:
+            sys.stdout = self.mOrgStdout
+            self.mCapture = None
+
+    # store the captured results along with every file the task created
+    def store(self):
+        my_lines = self.mCapture.mLines
+        self.stop_capture()
+
+        my_artifacts = sorted(
+            my_file
+            for my_file in os.listdir(".")
+            if my_file not in self.mPreExisting and PathUtils.check_file(my_file)
+        )
+
+        my_entry_dir = self.entry_dir()
+        my_parent_dir, my_tmp = PathUtils.split_path(my_entry_dir)
+        PathUtils.mkdir(my_parent_dir)
+
+        # stage the entry then move it in place so that concurrent tasks never
+        # see a partial entry
+        my_stage_dir = tempfile.mkdtemp(dir=my_parent_dir)
+        try:
+            os.chmod(my_stage_dir, 0o755)
+            for my_file in my_artifacts:
+                shutil.copy2(my_file, PathUtils.append_path(my_stage_dir, my_file))
+
+            my_content = "artifacts = %s\n" % (repr(my_artifacts))
+            my_content += "result_lines = %s\n" % (repr(my_lines))
+            my_content += "inputs = %s\n" % (repr(self.mInputs))
+            with open(PathUtils.append_path(my_stage_dir, self.cResultFile), "w") as my_hfile:
+                my_hfile.write(my_content)
+
+            os.rename(my_stage_dir, my_entry_dir)
+            Msg.user("Result Cache Store: %s" % (my_entry_dir), "RESULT-CACHE")
+        except OSError as arg_ex:
+            # another task with the same key stored its entry first
+            Msg.user("Result Cache Not Stored: %s" % (str(arg_ex)), "RESULT-CACHE")
+            shutil.rmtree(my_stage_dir, True)
+
+    def add_file(self, aName, aPath, aImports=False):
+        if aName in self.mInputs:
+            return None
+
+        my_record = self.file_record(aPath, aImports)
+        self.mInputs[aName] = my_record["digest"]
+        return my_record
+
+    # the digest of a file, and the imports of a python file, are remembered
+    # in the cache directory along with the size and modification time of the
+    # file so that the tasks sharing the file don't each read it again
+    def file_record(self, aPath, aImports):
+        my_stat = os.stat(aPath)
+        my_memo_dir = PathUtils.append_path(self.mCacheDir, self.cFilesDir)
+        my_memo_file = PathUtils.append_path(
+            my_memo_dir, hashlib.sha1(aPath.encode()).hexdigest()
+        )
+
+        my_record = None
+        try:
+            with open(my_memo_file, "r") as my_hfile:
+                my_record = json.load(my_hfile)
+        except (OSError, ValueError):
+            pass
+
+        if (
+            (my_record is not None)
+            and (my_record["path"] == aPath)
+            and (my_record["size"] == my_stat.st_size)
+            and (my_record["mtime"] == my_stat.st_mtime_ns)
+            and ((not aImports) or ("imports" in my_record))
+        ):
+            return my_record
+
+        my_digest = hashlib.sha256()
+        with open(aPath, "rb") as my_hfile:
+            for my_block in iter(lambda: my_hfile.read(1 << 20), b""):
+                my_digest.update(my_block)
+
+        my_record = {
+            "path": aPath,
+            "size": my_stat.st_size,
+            "mtime": my_stat.st_mtime_ns,
+            "digest": my_digest.hexdigest(),
+        }
+        if aImports:
+            my_record["imports"] = self.python_imports(aPath)
+
+        PathUtils.mkdir(my_memo_dir)
+        my_hfile, my_tmp_file = tempfile.mkstemp(dir=my_memo_dir)
+        with os.fdopen(my_hfile, "w") as my_hfile:
+            json.dump(my_record, my_hfile)
+        os.replace(my_tmp_file, my_memo_file)
+
+        return my_record
+
+    # return the imports of a python file as [level, package, module] lists
+    def python_imports(self, aPath):
+        with open(aPath, "r") as my_hfile:
+            my_tree = ast.parse(my_hfile.read(), aPath)
+
+        my_imports = []
+        for my_node in ast.walk(my_tree):
+            if isinstance(my_node, ast.Import):
+                for my_alias in my_node.names:
+                    my_imports.append([0, "", my_alias.name])
+            elif isinstance(my_node, ast.ImportFrom):
+                my_package = my_node.module or ""
+                if my_node.level == 0:
+                    my_imports.append([0, "", my_package])
+                for my_alias in my_node.names:
+                    my_imports.append([my_node.level, my_package, my_alias.name])
+
+        return my_imports
+
+    # the generator finds its library and configuration files relative to
+    # its own location unless FORCE_PATH is set
+    def locate_force_path(self, aCtrlItem):
+        my_force_path = os.environ.get("FORCE_PATH", None)
+        if my_force_path is None:
+            my_gen_path = PathUtils.real_path(aCtrlItem.generator["path"])
+            my_force_path = os.path.dirname(os.path.dirname(my_gen_path))
+        return PathUtils.exclude_trailing_path_delimiter(my_force_path)
+
+    def locate_config(self, aCtrlItem, aForcePath):
+        my_config = self.cDefaultConfig
+        for my_key in ["-c", "--cfg"]:
+            if aCtrlItem.generator.get(my_key, None) is not None:
+                my_config = aCtrlItem.generator[my_key]
+        if not my_config.startswith("/"):
+            my_config = PathUtils.append_path(aForcePath, my_config)
+        return my_config
+
+    def add_config(self, aConfigPath, aForcePath, aLibDirs):
+        if self.add_file(aConfigPath, aConfigPath) is None:
+            return
+
+        with open(aConfigPath, "r") as my_hfile:
+            my_content = my_hfile.read()
+
+        for my_file in self.cConfigFileAttr.findall(my_content):
+            my_path = my_file
+            if not my_path.startswith("/"):
+                my_path = PathUtils.append_path(aForcePath, my_file)
+            if not PathUtils.check_file(my_path):
+                continue
+
+            if my_path.endswith(".config"):
+                self.add_config(my_path, aForcePath, aLibDirs)
+            elif my_path.endswith(".py"):
+                self.add_python(my_path, aLibDirs)
+            else:
+                self.add_file(my_path, my_path)
+
+    # add a python file and, recursively, the modules it imports that can be
+    # located in the library directories
+    def add_python(self, aPath, aLibDirs):
+        my_record = self.add_file(aPath, aPath, True)
+        if my_record is None:
+            return
+
+        for my_level, my_package, my_module in my_record["imports"]:
+            if my_level == 0:
+                self.add_module(my_package, my_module, aLibDirs, aLibDirs)
+                continue
+
+            # relative imports are located from the package of the file
+            my_package_dir = os.path.dirname(aPath)
+            for my_up in range(1, my_level):
+                my_package_dir = os.path.dirname(my_package_dir)
+            self.add_module(my_package, my_module, [my_package_dir], aLibDirs)
+
+    def add_module(self, aBase, aName, aSearchDirs, aLibDirs):
+        my_parts = [my_part for my_part in (aBase.split(".") + aName.split(".")) if my_part]
+        for my_dir in aSearchDirs:
+            # the packages containing the module are imported along with it
+            my_path = my_dir
+            for my_part in my_parts:
+                my_path = PathUtils.append_path(my_path, my_part)
+                my_init = PathUtils.append_path(my_path, "__init__.py")
+                if PathUtils.check_file(my_init):
+                    self.add_python(my_init, aLibDirs)
+
+            if PathUtils.check_file(my_path + ".py"):
+                self.add_python(my_path + ".py", aLibDirs)
+                return
+            if PathUtils.check_dir(my_path):
+                return
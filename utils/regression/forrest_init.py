@@ -99,6 +99,15 @@ class CommandLineParameters(object):
             {},
             "- when present redirects stdout into specified file",
         ],
+        [
+            "-r",
+            "--result-cache=",
+            1,
+            {},
+            "- when present, reuses the stored results of the task from the "
+            "specified result cache\ndirectory if none of its inputs changed, "
+            "otherwise stores the results there",
+        ],
         [
             "-l",
             "--msg-lev=",
@@ -162,6 +171,7 @@ class CmdLine(object):
         "mode=",  # 4
         "msg-lev=",  # 5
         "logfile=",  # 6
+        "result-cache=",  # 7
     ]
 
     # command Switch Index
@@ -172,3 +182,4 @@ class CmdLine(object):
     mode = 4
     msg_lev = 5
     logfile = 6
+    result_cache = 7
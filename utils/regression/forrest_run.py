@@ -110,6 +110,11 @@ class ForrestRun(ModuleRun):
 
         self.fctrl = ExecuteController(self.m_app_info)
         self.fctrl.set_frun(self.frun_name)
+
+        my_cache_dir = self.option_def(CmdLine.Switches[CmdLine.result_cache], None)
+        if my_cache_dir is not None:
+            self.fctrl.set_result_cache(my_cache_dir)
+
         self.fctrl.load(my_ctrl_item)
 
     def run(self):
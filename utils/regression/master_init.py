@@ -199,6 +199,22 @@ class CommandLineParameters(object):
             "  Allowed values:\n"
             '  \t"mock", "regress", "perf"',
         ],
+        [
+            "--result-cache=",
+            "--result-cache=",
+            1,
+            {"metavar": ""},
+            "- When present, tasks whose template, imported modules, options, "
+            "seed and\n"
+            "  generator and simulator files are unchanged since they were "
+            "stored in the\n"
+            "  specified result cache directory reuse the stored results and "
+            "artifacts\n"
+            "  rather than being generated and simulated again. Tasks that "
+            "succeed are stored.\n"
+            "  Fix the seeds, with --seed or in the control files, for tasks "
+            "to be reused.",
+        ],
     ]
     _group_3_name = "Persistent, yes override"
     _group_3_description = (
@@ -561,6 +577,7 @@ class CmdLine(object):
         "num-threads=",  # 27     Number of threads per core to use in run
         "config=",  # 28     config file name
         "seed=",  # 29     global seed value
+        "result-cache=",  # 30     result cache directory
     ]
 
     # command Switch Index
@@ -594,6 +611,7 @@ class CmdLine(object):
     num_threads = 27
     config = 28
     seed = 29
+    result_cache = 30
 
 
 # end: class CmdOpts(object):
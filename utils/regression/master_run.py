@@ -727,6 +727,13 @@ class MasterRun(ModuleRun):
 
         if self.m_app_info.mConfigPath is not None:
             my_process_cmd += " -w %s" % self.m_app_info.mConfigPath
+
+        my_cache_dir = self.option_def(CmdLine.Switches[CmdLine.result_cache], None)
+        if my_cache_dir is not None:
+            my_cache_dir = PathUtils.real_path(my_cache_dir)
+            if not PathUtils.mkdir(my_cache_dir):
+                raise Exception("Unable to create result cache directory: %s" % (my_cache_dir))
+            my_process_cmd += " --result-cache %s" % my_cache_dir
         my_process_cmd += " -f %s"
 
         self.processor_name = my_run_name.replace(".py", "").replace("_run", "")